@@ -32,6 +32,9 @@
 #include "channelmap.h"
 #include "clockmap.h"
 #include "tests.h"
+#include "debug.h"
+#include "scheduler.h"
+#include "softclock.h"
 #include <util/delay.h>
 
 // Note: Target is ATmega168-20
@@ -53,8 +56,212 @@
 #define BUTTON_LDR			2
 #define BUTTON_TEST			3
 
-#define RELEASED			0
-#define PRESSED				1
+// Task periods in scheduler ticks (mS)
+#define PERIOD_RTCSTEP		1
+#define PERIOD_CONTROL		10
+#define PERIOD_LDRSAMPLE	100
+#define PERIOD_DISPLAY		500
+#define PERIOD_TELEMETRY	30000
+
+// Time setting button auto-repeat in mS
+#define REPEAT_DELAY		600		// Hold time before the first repeat
+#define REPEAT_START		250		// First repeat interval...
+#define REPEAT_FASTEST		40		// ...speeding up to this
+
+// Clock state-machine state
+unsigned char clockState = STATE_CHASETEST;
+
+// Current display brightness
+int displayBrightness = 4095;
+
+// Minute of the day and brightness currently shown (-1 if the display needs
+// a full refresh)
+int displayedMinute = -1;
+int displayedBrightness = -1;
+
+// Button functions are hours, minutes, LDR on/off and test
+unsigned char ldrActiveFlag = 1; // LDR is active
+
+// Time setting auto-repeat for the minute and hour buttons
+unsigned char repeatingButtons = 0;	// Buttons pressed whilst the clock was running
+unsigned int repeatTime[2];			// Tick of the next repeat
+unsigned int repeatInterval[2];		// Current repeat interval
+unsigned char timeChangedFlag = 0;	// Time changed but not written to the RTC
+
+// Telemetry written flags
+unsigned char telemetryWrittenFlag = 0;
+unsigned char driftWrittenFlag = 0;
+
+// Task number of the display refresh (so it can be run early)
+unsigned char displayTaskNumber;
+
+// Display refresh task
+void displayRefreshTask(void)
+{
+	if (clockState != STATE_CLOCKRUNNING) return;
+	
+	// Calculate the minute of the day
+	int minuteOfDay = (datetime.hours * 60) + datetime.minutes;
+	
+	// Only update the display if the minute or brightness has changed
+	if (minuteOfDay == displayedMinute && displayBrightness == displayedBrightness) return;
+	
+	displayMinute(minuteOfDay, displayBrightness);
+	
+	displayedMinute = minuteOfDay;
+	displayedBrightness = displayBrightness;
+}
+
+// LDR sample task
+void ldrSampleTask(void)
+{
+	if (clockState != STATE_CLOCKRUNNING || ldrActiveFlag != 1) return;
+	
+	// Translate the filtered light level into the brightness level for the PWM
+	// (along a perceptual curve so that changes are smooth in dim rooms)
+	displayBrightness = readLdrBrightness();
+}
+
+// Telemetry task
+void telemetryTask(void)
+{
+	// Values are only written once per boot to save wearing out the EEPROM
+	
+	// Record the duty cycle once the power-up test has finished
+	if (clockState == STATE_CLOCKRUNNING && telemetryWrittenFlag == 0)
+	{
+		writeDebugValue(DEBUG_DUTYCYCLE, readDutyCycle());
+		telemetryWrittenFlag = 1;
+	}
+	
+	// Record the software clock drift once it has been measured
+	if (readClockResyncs() != 0 && driftWrittenFlag == 0)
+	{
+		writeDebugValue(DEBUG_CLOCKDRIFT, readClockDrift());
+		driftWrittenFlag = 1;
+	}
+}
+
+// RTC step task (moves on the asynchronous RTC transfers)
+void rtcStepTask(void)
+{
+	stepRTC();
+}
+
+// Advance the minute or hour by one step and show the new time
+//
+// The new time is only written to the RTC once the buttons are released
+void stepTime(unsigned char buttonNumber)
+{
+	if (buttonNumber == BUTTON_MINUTE)
+	{
+		// Advance one minute
+		if (datetime.minutes == 59)
+		{
+			datetime.minutes = 0;
+		}
+		else datetime.minutes++;
+	}
+	else
+	{
+		// Advance one hour
+		if (datetime.hours == 23)
+		{
+			datetime.hours = 0;
+		}
+		else datetime.hours++;
+	}
+	
+	// Reset seconds
+	datetime.seconds = 0;
+	
+	// Stop the software clock being resynchronised to the old time
+	if (timeChangedFlag == 0)
+	{
+		holdSoftClockSync();
+		timeChangedFlag = 1;
+	}
+	
+	setTaskDelay(displayTaskNumber, 0);
+}
+
+// Control task (button handling and the self test)
+void controlTask(void)
+{
+	// Find the buttons which have been pressed from the button events
+	struct buttonEvent event;
+	unsigned char newButtonPresses = 0;
+	
+	while (readButtonEvent(&event)) newButtonPresses |= event.pressed;
+	
+	unsigned char buttonsDown = readButtonsDown();
+	unsigned int ticks = readTicks();
+	
+	// Clock running state
+	if (clockState == STATE_CLOCKRUNNING)
+	{
+		// Minute and hour buttons, step once when pressed and then repeat
+		// (getting faster) whilst held
+		repeatingButtons &= buttonsDown;
+		
+		for (unsigned char buttonNumber = BUTTON_MINUTE; buttonNumber <= BUTTON_HOUR; buttonNumber++)
+		{
+			if (newButtonPresses & (1 << buttonNumber))
+			{
+				stepTime(buttonNumber);
+				repeatingButtons |= (1 << buttonNumber);
+				repeatTime[buttonNumber] = ticks + REPEAT_DELAY;
+				repeatInterval[buttonNumber] = REPEAT_START;
+			}
+			else if ((repeatingButtons & (1 << buttonNumber)) && (int)(ticks - repeatTime[buttonNumber]) >= 0)
+			{
+				stepTime(buttonNumber);
+				repeatTime[buttonNumber] += repeatInterval[buttonNumber];
+				
+				repeatInterval[buttonNumber] -= repeatInterval[buttonNumber] / 4;
+				if (repeatInterval[buttonNumber] < REPEAT_FASTEST) repeatInterval[buttonNumber] = REPEAT_FASTEST;
+			}
+		}
+		
+		// Test button pressed? If so start the full self test
+		if (newButtonPresses & (1 << BUTTON_TEST))
+		{
+			startSelfTest(SELFTEST_FULL);
+			clockState = STATE_CHASETEST;
+		}
+	}
+	
+	// Clock test state
+	else if (clockState == STATE_CHASETEST)
+	{
+		// Any button press stops the test, otherwise advance it
+		if (newButtonPresses != 0) stopSelfTest();
+		else selfTestStep();
+		
+		// Test finished?
+		if (!selfTestRunning())
+		{
+			// Set the led fading speed
+			setLedFadeSpeed(30, 100);
+			
+			// Go back to the clock running state and update the display
+			// straight away
+			clockState = STATE_CLOCKRUNNING;
+			resetDisplayFrame();
+			displayedMinute = -1;
+			setTaskDelay(displayTaskNumber, 0);
+		}
+	}
+	
+	// Write a new time to the RTC (and resynchronise the software clock to
+	// it) once the minute and hour buttons have been released
+	if (timeChangedFlag == 1 && !(buttonsDown & ((1 << BUTTON_MINUTE) | (1 << BUTTON_HOUR))))
+	{
+		writeRTC();
+		syncSoftClock();
+		timeChangedFlag = 0;
+	}
+}
 
 int main(void)
 {
@@ -68,6 +275,12 @@ int main(void)
 	PORTC = 0x00;
 	PORTD = 0x00;
 	
+	// Start the scheduler tick (also used for measuring the boot time)
+	initialiseScheduler();
+	
+	// Enable interrupts globally
+	sei();
+	
 	// Power up delay of 1 second
 	// This is required since we don't have a capacitor on the reset line
 	// which can cause the reset to bounce as power ramps up after being
@@ -76,13 +289,13 @@ int main(void)
 	
 	// Initialise the TLC5940s
 	initialiseTlc5940();
+	
+	// Record the time taken to get the TLC5940s running
+	writeDebugValue(DEBUG_BOOTTIME, readTicks());
 
 	// Initialise the LED fading control
 	initialiseFadingLeds();
 	
-	// Enable interrupts globally
-	sei();
-	
 	// Initialise the DS1302 RTC
 	initialiseRTC();
 	
@@ -108,186 +321,27 @@ int main(void)
 	// Initialise the buttons
 	initialiseButtons();
 	
-	// Initialise state-machine to run power-up test
-	unsigned char clockState = STATE_CHASETEST;
-	//unsigned char clockState = STATE_CLOCKRUNNING;
-	
-	// Set the start brightness
-	int displayBrightness = 4095;
-	
-	// State-machine delay counter
-	unsigned int delayCounter1 = 0;
+	// Set the led fading speed (the self test sets its own until it ends)
+	setLedFadeSpeed(30, 100);
 	
-	// Button functions are hours, minutes, LDR on/off and test
-	unsigned char minuteButtonDownFlag = 0;
-	unsigned char hourButtonDownFlag = 0;
+	// Run the short power-up test (the chase test, lighting each LED once)
+	// so that after a power cut the time is back on the display within a
+	// couple of seconds.  The full test is run with the test button.
+	startSelfTest(SELFTEST_CHASE);
 	
-	unsigned char ldrActiveFlag = 1; // LDR is active
+	// Register the tasks
+	addTask(rtcStepTask, PERIOD_RTCSTEP);
+	addTask(controlTask, PERIOD_CONTROL);
+	addTask(ldrSampleTask, PERIOD_LDRSAMPLE);
+	displayTaskNumber = addTask(displayRefreshTask, PERIOD_DISPLAY);
+	addTask(telemetryTask, PERIOD_TELEMETRY);
 	
-	// Set the led fading speed
-	setLedFadeSpeed(30, 100);
+	// Start the software clock (which updates the display on each new minute)
+	initialiseSoftClock(displayTaskNumber);
 	
+	// Run the tasks, sleeping in between
 	while(1)
 	{
-		// Update the delay counter
-		delayCounter1++;
-		
-		// Poll the button states
-		pollButtons();
-		
-		// Clock running state
-		if (clockState == STATE_CLOCKRUNNING)
-		{
-			// Update the clock display ------------------------------------------------------------------
-			if (delayCounter1 > 30000)
-			{	
-				int minuteOfDay = 0;
-			
-				// Read the real-time clock
-				readRTC();
-			
-				// Calculate the minute of the day
-				minuteOfDay = (datetime.hours * 60) + datetime.minutes;
-			
-				// Update the display
-				displayMinute(minuteOfDay, displayBrightness);
-				
-				// Reset the delay counter
-				delayCounter1 = 0;
-			}
-			
-			// Button handling ---------------------------------------------------------------------------
-			
-			// Minute button pressed?
-			if (button[BUTTON_MINUTE].buttonState == PRESSED && minuteButtonDownFlag == 0)
-			{
-				// Read the current time
-				readRTC();
-				
-				// Advance one minute and reset seconds
-				if (datetime.minutes == 59)
-				{
-					datetime.minutes = 0;
-				}
-				else datetime.minutes++;
-				datetime.seconds = 0;
-				
-				// Set the RTC
-				setRTC();
-				
-				minuteButtonDownFlag = 1;
-			}
-			
-			// Minute button released?
-			if (button[BUTTON_MINUTE].buttonState == RELEASED && minuteButtonDownFlag == 1)
-			{
-				minuteButtonDownFlag = 0;
-			}
-			
-			// Hour button pressed?
-			if (button[BUTTON_HOUR].buttonState == PRESSED && hourButtonDownFlag == 0)
-			{
-				// Read the current time
-				readRTC();
-				
-				// Advance one hour and reset seconds
-				if (datetime.hours == 23)
-				{
-					datetime.hours = 0;
-				}
-				else datetime.hours++;
-				datetime.seconds = 0;
-				
-				// Set the RTC
-				setRTC();
-				
-				hourButtonDownFlag = 1;
-			}
-			
-			// Minute button released?
-			if (button[BUTTON_HOUR].buttonState == RELEASED && hourButtonDownFlag == 1)
-			{
-				hourButtonDownFlag = 0;
-			}
-			
-			// Test button pressed? If so change state
-			if (button[BUTTON_TEST].buttonState == 1) clockState = STATE_CHASETEST;
-			
-			// LDR brightness control --------------------------------------------------------------------
-			if (ldrActiveFlag == 1)
-			{
-				unsigned int ldrValue = 0;
-				
-				// Read the LDR brightness level (0-15)
-				ldrValue = readLdrValue();
-				
-				// Here we use a switch statement to translate the LDR level into the brightness
-				// level for the PWM (which allows us to choose a logarithmic or linear scale)
-				switch(ldrValue)
-				{
-					case 0 :	displayBrightness = 100;
-								break;
-					
-					case 1 :	displayBrightness = (4095/16) * 1;
-								break;
-					
-					case 2 :	displayBrightness = (4095/16) * 2;
-								break;
-					
-					case 3 :	displayBrightness = (4095/16) * 3;
-								break;
-					
-					case 4 :	displayBrightness = (4095/16) * 4;
-								break;
-					
-					case 5 :	displayBrightness = (4095/16) * 5;
-								break;
-					
-					case 6 :	displayBrightness = (4095/16) * 6;
-								break;
-					
-					case 7 :	displayBrightness = (4095/16) * 7;
-								break;
-					
-					case 8 :	displayBrightness = (4095/16) * 8;
-								break;
-					
-					case 9 :	displayBrightness = (4095/16) * 9;
-								break;
-					
-					case 10 :	displayBrightness = (4095/16) * 10;
-								break;
-					
-					case 11 :	displayBrightness = (4095/16) * 11;
-								break;
-					
-					case 12 :	displayBrightness = (4095/16) * 12;
-								break;
-					
-					case 13 :	displayBrightness = (4095/16) * 13;
-								break;
-					
-					case 14 :	displayBrightness = (4095/16) * 14;
-								break;
-					
-					case 15 :	displayBrightness = 4095;
-								break;
-				}
-			}
-		}
-		
-		// Clock test state
-		if (clockState == STATE_CHASETEST)
-		{
-			// Perform the test
-			chaseTest();
-			emrTest();
-
-			// Set the led fading speed
-			setLedFadeSpeed(30, 100);
-
-			// Go back to the clock running state
-			clockState = STATE_CLOCKRUNNING;
-		}
+		runScheduler();
 	}
 }
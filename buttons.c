@@ -23,19 +23,32 @@
 
 // Includes
 #include <avr/io.h>
+#include <avr/interrupt.h>
 #include "hardware.h"
+#include "scheduler.h"
 #include "buttons.h"
 
+#if (BUTTON2_PIN != BUTTON1_PIN + 1) || (BUTTON3_PIN != BUTTON1_PIN + 2) || (BUTTON4_PIN != BUTTON1_PIN + 3)
+#error "The button pins must be consecutive"
+#endif
+
+// Button event queue
+struct buttonEvent buttonEventQueue[BUTTONEVENTQUEUESIZE];
+volatile unsigned char buttonEventHead = 0;	// Next slot to write (interrupt only)
+volatile unsigned char buttonEventTail = 0;	// Next slot to read (main loop only)
+volatile unsigned int buttonEventsDropped = 0;
+
+// Debounced button states (port bits, 1 is pressed)
+volatile unsigned char buttonsDown = 0;
+
+// Vertical counter (bit 0, 1 and 2 of the count for each button)
+unsigned char buttonCount0 = 0;
+unsigned char buttonCount1 = 0;
+unsigned char buttonCount2 = 0;
+
 // Initialise the button states
 void initialiseButtons(void)
 {
-	// Initialise the button states
-	for (unsigned char buttonNumber = 0; buttonNumber < NUMBEROFBUTTONS; buttonNumber++)
-	{
-		button[buttonNumber].buttonState = 0; // Button is off
-		button[buttonNumber].debounceCounter = 0; // Reset debounce counter
-	}
-	
 	// Set the button ports to input and turn on the internal pull-ups
 	cbi(BUTTON1_DIR_PORT, BUTTON1_PIN); // Set port as input
 	sbi(BUTTON1_PORT, BUTTON1_PIN); // Pull up on
@@ -48,56 +61,106 @@ void initialiseButtons(void)
 	
 	cbi(BUTTON4_DIR_PORT, BUTTON4_PIN); // Set port as input
 	sbi(BUTTON4_PORT, BUTTON4_PIN); // Pull up on
+	
+	// The samples are taken half way between scheduler ticks
+	OCR0B = TICKCOUNTS / 2;
+	
+	// Enable the pin-change interrupts for the buttons and take the first
+	// samples (in case a button is already down)
+	BUTTON_PCMSK |= BUTTON_MASK;
+	PCIFR = (1 << BUTTON_PCIE);
+	PCICR |= (1 << BUTTON_PCIE);
+	
+	TIFR0 = (1 << OCF0B);
+	TIMSK0 |= (1 << OCIE0B);
 }
 
-// Poll the hardware buttons
-void pollButtons(void)
+// Add an event to the button event queue (called from the interrupt only)
+void queueButtonEvent(unsigned char pressed, unsigned char released, unsigned int time)
 {
-	unsigned char buttonState;
+	unsigned char head = buttonEventHead;
+	unsigned char nextHead = (head + 1) & (BUTTONEVENTQUEUESIZE - 1);
 	
-	for (unsigned char buttonNumber = 0; buttonNumber < NUMBEROFBUTTONS; buttonNumber++)
+	// Queue full?
+	if (nextHead == buttonEventTail)
 	{
-		// Get the physical button state
-		switch (buttonNumber)
-		{
-			case 0:	if (BUTTON1_INP & (1 << BUTTON1_PIN)) buttonState = 0; else buttonState = 1;
-					break;
-					
-			case 1:	if (BUTTON2_INP & (1 << BUTTON2_PIN)) buttonState = 0; else buttonState = 1;
-					break;
-					
-			case 2:	if (BUTTON3_INP & (1 << BUTTON3_PIN)) buttonState = 0; else buttonState = 1;
-					break;
-					
-			case 3:	if (BUTTON4_INP & (1 << BUTTON4_PIN)) buttonState = 0; else buttonState = 1;
-					break;
-		}
-		
+		buttonEventsDropped++;
+		return;
+	}
+	
+	buttonEventQueue[head].pressed = pressed;
+	buttonEventQueue[head].released = released;
+	buttonEventQueue[head].time = time;
+	
+	// Publish the event
+	buttonEventHead = nextHead;
+}
 
+// Take the next event from the button event queue
+//
+// Returns 1 if an event was read or 0 if the queue is empty
+unsigned char readButtonEvent(struct buttonEvent *event)
+{
+	unsigned char tail = buttonEventTail;
+	
+	if (tail == buttonEventHead) return 0;
+	
+	*event = buttonEventQueue[tail];
+	
+	// Free the slot
+	buttonEventTail = (tail + 1) & (BUTTONEVENTQUEUESIZE - 1);
+	
+	return 1;
+}
+
+// Read the debounced button states (bit n is button n, 1 is pressed)
+unsigned char readButtonsDown(void)
+{
+	return buttonsDown >> BUTTON1_PIN;
+}
+
+// Read the number of button events lost because the queue was full
+unsigned int readButtonEventsDropped(void)
+{
+	return buttonEventsDropped;
+}
+
+// Pin-change interrupt procedure for the buttons
+ISR(PCINT1_vect)
+{
+	SCHEDULER_WAKE();
+	
+	// Start sampling the buttons
+	TIMSK0 |= (1 << OCIE0B);
+}
+
+// Timer0 compare B interrupt procedure for sampling the buttons
+//
+// Runs once a tick whilst any button is changing
+ISR(TIMER0_COMPB_vect)
+{
+	SCHEDULER_WAKE();
+	
+	// Note: buttons are active low so on is 0 and off is 1
+	unsigned char changed = (~BUTTON_INP & BUTTON_MASK) ^ buttonsDown;
+	
+	// Count the samples which differ from the debounced state (counters of
+	// buttons which match are reset) and toggle the buttons which have
+	// differed for 8 samples
+	unsigned char toggle = changed & buttonCount0 & buttonCount1 & buttonCount2;
+	
+	buttonCount2 = (buttonCount2 ^ (buttonCount1 & buttonCount0)) & changed & ~toggle;
+	buttonCount1 = (buttonCount1 ^ buttonCount0) & changed & ~toggle;
+	buttonCount0 = ~buttonCount0 & changed & ~toggle;
+	
+	if (toggle)
+	{
+		buttonsDown ^= toggle;
 		
-		// Note: buttons are active low so on is 0 and off is 1
-		
-		// Debounce ON
-		if (buttonState == 1 && button[buttonNumber].buttonState == 0)
-		{
-			// If the debounce tolerance is met change state otherwise
-			// increment the debounce counter
-			if (button[buttonNumber].debounceCounter > BUTTONDEBOUNCE)
-				button[buttonNumber].buttonState = 1;		
-			else button[buttonNumber].debounceCounter++;
-		}
-	
-		// Debounce OFF
-		if (buttonState == 0 && button[buttonNumber].buttonState == 1)
-		{
-			// If the debounce tolerance is met change state otherwise
-			// increment the debounce counter
-			if (button[buttonNumber].debounceCounter > BUTTONDEBOUNCE)
-				button[buttonNumber].buttonState = 0;			
-			else button[buttonNumber].debounceCounter++;
-		}
-		
-		// Reset debounce counter
-		if (buttonState == button[buttonNumber].buttonState) button[buttonNumber].debounceCounter = 0;
-	} // end for
-}
\ No newline at end of file
+		queueButtonEvent((toggle & buttonsDown) >> BUTTON1_PIN,
+			(toggle & ~buttonsDown) >> BUTTON1_PIN, readTicks() - (BUTTONDEBOUNCE - 1));
+	}
+	
+	// Stop sampling once all of the buttons are stable
+	if ((changed & ~toggle) == 0) TIMSK0 &= ~(1 << OCIE0B);
+}
@@ -24,11 +24,26 @@
 #ifndef BUTTONS_H_
 #define BUTTONS_H_
 
+// The buttons generate pin-change interrupts, which start the timer0 compare
+// B interrupt sampling the button pins once a tick (mS).  The samples are
+// debounced for all of the buttons at once by a 3 bit vertical counter (one
+// bit of each of the three counter bytes per button) so a button only
+// changes state after BUTTONDEBOUNCE identical samples.  Changes are put
+// into the button event queue as masks of the buttons pressed and released,
+// and the sampling stops once all of the buttons are stable.
+//
+// The queue has a single producer (the interrupt) and a single consumer (the
+// main loop) so it needs no locking: only the interrupt moves the head and
+// only readButtonEvent() moves the tail.
+
 // Define the number of buttons
 #define NUMBEROFBUTTONS	4
 
-// Define the number of debounce checks before switching state
-#define BUTTONDEBOUNCE 10
+// Define the debounce time in mS (fixed by the 3 bit vertical counter)
+#define BUTTONDEBOUNCE 8
+
+// Button event queue size (must be a power of 2)
+#define BUTTONEVENTQUEUESIZE	8
 
 // Button hardware mapping definitions
 #define BUTTON1_PORT		PORTC
@@ -51,16 +66,25 @@
 #define BUTTON4_INP			PINC
 #define BUTTON4_DIR_PORT	DDRC
 
-// Define a global structure for storing the button states
-struct buttonStruct {
-	unsigned char buttonState;
-	unsigned char debounceCounter;
+// All of the buttons are on consecutive PORTC pins (PCINT8-14) so the
+// button masks are the port bits shifted down by BUTTON1_PIN, the pin-change
+// mask and the input port need to be changed if that changes
+#define BUTTON_INP			PINC
+#define BUTTON_PCMSK		PCMSK1
+#define BUTTON_PCIE			PCIE1
+#define BUTTON_MASK			((1 << BUTTON1_PIN) | (1 << BUTTON2_PIN) | (1 << BUTTON3_PIN) | (1 << BUTTON4_PIN))
+
+// Define a structure for the button events (bit n of the masks is button n)
+struct buttonEvent {
+	unsigned char pressed;		// Buttons pressed
+	unsigned char released;		// Buttons released
+	unsigned int time;			// Scheduler tick of the first debounce sample
 };
 
-struct buttonStruct button[NUMBEROFBUTTONS];
-
 // Function prototypes
 void initialiseButtons(void);
-void pollButtons(void);
+unsigned char readButtonsDown(void);
+unsigned char readButtonEvent(struct buttonEvent *event);
+unsigned int readButtonEventsDropped(void);
 
 #endif /* BUTTONS_H_ */
\ No newline at end of file
@@ -23,82 +23,71 @@
 
 // Includes
 #include <avr/io.h>
+#include <avr/pgmspace.h>
 #include "hardware.h"
 #include "tlc5940.h"
 #include "channelmap.h"
 #include <util/delay.h>
 
+// The look up tables are built by the compiler from the channel mapping
+// definitions in channelmap.h and hold one entry for every TLC5940 channel
+#if NUMBEROF5940 != 7
+#error "The channel map look up tables must have one row per TLC5940"
+#endif
+
+#define CHANNELMAP_ROW(tlcNumber) \
+	CHANNELMAP_CHANNEL((tlcNumber) * 16 + 0), CHANNELMAP_CHANNEL((tlcNumber) * 16 + 1), \
+	CHANNELMAP_CHANNEL((tlcNumber) * 16 + 2), CHANNELMAP_CHANNEL((tlcNumber) * 16 + 3), \
+	CHANNELMAP_CHANNEL((tlcNumber) * 16 + 4), CHANNELMAP_CHANNEL((tlcNumber) * 16 + 5), \
+	CHANNELMAP_CHANNEL((tlcNumber) * 16 + 6), CHANNELMAP_CHANNEL((tlcNumber) * 16 + 7), \
+	CHANNELMAP_CHANNEL((tlcNumber) * 16 + 8), CHANNELMAP_CHANNEL((tlcNumber) * 16 + 9), \
+	CHANNELMAP_CHANNEL((tlcNumber) * 16 + 10), CHANNELMAP_CHANNEL((tlcNumber) * 16 + 11), \
+	CHANNELMAP_CHANNEL((tlcNumber) * 16 + 12), CHANNELMAP_CHANNEL((tlcNumber) * 16 + 13), \
+	CHANNELMAP_CHANNEL((tlcNumber) * 16 + 14), CHANNELMAP_CHANNEL((tlcNumber) * 16 + 15)
+
+// Check that the mapping is one to one over 0 to NUMBEROF5940 * 16 - 1.  The
+// mapping is the swap corrections, then the TLC_CHANNELn order within each
+// TLC5940, then the reversal of the whole chain, so it is one to one if the
+// TLC_CHANNELn definitions are a reordering of 0 to 15 and the corrections
+// only swap channels in range (each channel being swapped at most once).
+#if ((1 << TLC_CHANNEL0) | (1 << TLC_CHANNEL1) | (1 << TLC_CHANNEL2) | (1 << TLC_CHANNEL3) | \
+	(1 << TLC_CHANNEL4) | (1 << TLC_CHANNEL5) | (1 << TLC_CHANNEL6) | (1 << TLC_CHANNEL7) | \
+	(1 << TLC_CHANNEL8) | (1 << TLC_CHANNEL9) | (1 << TLC_CHANNEL10) | (1 << TLC_CHANNEL11) | \
+	(1 << TLC_CHANNEL12) | (1 << TLC_CHANNEL13) | (1 << TLC_CHANNEL14) | (1 << TLC_CHANNEL15)) != 0xFFFF
+#error "TLC_CHANNEL0 to TLC_CHANNEL15 must use each of the channels 0 to 15 once"
+#endif
+
+#define CHANNELMAP_SWAPCHECK(channel) \
+	(CHANNELMAP_SWAP(channel) < NUMBEROF5940 * 16 && CHANNELMAP_SWAP(CHANNELMAP_SWAP(channel)) == (channel))
+
+#define CHANNELMAP_SWAPCHECKROW(tlcNumber) \
+	(CHANNELMAP_SWAPCHECK((tlcNumber) * 16 + 0) && CHANNELMAP_SWAPCHECK((tlcNumber) * 16 + 1) && \
+	 CHANNELMAP_SWAPCHECK((tlcNumber) * 16 + 2) && CHANNELMAP_SWAPCHECK((tlcNumber) * 16 + 3) && \
+	 CHANNELMAP_SWAPCHECK((tlcNumber) * 16 + 4) && CHANNELMAP_SWAPCHECK((tlcNumber) * 16 + 5) && \
+	 CHANNELMAP_SWAPCHECK((tlcNumber) * 16 + 6) && CHANNELMAP_SWAPCHECK((tlcNumber) * 16 + 7) && \
+	 CHANNELMAP_SWAPCHECK((tlcNumber) * 16 + 8) && CHANNELMAP_SWAPCHECK((tlcNumber) * 16 + 9) && \
+	 CHANNELMAP_SWAPCHECK((tlcNumber) * 16 + 10) && CHANNELMAP_SWAPCHECK((tlcNumber) * 16 + 11) && \
+	 CHANNELMAP_SWAPCHECK((tlcNumber) * 16 + 12) && CHANNELMAP_SWAPCHECK((tlcNumber) * 16 + 13) && \
+	 CHANNELMAP_SWAPCHECK((tlcNumber) * 16 + 14) && CHANNELMAP_SWAPCHECK((tlcNumber) * 16 + 15))
+
+#if !(CHANNELMAP_SWAPCHECKROW(0) && CHANNELMAP_SWAPCHECKROW(1) && CHANNELMAP_SWAPCHECKROW(2) && \
+	CHANNELMAP_SWAPCHECKROW(3) && CHANNELMAP_SWAPCHECKROW(4) && CHANNELMAP_SWAPCHECKROW(5) && \
+	CHANNELMAP_SWAPCHECKROW(6))
+#error "The channel corrections in CHANNELMAP_SWAP() must be in range and swap each channel at most once"
+#endif
+
+// Logical to physical channel look up table
+const prog_uchar channelMapTable[] PROGMEM = {
+	CHANNELMAP_ROW(0), CHANNELMAP_ROW(1), CHANNELMAP_ROW(2), CHANNELMAP_ROW(3),
+	CHANNELMAP_ROW(4), CHANNELMAP_ROW(5), CHANNELMAP_ROW(6)
+};
+
+// Map a logical channel (0-106) to the physical TLC5940 channel
 unsigned char channelMap(unsigned char channel)
 {
 	// Range check the channel
 	if (channel > 106)
 		channel = 106;
 
-	// Correct mis-wired channels using hard-coded corrections ---------------------------------------------------------
-	if (channel == 11) channel = 12;
-	else if (channel == 12) channel = 11;
-	
-	else if (channel == 13) channel = 14;
-	else if (channel == 14) channel = 13;
-	
-	else if (channel == 52) channel = 56;
-	else if (channel == 56) channel = 52;
-	
-	else if (channel == 90) channel = 93;
-	else if (channel == 93) channel = 90;
-	
-	// Remap the channels according to the physical channel map of the TLC --------------------------------------------
-	int tlcNumber, localChannel, mappedChannel = 0;
-	
-	// Find the number of the target TLC
-	if (channel != 0) tlcNumber = channel / 16; // Since we are using an int this will round down
-	else tlcNumber = 0;  // Avoid divide by zero
-	
-	// Find the 'local' channel number for the TLC
-	localChannel = channel - (tlcNumber * 16);
-
-	// Map the pin
-	switch(localChannel)
-	{
-		case 0 :	mappedChannel = TLC_CHANNEL0;
-					break;
-		case 1 :	mappedChannel = TLC_CHANNEL1;
-					break;
-		case 2 :	mappedChannel = TLC_CHANNEL2;
-					break;
-		case 3 :	mappedChannel = TLC_CHANNEL3;
-					break;
-		case 4 :	mappedChannel = TLC_CHANNEL4;
-					break;
-		case 5 :	mappedChannel = TLC_CHANNEL5;
-					break;
-		case 6 :	mappedChannel = TLC_CHANNEL6;
-					break;
-		case 7 :	mappedChannel = TLC_CHANNEL7;
-					break;
-		case 8 :	mappedChannel = TLC_CHANNEL8;
-					break;
-		case 9 :	mappedChannel = TLC_CHANNEL9;
-					break;
-		case 10 :	mappedChannel = TLC_CHANNEL10;
-					break;
-		case 11 :	mappedChannel = TLC_CHANNEL11;
-					break;
-		case 12 :	mappedChannel = TLC_CHANNEL12;
-					break;
-		case 13 :	mappedChannel = TLC_CHANNEL13;
-					break;
-		case 14 :	mappedChannel = TLC_CHANNEL14;
-					break;
-		case 15 :	mappedChannel = TLC_CHANNEL15;
-					break;
-	}
-	
-	// Now readjust the channel number against the mapped channel
-	channel = mappedChannel + (tlcNumber * 16);
-	
-	// Reverse the channel order --------------------------------------------------------------------------------------
-	channel = (NUMBEROF5940 * 16 - 1) - channel;
-	
-	return channel;
+	return pgm_read_byte_near(&channelMapTable[channel]);
 }
\ No newline at end of file
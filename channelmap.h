@@ -43,6 +43,32 @@
 #define TLC_CHANNEL14	12
 #define TLC_CHANNEL15	14
 
+// Compile-time channel mapping used to build the look up tables with
+// physical channel numbers (the channel must be a constant).  channelmap.c
+// checks that the mapping is one to one over 0 to NUMBEROF5940 * 16 - 1
+
+// Correct mis-wired channels using hard-coded corrections (each correction
+// swaps two channels so this is its own inverse)
+#define CHANNELMAP_SWAP(channel) \
+	((channel) == 11 ? 12 : (channel) == 12 ? 11 : \
+	 (channel) == 13 ? 14 : (channel) == 14 ? 13 : \
+	 (channel) == 52 ? 56 : (channel) == 56 ? 52 : \
+	 (channel) == 90 ? 93 : (channel) == 93 ? 90 : (channel))
+
+#define CHANNELMAP_LOCAL(localChannel) \
+	((localChannel) == 0 ? TLC_CHANNEL0 : (localChannel) == 1 ? TLC_CHANNEL1 : \
+	 (localChannel) == 2 ? TLC_CHANNEL2 : (localChannel) == 3 ? TLC_CHANNEL3 : \
+	 (localChannel) == 4 ? TLC_CHANNEL4 : (localChannel) == 5 ? TLC_CHANNEL5 : \
+	 (localChannel) == 6 ? TLC_CHANNEL6 : (localChannel) == 7 ? TLC_CHANNEL7 : \
+	 (localChannel) == 8 ? TLC_CHANNEL8 : (localChannel) == 9 ? TLC_CHANNEL9 : \
+	 (localChannel) == 10 ? TLC_CHANNEL10 : (localChannel) == 11 ? TLC_CHANNEL11 : \
+	 (localChannel) == 12 ? TLC_CHANNEL12 : (localChannel) == 13 ? TLC_CHANNEL13 : \
+	 (localChannel) == 14 ? TLC_CHANNEL14 : TLC_CHANNEL15)
+
+#define CHANNELMAP_CHANNEL(channel) \
+	((NUMBEROF5940 * 16 - 1) - ((CHANNELMAP_SWAP(channel) / 16) * 16 + \
+	 CHANNELMAP_LOCAL(CHANNELMAP_SWAP(channel) % 16)))
+
 // Function prototypes
 unsigned char channelMap(unsigned char channel);
 
@@ -29,2939 +29,394 @@
 #include "channelmap.h"
 #include <util/delay.h>
 
-// The look up table *must* use the pgmspace type definitions...
-const prog_uchar clockMap[] PROGMEM = {
-    // ?????? ???????
-    0x0, 0x97,
-    // ?????? ???? ?????? ??????? ????
-    0x0, 0x18, 0x3a, 0x62, 0xe6,
-    // ?????? ??? ?????? ??????? ????
-    0x0, 0x16, 0x32, 0x62, 0xe6,
-    // ?????? ??? ?????? ??????? ????
-    0x0, 0x48, 0x4a, 0x62, 0xe6,
-    // ?????? ?????? ?????? ??????? ????
-    0x0, 0x46, 0x4a, 0x62, 0xe6,
-    // ?????? ???? ????? ??????? ????
-    0x0, 0x4c, 0x50, 0x62, 0xe6,
-    // ?????? ????? ????? ??????? ????
-    0x0, 0x47, 0x50, 0x62, 0xe6,
-    // ?????? ???? ????? ??????? ????
-    0x0, 0x4d, 0x50, 0x62, 0xe6,
-    // ?????? ?????? ????? ??????? ????
-    0x0, 0x45, 0x50, 0x62, 0xe6,
-    // ?????? ?????? ????? ??????? ????
-    0x0, 0x44, 0x50, 0x62, 0xe6,
-    // ?????? ?????? ????? ??????? ????
-    0x0, 0x43, 0x50, 0x62, 0xe6,
-    // ?????? ??????????? ????? ??????? ????
-    0x0, 0x41, 0x42, 0x50, 0x62, 0xe6,
-    // ?????? ?????????? ????? ??????? ????
-    0x0, 0x3e, 0x40, 0x50, 0x62, 0xe6,
-    // ?????? ?????????? ????? ??????? ????
-    0x0, 0x30, 0x31, 0x3d, 0x62, 0xe6,
-    // ?????? ???????????? ????? ??????? ????
-    0x0, 0xd, 0xe, 0x3d, 0x62, 0xe6,
-    // ?????? ???????? ??????? ????
-    0x0, 0x25, 0x26, 0x62, 0xe6,
-    // ?????? ??????????? ????? ??????? ????
-    0x0, 0x1, 0x2, 0x3d, 0x62, 0xe6,
-    // ?????? ?????????? ????? ??????? ????
-    0x0, 0x27, 0x28, 0x3d, 0x62, 0xe6,
-    // ?????? ???????????? ????? ??????? ????
-    0x0, 0x6, 0x7, 0x3d, 0x62, 0xe6,
-    // ?????? ???????????? ????? ??????? ????
-    0x0, 0xb, 0xc, 0x3d, 0x62, 0xe6,
-    // ?????? ???????? ????? ??????? ????
-    0x0, 0x4, 0x5, 0x3d, 0x62, 0xe6,
-    // ?????? ???????? ???? ?????? ??????? ????
-    0x0, 0x4, 0x5, 0x18, 0x3a, 0x62, 0xe6,
-    // ?????? ???????? ??? ?????? ??????? ????
-    0x0, 0x4, 0x5, 0x16, 0x32, 0x62, 0xe6,
-    // ?????? ???????? ??? ?????? ??????? ????
-    0x0, 0x4, 0x5, 0x48, 0x4a, 0x62, 0xe6,
-    // ?????? ???????? ?????? ?????? ??????? ????
-    0x0, 0x4, 0x5, 0x46, 0x4a, 0x62, 0xe6,
-    // ?????? ???????? ???? ????? ??????? ????
-    0x0, 0x4, 0x5, 0x4c, 0x50, 0x62, 0xe6,
-    // ?????? ???????? ????? ????? ??????? ????
-    0x0, 0x4, 0x5, 0x47, 0x50, 0x62, 0xe6,
-    // ?????? ???????? ???? ????? ??????? ????
-    0x0, 0x4, 0x5, 0x4d, 0x50, 0x62, 0xe6,
-    // ?????? ???????? ?????? ????? ??????? ????
-    0x0, 0x4, 0x5, 0x45, 0x50, 0x62, 0xe6,
-    // ?????? ???????? ?????? ????? ??????? ????
-    0x0, 0x4, 0x5, 0x44, 0x50, 0x62, 0xe6,
-    // ?????? ???????? ??????? ????
-    0x0, 0x22, 0x23, 0x62, 0xe6,
-    // ?????? ??? ???????? ?????? ????? ??? ????
-    0x0, 0x8, 0x12, 0x13, 0x3c, 0x3d, 0x4b, 0xe6,
-    // ?????? ??? ???????? ?????? ????? ??? ????
-    0x0, 0x8, 0x12, 0x13, 0x3b, 0x3d, 0x4b, 0xe6,
-    // ?????? ??? ???????? ???? ????? ??? ????
-    0x0, 0x8, 0x12, 0x13, 0x35, 0x3d, 0x4b, 0xe6,
-    // ?????? ??? ???????? ????? ????? ??? ????
-    0x0, 0x8, 0x12, 0x13, 0x29, 0x3d, 0x4b, 0xe6,
-    // ?????? ??? ???????? ???? ????? ??? ????
-    0x0, 0x8, 0x12, 0x13, 0x34, 0x3d, 0x4b, 0xe6,
-    // ?????? ??? ???????? ??????? ????? ??? ????
-    0x0, 0x8, 0x12, 0x13, 0x33, 0x3d, 0x4b, 0xe6,
-    // ?????? ??? ???????? ???? ????? ??? ????
-    0x0, 0x8, 0x12, 0x13, 0x1e, 0x3d, 0x4b, 0xe6,
-    // ?????? ??? ???????? ???? ????? ??? ????
-    0x0, 0x8, 0x12, 0x13, 0x36, 0x3d, 0x4b, 0xe6,
-    // ?????? ??? ???????? ????? ?????? ??? ????
-    0x0, 0x8, 0x12, 0x13, 0x24, 0x32, 0x4b, 0xe6,
-    // ?????? ??? ???????? ????? ??? ????
-    0x0, 0x8, 0x12, 0x13, 0x3d, 0x4b, 0xe6,
-    // ?????? ??? ???????????? ????? ??? ????
-    0x0, 0x8, 0x19, 0x1a, 0x3d, 0x4b, 0xe6,
-    // ?????? ??? ???????????? ????? ??? ????
-    0x0, 0x8, 0x1b, 0x1c, 0x3d, 0x4b, 0xe6,
-    // ?????? ??? ?????????? ????? ??? ????
-    0x0, 0x8, 0x2a, 0x2b, 0x3d, 0x4b, 0xe6,
-    // ?????? ??? ??????????? ????? ??? ????
-    0x0, 0x8, 0x9, 0xa, 0x3d, 0x4b, 0xe6,
-    // ?????? ??? ???????? ??? ????
-    0x0, 0x8, 0x2c, 0x2d, 0x4b, 0xe6,
-    // ?????? ??? ???????????? ????? ??? ????
-    0x0, 0x8, 0x14, 0x15, 0x3d, 0x4b, 0xe6,
-    // ?????? ??? ?????????? ????? ??? ????
-    0x0, 0x8, 0x37, 0x38, 0x3d, 0x4b, 0xe6,
-    // ?????? ??? ?????????? ????? ??? ????
-    0x0, 0x8, 0x20, 0x21, 0x3d, 0x4b, 0xe6,
-    // ?????? ??? ??????????? ????? ??? ????
-    0x0, 0x8, 0x10, 0x11, 0x3d, 0x4b, 0xe6,
-    // ?????? ??? ?????? ????? ??? ????
-    0x0, 0x8, 0x39, 0x3d, 0x4b, 0xe6,
-    // ?????? ??? ?????? ????? ??? ????
-    0x0, 0x8, 0x3c, 0x3d, 0x4b, 0xe6,
-    // ?????? ??? ?????? ????? ??? ????
-    0x0, 0x8, 0x3b, 0x3d, 0x4b, 0xe6,
-    // ?????? ??? ???? ????? ??? ????
-    0x0, 0x8, 0x35, 0x3d, 0x4b, 0xe6,
-    // ?????? ??? ????? ????? ??? ????
-    0x0, 0x8, 0x29, 0x3d, 0x4b, 0xe6,
-    // ?????? ??? ???? ????? ??? ????
-    0x0, 0x8, 0x34, 0x3d, 0x4b, 0xe6,
-    // ?????? ??? ??????? ????? ??? ????
-    0x0, 0x8, 0x33, 0x3d, 0x4b, 0xe6,
-    // ?????? ??? ???? ????? ??? ????
-    0x0, 0x8, 0x1e, 0x3d, 0x4b, 0xe6,
-    // ?????? ??? ???? ????? ??? ????
-    0x0, 0x8, 0x36, 0x3d, 0x4b, 0xe6,
-    // ?????? ??? ????? ?????? ??? ????
-    0x0, 0x8, 0x24, 0x32, 0x4b, 0xe6,
-    // ?????? ????? ???? ??? ????
-    0x0, 0x3, 0x2e, 0x4b, 0xe6,
-    // ?????? ???? ?????? ??????? ????
-    0x0, 0x18, 0x3a, 0x64, 0xe6,
-    // ?????? ??? ?????? ??????? ????
-    0x0, 0x16, 0x32, 0x64, 0xe6,
-    // ?????? ??? ?????? ??????? ????
-    0x0, 0x48, 0x4a, 0x64, 0xe6,
-    // ?????? ?????? ?????? ??????? ????
-    0x0, 0x46, 0x4a, 0x64, 0xe6,
-    // ?????? ???? ????? ??????? ????
-    0x0, 0x4c, 0x50, 0x64, 0xe6,
-    // ?????? ????? ????? ??????? ????
-    0x0, 0x47, 0x50, 0x64, 0xe6,
-    // ?????? ???? ????? ??????? ????
-    0x0, 0x4d, 0x50, 0x64, 0xe6,
-    // ?????? ?????? ????? ??????? ????
-    0x0, 0x45, 0x50, 0x64, 0xe6,
-    // ?????? ?????? ????? ??????? ????
-    0x0, 0x44, 0x50, 0x64, 0xe6,
-    // ?????? ?????? ????? ??????? ????
-    0x0, 0x43, 0x50, 0x64, 0xe6,
-    // ?????? ??????????? ????? ??????? ????
-    0x0, 0x41, 0x42, 0x50, 0x64, 0xe6,
-    // ?????? ?????????? ????? ??????? ????
-    0x0, 0x3e, 0x40, 0x50, 0x64, 0xe6,
-    // ?????? ?????????? ????? ??????? ????
-    0x0, 0x30, 0x31, 0x3d, 0x64, 0xe6,
-    // ?????? ???????????? ????? ??????? ????
-    0x0, 0xd, 0xe, 0x3d, 0x64, 0xe6,
-    // ?????? ???????? ??????? ????
-    0x0, 0x25, 0x26, 0x64, 0xe6,
-    // ?????? ??????????? ????? ??????? ????
-    0x0, 0x1, 0x2, 0x3d, 0x64, 0xe6,
-    // ?????? ?????????? ????? ??????? ????
-    0x0, 0x27, 0x28, 0x3d, 0x64, 0xe6,
-    // ?????? ???????????? ????? ??????? ????
-    0x0, 0x6, 0x7, 0x3d, 0x64, 0xe6,
-    // ?????? ???????????? ????? ??????? ????
-    0x0, 0xb, 0xc, 0x3d, 0x64, 0xe6,
-    // ?????? ???????? ????? ??????? ????
-    0x0, 0x4, 0x5, 0x3d, 0x64, 0xe6,
-    // ?????? ???????? ???? ?????? ??????? ????
-    0x0, 0x4, 0x5, 0x18, 0x3a, 0x64, 0xe6,
-    // ?????? ???????? ??? ?????? ??????? ????
-    0x0, 0x4, 0x5, 0x16, 0x32, 0x64, 0xe6,
-    // ?????? ???????? ??? ?????? ??????? ????
-    0x0, 0x4, 0x5, 0x48, 0x4a, 0x64, 0xe6,
-    // ?????? ???????? ?????? ?????? ??????? ????
-    0x0, 0x4, 0x5, 0x46, 0x4a, 0x64, 0xe6,
-    // ?????? ???????? ???? ????? ??????? ????
-    0x0, 0x4, 0x5, 0x4c, 0x50, 0x64, 0xe6,
-    // ?????? ???????? ????? ????? ??????? ????
-    0x0, 0x4, 0x5, 0x47, 0x50, 0x64, 0xe6,
-    // ?????? ???????? ???? ????? ??????? ????
-    0x0, 0x4, 0x5, 0x4d, 0x50, 0x64, 0xe6,
-    // ?????? ???????? ?????? ????? ??????? ????
-    0x0, 0x4, 0x5, 0x45, 0x50, 0x64, 0xe6,
-    // ?????? ???????? ?????? ????? ??????? ????
-    0x0, 0x4, 0x5, 0x44, 0x50, 0x64, 0xe6,
-    // ?????? ???????? ??????? ????
-    0x0, 0x22, 0x23, 0x64, 0xe6,
-    // ?????? ??? ???????? ?????? ????? ??? ????
-    0x0, 0x8, 0x12, 0x13, 0x3c, 0x3d, 0x49, 0xe6,
-    // ?????? ??? ???????? ?????? ????? ??? ????
-    0x0, 0x8, 0x12, 0x13, 0x3b, 0x3d, 0x49, 0xe6,
-    // ?????? ??? ???????? ???? ????? ??? ????
-    0x0, 0x8, 0x12, 0x13, 0x35, 0x3d, 0x49, 0xe6,
-    // ?????? ??? ???????? ????? ????? ??? ????
-    0x0, 0x8, 0x12, 0x13, 0x29, 0x3d, 0x49, 0xe6,
-    // ?????? ??? ???????? ???? ????? ??? ????
-    0x0, 0x8, 0x12, 0x13, 0x34, 0x3d, 0x49, 0xe6,
-    // ?????? ??? ???????? ??????? ????? ??? ????
-    0x0, 0x8, 0x12, 0x13, 0x33, 0x3d, 0x49, 0xe6,
-    // ?????? ??? ???????? ???? ????? ??? ????
-    0x0, 0x8, 0x12, 0x13, 0x1e, 0x3d, 0x49, 0xe6,
-    // ?????? ??? ???????? ???? ????? ??? ????
-    0x0, 0x8, 0x12, 0x13, 0x36, 0x3d, 0x49, 0xe6,
-    // ?????? ??? ???????? ????? ?????? ??? ????
-    0x0, 0x8, 0x12, 0x13, 0x24, 0x32, 0x49, 0xe6,
-    // ?????? ??? ???????? ????? ??? ????
-    0x0, 0x8, 0x12, 0x13, 0x3d, 0x49, 0xe6,
-    // ?????? ??? ???????????? ????? ??? ????
-    0x0, 0x8, 0x19, 0x1a, 0x3d, 0x49, 0xe6,
-    // ?????? ??? ???????????? ????? ??? ????
-    0x0, 0x8, 0x1b, 0x1c, 0x3d, 0x49, 0xe6,
-    // ?????? ??? ?????????? ????? ??? ????
-    0x0, 0x8, 0x2a, 0x2b, 0x3d, 0x49, 0xe6,
-    // ?????? ??? ??????????? ????? ??? ????
-    0x0, 0x8, 0x9, 0xa, 0x3d, 0x49, 0xe6,
-    // ?????? ??? ???????? ??? ????
-    0x0, 0x8, 0x2c, 0x2d, 0x49, 0xe6,
-    // ?????? ??? ???????????? ????? ??? ????
-    0x0, 0x8, 0x14, 0x15, 0x3d, 0x49, 0xe6,
-    // ?????? ??? ?????????? ????? ??? ????
-    0x0, 0x8, 0x37, 0x38, 0x3d, 0x49, 0xe6,
-    // ?????? ??? ?????????? ????? ??? ????
-    0x0, 0x8, 0x20, 0x21, 0x3d, 0x49, 0xe6,
-    // ?????? ??? ??????????? ????? ??? ????
-    0x0, 0x8, 0x10, 0x11, 0x3d, 0x49, 0xe6,
-    // ?????? ??? ?????? ????? ??? ????
-    0x0, 0x8, 0x39, 0x3d, 0x49, 0xe6,
-    // ?????? ??? ?????? ????? ??? ????
-    0x0, 0x8, 0x3c, 0x3d, 0x49, 0xe6,
-    // ?????? ??? ?????? ????? ??? ????
-    0x0, 0x8, 0x3b, 0x3d, 0x49, 0xe6,
-    // ?????? ??? ???? ????? ??? ????
-    0x0, 0x8, 0x35, 0x3d, 0x49, 0xe6,
-    // ?????? ??? ????? ????? ??? ????
-    0x0, 0x8, 0x29, 0x3d, 0x49, 0xe6,
-    // ?????? ??? ???? ????? ??? ????
-    0x0, 0x8, 0x34, 0x3d, 0x49, 0xe6,
-    // ?????? ??? ??????? ????? ??? ????
-    0x0, 0x8, 0x33, 0x3d, 0x49, 0xe6,
-    // ?????? ??? ???? ????? ??? ????
-    0x0, 0x8, 0x1e, 0x3d, 0x49, 0xe6,
-    // ?????? ??? ???? ????? ??? ????
-    0x0, 0x8, 0x36, 0x3d, 0x49, 0xe6,
-    // ?????? ??? ????? ?????? ??? ????
-    0x0, 0x8, 0x24, 0x32, 0x49, 0xe6,
-    // ?????? ????? ??? ???? ????
-    0x0, 0x3, 0x49, 0x4e, 0xe6,
-    // ?????? ???? ?????? ???????? ????
-    0x0, 0x18, 0x3a, 0x59, 0x5a, 0xe6,
-    // ?????? ??? ?????? ???????? ????
-    0x0, 0x16, 0x32, 0x59, 0x5a, 0xe6,
-    // ?????? ??? ?????? ???????? ????
-    0x0, 0x48, 0x4a, 0x59, 0x5a, 0xe6,
-    // ?????? ?????? ?????? ???????? ????
-    0x0, 0x46, 0x4a, 0x59, 0x5a, 0xe6,
-    // ?????? ???? ????? ???????? ????
-    0x0, 0x4c, 0x50, 0x59, 0x5a, 0xe6,
-    // ?????? ????? ????? ???????? ????
-    0x0, 0x47, 0x50, 0x59, 0x5a, 0xe6,
-    // ?????? ???? ????? ???????? ????
-    0x0, 0x4d, 0x50, 0x59, 0x5a, 0xe6,
-    // ?????? ?????? ????? ???????? ????
-    0x0, 0x45, 0x50, 0x59, 0x5a, 0xe6,
-    // ?????? ?????? ????? ???????? ????
-    0x0, 0x44, 0x50, 0x59, 0x5a, 0xe6,
-    // ?????? ?????? ????? ???????? ????
-    0x0, 0x43, 0x50, 0x59, 0x5a, 0xe6,
-    // ?????? ??????????? ????? ???????? ????
-    0x0, 0x41, 0x42, 0x50, 0x59, 0x5a, 0xe6,
-    // ?????? ?????????? ????? ???????? ????
-    0x0, 0x3e, 0x40, 0x50, 0x59, 0x5a, 0xe6,
-    // ?????? ?????????? ????? ???????? ????
-    0x0, 0x30, 0x31, 0x3d, 0x59, 0x5a, 0xe6,
-    // ?????? ???????????? ????? ???????? ????
-    0x0, 0xd, 0xe, 0x3d, 0x59, 0x5a, 0xe6,
-    // ?????? ???????? ???????? ????
-    0x0, 0x25, 0x26, 0x59, 0x5a, 0xe6,
-    // ?????? ??????????? ????? ???????? ????
-    0x0, 0x1, 0x2, 0x3d, 0x59, 0x5a, 0xe6,
-    // ?????? ?????????? ????? ???????? ????
-    0x0, 0x27, 0x28, 0x3d, 0x59, 0x5a, 0xe6,
-    // ?????? ???????????? ????? ???????? ????
-    0x0, 0x6, 0x7, 0x3d, 0x59, 0x5a, 0xe6,
-    // ?????? ???????????? ????? ???????? ????
-    0x0, 0xb, 0xc, 0x3d, 0x59, 0x5a, 0xe6,
-    // ?????? ???????? ????? ???????? ????
-    0x0, 0x4, 0x5, 0x3d, 0x59, 0x5a, 0xe6,
-    // ?????? ???????? ???? ?????? ???????? ????
-    0x0, 0x4, 0x5, 0x18, 0x3a, 0x59, 0x5a, 0xe6,
-    // ?????? ???????? ??? ?????? ???????? ????
-    0x0, 0x4, 0x5, 0x16, 0x32, 0x59, 0x5a, 0xe6,
-    // ?????? ???????? ??? ?????? ???????? ????
-    0x0, 0x4, 0x5, 0x48, 0x4a, 0x59, 0x5a, 0xe6,
-    // ?????? ???????? ?????? ?????? ???????? ????
-    0x0, 0x4, 0x5, 0x46, 0x4a, 0x59, 0x5a, 0xe6,
-    // ?????? ???????? ???? ????? ???????? ????
-    0x0, 0x4, 0x5, 0x4c, 0x50, 0x59, 0x5a, 0xe6,
-    // ?????? ???????? ????? ????? ???????? ????
-    0x0, 0x4, 0x5, 0x47, 0x50, 0x59, 0x5a, 0xe6,
-    // ?????? ???????? ???? ????? ???????? ????
-    0x0, 0x4, 0x5, 0x4d, 0x50, 0x59, 0x5a, 0xe6,
-    // ?????? ???????? ?????? ????? ???????? ????
-    0x0, 0x4, 0x5, 0x45, 0x50, 0x59, 0x5a, 0xe6,
-    // ?????? ???????? ?????? ????? ???????? ????
-    0x0, 0x4, 0x5, 0x44, 0x50, 0x59, 0x5a, 0xe6,
-    // ?????? ???????? ???????? ????
-    0x0, 0x22, 0x23, 0x59, 0x5a, 0xe6,
-    // ?????? ??? ???????? ?????? ????? ??? ???? ????
-    0x0, 0x8, 0x12, 0x13, 0x3c, 0x3d, 0x48, 0x4e, 0xe6,
-    // ?????? ??? ???????? ?????? ????? ??? ???? ????
-    0x0, 0x8, 0x12, 0x13, 0x3b, 0x3d, 0x48, 0x4e, 0xe6,
-    // ?????? ??? ???????? ???? ????? ??? ???? ????
-    0x0, 0x8, 0x12, 0x13, 0x35, 0x3d, 0x48, 0x4e, 0xe6,
-    // ?????? ??? ???????? ????? ????? ??? ???? ????
-    0x0, 0x8, 0x12, 0x13, 0x29, 0x3d, 0x48, 0x4e, 0xe6,
-    // ?????? ??? ???????? ???? ????? ??? ???? ????
-    0x0, 0x8, 0x12, 0x13, 0x34, 0x3d, 0x48, 0x4e, 0xe6,
-    // ?????? ??? ???????? ??????? ????? ??? ???? ????
-    0x0, 0x8, 0x12, 0x13, 0x33, 0x3d, 0x48, 0x4e, 0xe6,
-    // ?????? ??? ???????? ???? ????? ??? ???? ????
-    0x0, 0x8, 0x12, 0x13, 0x1e, 0x3d, 0x48, 0x4e, 0xe6,
-    // ?????? ??? ???????? ???? ????? ??? ???? ????
-    0x0, 0x8, 0x12, 0x13, 0x36, 0x3d, 0x48, 0x4e, 0xe6,
-    // ?????? ??? ???????? ????? ?????? ??? ???? ????
-    0x0, 0x8, 0x12, 0x13, 0x24, 0x32, 0x48, 0x4e, 0xe6,
-    // ?????? ??? ???????? ????? ??? ???? ????
-    0x0, 0x8, 0x12, 0x13, 0x3d, 0x48, 0x4e, 0xe6,
-    // ?????? ??? ???????????? ????? ??? ???? ????
-    0x0, 0x8, 0x19, 0x1a, 0x3d, 0x48, 0x4e, 0xe6,
-    // ?????? ??? ???????????? ????? ??? ???? ????
-    0x0, 0x8, 0x1b, 0x1c, 0x3d, 0x48, 0x4e, 0xe6,
-    // ?????? ??? ?????????? ????? ??? ???? ????
-    0x0, 0x8, 0x2a, 0x2b, 0x3d, 0x48, 0x4e, 0xe6,
-    // ?????? ??? ??????????? ????? ??? ???? ????
-    0x0, 0x8, 0x9, 0xa, 0x3d, 0x48, 0x4e, 0xe6,
-    // ?????? ??? ???????? ??? ???? ????
-    0x0, 0x8, 0x2c, 0x2d, 0x48, 0x4e, 0xe6,
-    // ?????? ??? ???????????? ????? ??? ???? ????
-    0x0, 0x8, 0x14, 0x15, 0x3d, 0x48, 0x4e, 0xe6,
-    // ?????? ??? ?????????? ????? ??? ???? ????
-    0x0, 0x8, 0x37, 0x38, 0x3d, 0x48, 0x4e, 0xe6,
-    // ?????? ??? ?????????? ????? ??? ???? ????
-    0x0, 0x8, 0x20, 0x21, 0x3d, 0x48, 0x4e, 0xe6,
-    // ?????? ??? ??????????? ????? ??? ???? ????
-    0x0, 0x8, 0x10, 0x11, 0x3d, 0x48, 0x4e, 0xe6,
-    // ?????? ??? ?????? ????? ??? ???? ????
-    0x0, 0x8, 0x39, 0x3d, 0x48, 0x4e, 0xe6,
-    // ?????? ??? ?????? ????? ??? ???? ????
-    0x0, 0x8, 0x3c, 0x3d, 0x48, 0x4e, 0xe6,
-    // ?????? ??? ?????? ????? ??? ???? ????
-    0x0, 0x8, 0x3b, 0x3d, 0x48, 0x4e, 0xe6,
-    // ?????? ??? ???? ????? ??? ???? ????
-    0x0, 0x8, 0x35, 0x3d, 0x48, 0x4e, 0xe6,
-    // ?????? ??? ????? ????? ??? ???? ????
-    0x0, 0x8, 0x29, 0x3d, 0x48, 0x4e, 0xe6,
-    // ?????? ??? ???? ????? ??? ???? ????
-    0x0, 0x8, 0x34, 0x3d, 0x48, 0x4e, 0xe6,
-    // ?????? ??? ??????? ????? ??? ???? ????
-    0x0, 0x8, 0x33, 0x3d, 0x48, 0x4e, 0xe6,
-    // ?????? ??? ???? ????? ??? ???? ????
-    0x0, 0x8, 0x1e, 0x3d, 0x48, 0x4e, 0xe6,
-    // ?????? ??? ???? ????? ??? ???? ????
-    0x0, 0x8, 0x36, 0x3d, 0x48, 0x4e, 0xe6,
-    // ?????? ??? ????? ?????? ??? ???? ????
-    0x0, 0x8, 0x24, 0x32, 0x48, 0x4e, 0xe6,
-    // ?????? ????? ??? ???? ????
-    0x0, 0x3, 0x48, 0x4e, 0xe6,
-    // ?????? ???? ?????? ?????????? ????
-    0x0, 0x18, 0x3a, 0x56, 0x57, 0xe9,
-    // ?????? ??? ?????? ?????????? ????
-    0x0, 0x16, 0x32, 0x56, 0x57, 0xe9,
-    // ?????? ??? ?????? ?????????? ????
-    0x0, 0x48, 0x4a, 0x56, 0x57, 0xe9,
-    // ?????? ?????? ?????? ?????????? ????
-    0x0, 0x46, 0x4a, 0x56, 0x57, 0xe9,
-    // ?????? ???? ????? ?????????? ????
-    0x0, 0x4c, 0x50, 0x56, 0x57, 0xe9,
-    // ?????? ????? ????? ?????????? ????
-    0x0, 0x47, 0x50, 0x56, 0x57, 0xe9,
-    // ?????? ???? ????? ?????????? ????
-    0x0, 0x4d, 0x50, 0x56, 0x57, 0xe9,
-    // ?????? ?????? ????? ?????????? ????
-    0x0, 0x45, 0x50, 0x56, 0x57, 0xe9,
-    // ?????? ?????? ????? ?????????? ????
-    0x0, 0x44, 0x50, 0x56, 0x57, 0xe9,
-    // ?????? ?????? ????? ?????????? ????
-    0x0, 0x43, 0x50, 0x56, 0x57, 0xe9,
-    // ?????? ??????????? ????? ?????????? ????
-    0x0, 0x41, 0x42, 0x50, 0x56, 0x57, 0xe9,
-    // ?????? ?????????? ????? ?????????? ????
-    0x0, 0x3e, 0x40, 0x50, 0x56, 0x57, 0xe9,
-    // ?????? ?????????? ????? ?????????? ????
-    0x0, 0x30, 0x31, 0x3d, 0x56, 0x57, 0xe9,
-    // ?????? ???????????? ????? ?????????? ????
-    0x0, 0xd, 0xe, 0x3d, 0x56, 0x57, 0xe9,
-    // ?????? ???????? ?????????? ????
-    0x0, 0x25, 0x26, 0x56, 0x57, 0xe9,
-    // ?????? ??????????? ????? ?????????? ????
-    0x0, 0x1, 0x2, 0x3d, 0x56, 0x57, 0xe9,
-    // ?????? ?????????? ????? ?????????? ????
-    0x0, 0x27, 0x28, 0x3d, 0x56, 0x57, 0xe9,
-    // ?????? ???????????? ????? ?????????? ????
-    0x0, 0x6, 0x7, 0x3d, 0x56, 0x57, 0xe9,
-    // ?????? ???????????? ????? ?????????? ????
-    0x0, 0xb, 0xc, 0x3d, 0x56, 0x57, 0xe9,
-    // ?????? ???????? ????? ?????????? ????
-    0x0, 0x4, 0x5, 0x3d, 0x56, 0x57, 0xe9,
-    // ?????? ???????? ???? ?????? ?????????? ????
-    0x0, 0x4, 0x5, 0x18, 0x3a, 0x56, 0x57, 0xe9,
-    // ?????? ???????? ??? ?????? ?????????? ????
-    0x0, 0x4, 0x5, 0x16, 0x32, 0x56, 0x57, 0xe9,
-    // ?????? ???????? ??? ?????? ?????????? ????
-    0x0, 0x4, 0x5, 0x48, 0x4a, 0x56, 0x57, 0xe9,
-    // ?????? ???????? ?????? ?????? ?????????? ????
-    0x0, 0x4, 0x5, 0x46, 0x4a, 0x56, 0x57, 0xe9,
-    // ?????? ???????? ???? ????? ?????????? ????
-    0x0, 0x4, 0x5, 0x4c, 0x50, 0x56, 0x57, 0xe9,
-    // ?????? ???????? ????? ????? ?????????? ????
-    0x0, 0x4, 0x5, 0x47, 0x50, 0x56, 0x57, 0xe9,
-    // ?????? ???????? ???? ????? ?????????? ????
-    0x0, 0x4, 0x5, 0x4d, 0x50, 0x56, 0x57, 0xe9,
-    // ?????? ???????? ?????? ????? ?????????? ????
-    0x0, 0x4, 0x5, 0x45, 0x50, 0x56, 0x57, 0xe9,
-    // ?????? ???????? ?????? ????? ?????????? ????
-    0x0, 0x4, 0x5, 0x44, 0x50, 0x56, 0x57, 0xe9,
-    // ?????? ???????? ?????????? ????
-    0x0, 0x22, 0x23, 0x56, 0x57, 0xe9,
-    // ?????? ??? ???????? ?????? ????? ?????? ????
-    0x0, 0x8, 0x12, 0x13, 0x3c, 0x3d, 0x46, 0xe9,
-    // ?????? ??? ???????? ?????? ????? ?????? ????
-    0x0, 0x8, 0x12, 0x13, 0x3b, 0x3d, 0x46, 0xe9,
-    // ?????? ??? ???????? ???? ????? ?????? ????
-    0x0, 0x8, 0x12, 0x13, 0x35, 0x3d, 0x46, 0xe9,
-    // ?????? ??? ???????? ????? ????? ?????? ????
-    0x0, 0x8, 0x12, 0x13, 0x29, 0x3d, 0x46, 0xe9,
-    // ?????? ??? ???????? ???? ????? ?????? ????
-    0x0, 0x8, 0x12, 0x13, 0x34, 0x3d, 0x46, 0xe9,
-    // ?????? ??? ???????? ??????? ????? ?????? ????
-    0x0, 0x8, 0x12, 0x13, 0x33, 0x3d, 0x46, 0xe9,
-    // ?????? ??? ???????? ???? ????? ?????? ????
-    0x0, 0x8, 0x12, 0x13, 0x1e, 0x3d, 0x46, 0xe9,
-    // ?????? ??? ???????? ???? ????? ?????? ????
-    0x0, 0x8, 0x12, 0x13, 0x36, 0x3d, 0x46, 0xe9,
-    // ?????? ??? ???????? ????? ?????? ?????? ????
-    0x0, 0x8, 0x12, 0x13, 0x24, 0x32, 0x46, 0xe9,
-    // ?????? ??? ???????? ????? ?????? ????
-    0x0, 0x8, 0x12, 0x13, 0x3d, 0x46, 0xe9,
-    // ?????? ??? ???????????? ????? ?????? ????
-    0x0, 0x8, 0x19, 0x1a, 0x3d, 0x46, 0xe9,
-    // ?????? ??? ???????????? ????? ?????? ????
-    0x0, 0x8, 0x1b, 0x1c, 0x3d, 0x46, 0xe9,
-    // ?????? ??? ?????????? ????? ?????? ????
-    0x0, 0x8, 0x2a, 0x2b, 0x3d, 0x46, 0xe9,
-    // ?????? ??? ??????????? ????? ?????? ????
-    0x0, 0x8, 0x9, 0xa, 0x3d, 0x46, 0xe9,
-    // ?????? ??? ???????? ?????? ????
-    0x0, 0x8, 0x2c, 0x2d, 0x46, 0xe9,
-    // ?????? ??? ???????????? ????? ?????? ????
-    0x0, 0x8, 0x14, 0x15, 0x3d, 0x46, 0xe9,
-    // ?????? ??? ?????????? ????? ?????? ????
-    0x0, 0x8, 0x37, 0x38, 0x3d, 0x46, 0xe9,
-    // ?????? ??? ?????????? ????? ?????? ????
-    0x0, 0x8, 0x20, 0x21, 0x3d, 0x46, 0xe9,
-    // ?????? ??? ??????????? ????? ?????? ????
-    0x0, 0x8, 0x10, 0x11, 0x3d, 0x46, 0xe9,
-    // ?????? ??? ?????? ????? ?????? ????
-    0x0, 0x8, 0x39, 0x3d, 0x46, 0xe9,
-    // ?????? ??? ?????? ????? ?????? ????
-    0x0, 0x8, 0x3c, 0x3d, 0x46, 0xe9,
-    // ?????? ??? ?????? ????? ?????? ????
-    0x0, 0x8, 0x3b, 0x3d, 0x46, 0xe9,
-    // ?????? ??? ???? ????? ?????? ????
-    0x0, 0x8, 0x35, 0x3d, 0x46, 0xe9,
-    // ?????? ??? ????? ????? ?????? ????
-    0x0, 0x8, 0x29, 0x3d, 0x46, 0xe9,
-    // ?????? ??? ???? ????? ?????? ????
-    0x0, 0x8, 0x34, 0x3d, 0x46, 0xe9,
-    // ?????? ??? ??????? ????? ?????? ????
-    0x0, 0x8, 0x33, 0x3d, 0x46, 0xe9,
-    // ?????? ??? ???? ????? ?????? ????
-    0x0, 0x8, 0x1e, 0x3d, 0x46, 0xe9,
-    // ?????? ??? ???? ????? ?????? ????
-    0x0, 0x8, 0x36, 0x3d, 0x46, 0xe9,
-    // ?????? ??? ????? ?????? ?????? ????
-    0x0, 0x8, 0x24, 0x32, 0x46, 0xe9,
-    // ?????? ????? ?????? ???? ????
-    0x0, 0x3, 0x46, 0x4e, 0xe9,
-    // ?????? ???? ?????? ?????? ????
-    0x0, 0x18, 0x3a, 0x63, 0xe9,
-    // ?????? ??? ?????? ?????? ????
-    0x0, 0x16, 0x32, 0x63, 0xe9,
-    // ?????? ??? ?????? ?????? ????
-    0x0, 0x48, 0x4a, 0x63, 0xe9,
-    // ?????? ?????? ?????? ?????? ????
-    0x0, 0x46, 0x4a, 0x63, 0xe9,
-    // ?????? ???? ????? ?????? ????
-    0x0, 0x4c, 0x50, 0x63, 0xe9,
-    // ?????? ????? ????? ?????? ????
-    0x0, 0x47, 0x50, 0x63, 0xe9,
-    // ?????? ???? ????? ?????? ????
-    0x0, 0x4d, 0x50, 0x63, 0xe9,
-    // ?????? ?????? ????? ?????? ????
-    0x0, 0x45, 0x50, 0x63, 0xe9,
-    // ?????? ?????? ????? ?????? ????
-    0x0, 0x44, 0x50, 0x63, 0xe9,
-    // ?????? ?????? ????? ?????? ????
-    0x0, 0x43, 0x50, 0x63, 0xe9,
-    // ?????? ??????????? ????? ?????? ????
-    0x0, 0x41, 0x42, 0x50, 0x63, 0xe9,
-    // ?????? ?????????? ????? ?????? ????
-    0x0, 0x3e, 0x40, 0x50, 0x63, 0xe9,
-    // ?????? ?????????? ????? ?????? ????
-    0x0, 0x30, 0x31, 0x3d, 0x63, 0xe9,
-    // ?????? ???????????? ????? ?????? ????
-    0x0, 0xd, 0xe, 0x3d, 0x63, 0xe9,
-    // ?????? ???????? ?????? ????
-    0x0, 0x25, 0x26, 0x63, 0xe9,
-    // ?????? ??????????? ????? ?????? ????
-    0x0, 0x1, 0x2, 0x3d, 0x63, 0xe9,
-    // ?????? ?????????? ????? ?????? ????
-    0x0, 0x27, 0x28, 0x3d, 0x63, 0xe9,
-    // ?????? ???????????? ????? ?????? ????
-    0x0, 0x6, 0x7, 0x3d, 0x63, 0xe9,
-    // ?????? ???????????? ????? ?????? ????
-    0x0, 0xb, 0xc, 0x3d, 0x63, 0xe9,
-    // ?????? ???????? ????? ?????? ????
-    0x0, 0x4, 0x5, 0x3d, 0x63, 0xe9,
-    // ?????? ???????? ???? ?????? ?????? ????
-    0x0, 0x4, 0x5, 0x18, 0x3a, 0x63, 0xe9,
-    // ?????? ???????? ??? ?????? ?????? ????
-    0x0, 0x4, 0x5, 0x16, 0x32, 0x63, 0xe9,
-    // ?????? ???????? ??? ?????? ?????? ????
-    0x0, 0x4, 0x5, 0x48, 0x4a, 0x63, 0xe9,
-    // ?????? ???????? ?????? ?????? ?????? ????
-    0x0, 0x4, 0x5, 0x46, 0x4a, 0x63, 0xe9,
-    // ?????? ???????? ???? ????? ?????? ????
-    0x0, 0x4, 0x5, 0x4c, 0x50, 0x63, 0xe9,
-    // ?????? ???????? ????? ????? ?????? ????
-    0x0, 0x4, 0x5, 0x47, 0x50, 0x63, 0xe9,
-    // ?????? ???????? ???? ????? ?????? ????
-    0x0, 0x4, 0x5, 0x4d, 0x50, 0x63, 0xe9,
-    // ?????? ???????? ?????? ????? ?????? ????
-    0x0, 0x4, 0x5, 0x45, 0x50, 0x63, 0xe9,
-    // ?????? ???????? ?????? ????? ?????? ????
-    0x0, 0x4, 0x5, 0x44, 0x50, 0x63, 0xe9,
-    // ?????? ???????? ?????? ????
-    0x0, 0x22, 0x23, 0x63, 0xe9,
-    // ?????? ??? ???????? ?????? ????? ???? ????
-    0x0, 0x8, 0x12, 0x13, 0x3c, 0x3d, 0x4c, 0xe9,
-    // ?????? ??? ???????? ?????? ????? ???? ????
-    0x0, 0x8, 0x12, 0x13, 0x3b, 0x3d, 0x4c, 0xe9,
-    // ?????? ??? ???????? ???? ????? ???? ????
-    0x0, 0x8, 0x12, 0x13, 0x35, 0x3d, 0x4c, 0xe9,
-    // ?????? ??? ???????? ????? ????? ???? ????
-    0x0, 0x8, 0x12, 0x13, 0x29, 0x3d, 0x4c, 0xe9,
-    // ?????? ??? ???????? ???? ????? ???? ????
-    0x0, 0x8, 0x12, 0x13, 0x34, 0x3d, 0x4c, 0xe9,
-    // ?????? ??? ???????? ??????? ????? ???? ????
-    0x0, 0x8, 0x12, 0x13, 0x33, 0x3d, 0x4c, 0xe9,
-    // ?????? ??? ???????? ???? ????? ???? ????
-    0x0, 0x8, 0x12, 0x13, 0x1e, 0x3d, 0x4c, 0xe9,
-    // ?????? ??? ???????? ???? ????? ???? ????
-    0x0, 0x8, 0x12, 0x13, 0x36, 0x3d, 0x4c, 0xe9,
-    // ?????? ??? ???????? ????? ?????? ???? ????
-    0x0, 0x8, 0x12, 0x13, 0x24, 0x32, 0x4c, 0xe9,
-    // ?????? ??? ???????? ????? ???? ????
-    0x0, 0x8, 0x12, 0x13, 0x3d, 0x4c, 0xe9,
-    // ?????? ??? ???????????? ????? ???? ????
-    0x0, 0x8, 0x19, 0x1a, 0x3d, 0x4c, 0xe9,
-    // ?????? ??? ???????????? ????? ???? ????
-    0x0, 0x8, 0x1b, 0x1c, 0x3d, 0x4c, 0xe9,
-    // ?????? ??? ?????????? ????? ???? ????
-    0x0, 0x8, 0x2a, 0x2b, 0x3d, 0x4c, 0xe9,
-    // ?????? ??? ??????????? ????? ???? ????
-    0x0, 0x8, 0x9, 0xa, 0x3d, 0x4c, 0xe9,
-    // ?????? ??? ???????? ???? ????
-    0x0, 0x8, 0x2c, 0x2d, 0x4c, 0xe9,
-    // ?????? ??? ???????????? ????? ???? ????
-    0x0, 0x8, 0x14, 0x15, 0x3d, 0x4c, 0xe9,
-    // ?????? ??? ?????????? ????? ???? ????
-    0x0, 0x8, 0x37, 0x38, 0x3d, 0x4c, 0xe9,
-    // ?????? ??? ?????????? ????? ???? ????
-    0x0, 0x8, 0x20, 0x21, 0x3d, 0x4c, 0xe9,
-    // ?????? ??? ??????????? ????? ???? ????
-    0x0, 0x8, 0x10, 0x11, 0x3d, 0x4c, 0xe9,
-    // ?????? ??? ?????? ????? ???? ????
-    0x0, 0x8, 0x39, 0x3d, 0x4c, 0xe9,
-    // ?????? ??? ?????? ????? ???? ????
-    0x0, 0x8, 0x3c, 0x3d, 0x4c, 0xe9,
-    // ?????? ??? ?????? ????? ???? ????
-    0x0, 0x8, 0x3b, 0x3d, 0x4c, 0xe9,
-    // ?????? ??? ???? ????? ???? ????
-    0x0, 0x8, 0x35, 0x3d, 0x4c, 0xe9,
-    // ?????? ??? ????? ????? ???? ????
-    0x0, 0x8, 0x29, 0x3d, 0x4c, 0xe9,
-    // ?????? ??? ???? ????? ???? ????
-    0x0, 0x8, 0x34, 0x3d, 0x4c, 0xe9,
-    // ?????? ??? ??????? ????? ???? ????
-    0x0, 0x8, 0x33, 0x3d, 0x4c, 0xe9,
-    // ?????? ??? ???? ????? ???? ????
-    0x0, 0x8, 0x1e, 0x3d, 0x4c, 0xe9,
-    // ?????? ??? ???? ????? ???? ????
-    0x0, 0x8, 0x36, 0x3d, 0x4c, 0xe9,
-    // ?????? ??? ????? ?????? ???? ????
-    0x0, 0x8, 0x24, 0x32, 0x4c, 0xe9,
-    // ?????? ????? ???? ????? ????
-    0x0, 0x3, 0x4c, 0x51, 0xe9,
-    // ?????? ???? ?????? ??????? ????
-    0x0, 0x18, 0x3a, 0x58, 0xe9,
-    // ?????? ??? ?????? ??????? ????
-    0x0, 0x16, 0x32, 0x58, 0xe9,
-    // ?????? ??? ?????? ??????? ????
-    0x0, 0x48, 0x4a, 0x58, 0xe9,
-    // ?????? ?????? ?????? ??????? ????
-    0x0, 0x46, 0x4a, 0x58, 0xe9,
-    // ?????? ???? ????? ??????? ????
-    0x0, 0x4c, 0x50, 0x58, 0xe9,
-    // ?????? ????? ????? ??????? ????
-    0x0, 0x47, 0x50, 0x58, 0xe9,
-    // ?????? ???? ????? ??????? ????
-    0x0, 0x4d, 0x50, 0x58, 0xe9,
-    // ?????? ?????? ????? ??????? ????
-    0x0, 0x45, 0x50, 0x58, 0xe9,
-    // ?????? ?????? ????? ??????? ????
-    0x0, 0x44, 0x50, 0x58, 0xe9,
-    // ?????? ?????? ????? ??????? ????
-    0x0, 0x43, 0x50, 0x58, 0xe9,
-    // ?????? ??????????? ????? ??????? ????
-    0x0, 0x41, 0x42, 0x50, 0x58, 0xe9,
-    // ?????? ?????????? ????? ??????? ????
-    0x0, 0x3e, 0x40, 0x50, 0x58, 0xe9,
-    // ?????? ?????????? ????? ??????? ????
-    0x0, 0x30, 0x31, 0x3d, 0x58, 0xe9,
-    // ?????? ???????????? ????? ??????? ????
-    0x0, 0xd, 0xe, 0x3d, 0x58, 0xe9,
-    // ?????? ???????? ??????? ????
-    0x0, 0x25, 0x26, 0x58, 0xe9,
-    // ?????? ??????????? ????? ??????? ????
-    0x0, 0x1, 0x2, 0x3d, 0x58, 0xe9,
-    // ?????? ?????????? ????? ??????? ????
-    0x0, 0x27, 0x28, 0x3d, 0x58, 0xe9,
-    // ?????? ???????????? ????? ??????? ????
-    0x0, 0x6, 0x7, 0x3d, 0x58, 0xe9,
-    // ?????? ???????????? ????? ??????? ????
-    0x0, 0xb, 0xc, 0x3d, 0x58, 0xe9,
-    // ?????? ???????? ????? ??????? ????
-    0x0, 0x4, 0x5, 0x3d, 0x58, 0xe9,
-    // ?????? ???????? ???? ?????? ??????? ????
-    0x0, 0x4, 0x5, 0x18, 0x3a, 0x58, 0xe9,
-    // ?????? ???????? ??? ?????? ??????? ????
-    0x0, 0x4, 0x5, 0x16, 0x32, 0x58, 0xe9,
-    // ?????? ???????? ??? ?????? ??????? ????
-    0x0, 0x4, 0x5, 0x48, 0x4a, 0x58, 0xe9,
-    // ?????? ???????? ?????? ?????? ??????? ????
-    0x0, 0x4, 0x5, 0x46, 0x4a, 0x58, 0xe9,
-    // ?????? ???????? ???? ????? ??????? ????
-    0x0, 0x4, 0x5, 0x4c, 0x50, 0x58, 0xe9,
-    // ?????? ???????? ????? ????? ??????? ????
-    0x0, 0x4, 0x5, 0x47, 0x50, 0x58, 0xe9,
-    // ?????? ???????? ???? ????? ??????? ????
-    0x0, 0x4, 0x5, 0x4d, 0x50, 0x58, 0xe9,
-    // ?????? ???????? ?????? ????? ??????? ????
-    0x0, 0x4, 0x5, 0x45, 0x50, 0x58, 0xe9,
-    // ?????? ???????? ?????? ????? ??????? ????
-    0x0, 0x4, 0x5, 0x44, 0x50, 0x58, 0xe9,
-    // ?????? ???????? ??????? ????
-    0x0, 0x22, 0x23, 0x58, 0xe9,
-    // ?????? ??? ???????? ?????? ????? ????? ????
-    0x0, 0x8, 0x12, 0x13, 0x3c, 0x3d, 0x47, 0xe9,
-    // ?????? ??? ???????? ?????? ????? ????? ????
-    0x0, 0x8, 0x12, 0x13, 0x3b, 0x3d, 0x47, 0xe9,
-    // ?????? ??? ???????? ???? ????? ????? ????
-    0x0, 0x8, 0x12, 0x13, 0x35, 0x3d, 0x47, 0xe9,
-    // ?????? ??? ???????? ????? ????? ????? ????
-    0x0, 0x8, 0x12, 0x13, 0x29, 0x3d, 0x47, 0xe9,
-    // ?????? ??? ???????? ???? ????? ????? ????
-    0x0, 0x8, 0x12, 0x13, 0x34, 0x3d, 0x47, 0xe9,
-    // ?????? ??? ???????? ??????? ????? ????? ????
-    0x0, 0x8, 0x12, 0x13, 0x33, 0x3d, 0x47, 0xe9,
-    // ?????? ??? ???????? ???? ????? ????? ????
-    0x0, 0x8, 0x12, 0x13, 0x1e, 0x3d, 0x47, 0xe9,
-    // ?????? ??? ???????? ???? ????? ????? ????
-    0x0, 0x8, 0x12, 0x13, 0x36, 0x3d, 0x47, 0xe9,
-    // ?????? ??? ???????? ????? ?????? ????? ????
-    0x0, 0x8, 0x12, 0x13, 0x24, 0x32, 0x47, 0xe9,
-    // ?????? ??? ???????? ????? ????? ????
-    0x0, 0x8, 0x12, 0x13, 0x3d, 0x47, 0xe9,
-    // ?????? ??? ???????????? ????? ????? ????
-    0x0, 0x8, 0x19, 0x1a, 0x3d, 0x47, 0xe9,
-    // ?????? ??? ???????????? ????? ????? ????
-    0x0, 0x8, 0x1b, 0x1c, 0x3d, 0x47, 0xe9,
-    // ?????? ??? ?????????? ????? ????? ????
-    0x0, 0x8, 0x2a, 0x2b, 0x3d, 0x47, 0xe9,
-    // ?????? ??? ??????????? ????? ????? ????
-    0x0, 0x8, 0x9, 0xa, 0x3d, 0x47, 0xe9,
-    // ?????? ??? ???????? ????? ????
-    0x0, 0x8, 0x2c, 0x2d, 0x47, 0xe9,
-    // ?????? ??? ???????????? ????? ????? ????
-    0x0, 0x8, 0x14, 0x15, 0x3d, 0x47, 0xe9,
-    // ?????? ??? ?????????? ????? ????? ????
-    0x0, 0x8, 0x37, 0x38, 0x3d, 0x47, 0xe9,
-    // ?????? ??? ?????????? ????? ????? ????
-    0x0, 0x8, 0x20, 0x21, 0x3d, 0x47, 0xe9,
-    // ?????? ??? ??????????? ????? ????? ????
-    0x0, 0x8, 0x10, 0x11, 0x3d, 0x47, 0xe9,
-    // ?????? ??? ?????? ????? ????? ????
-    0x0, 0x8, 0x39, 0x3d, 0x47, 0xe9,
-    // ?????? ??? ?????? ????? ????? ????
-    0x0, 0x8, 0x3c, 0x3d, 0x47, 0xe9,
-    // ?????? ??? ?????? ????? ????? ????
-    0x0, 0x8, 0x3b, 0x3d, 0x47, 0xe9,
-    // ?????? ??? ???? ????? ????? ????
-    0x0, 0x8, 0x35, 0x3d, 0x47, 0xe9,
-    // ?????? ??? ????? ????? ????? ????
-    0x0, 0x8, 0x29, 0x3d, 0x47, 0xe9,
-    // ?????? ??? ???? ????? ????? ????
-    0x0, 0x8, 0x34, 0x3d, 0x47, 0xe9,
-    // ?????? ??? ??????? ????? ????? ????
-    0x0, 0x8, 0x33, 0x3d, 0x47, 0xe9,
-    // ?????? ??? ???? ????? ????? ????
-    0x0, 0x8, 0x1e, 0x3d, 0x47, 0xe9,
-    // ?????? ??? ???? ????? ????? ????
-    0x0, 0x8, 0x36, 0x3d, 0x47, 0xe9,
-    // ?????? ??? ????? ?????? ????? ????
-    0x0, 0x8, 0x24, 0x32, 0x47, 0xe9,
-    // ?????? ????? ????? ????? ????
-    0x0, 0x3, 0x47, 0x51, 0xe9,
-    // ?????? ???? ?????? ???????? ????
-    0x0, 0x18, 0x3a, 0x5b, 0x5c, 0xe9,
-    // ?????? ??? ?????? ???????? ????
-    0x0, 0x16, 0x32, 0x5b, 0x5c, 0xe9,
-    // ?????? ??? ?????? ???????? ????
-    0x0, 0x48, 0x4a, 0x5b, 0x5c, 0xe9,
-    // ?????? ?????? ?????? ???????? ????
-    0x0, 0x46, 0x4a, 0x5b, 0x5c, 0xe9,
-    // ?????? ???? ????? ???????? ????
-    0x0, 0x4c, 0x50, 0x5b, 0x5c, 0xe9,
-    // ?????? ????? ????? ???????? ????
-    0x0, 0x47, 0x50, 0x5b, 0x5c, 0xe9,
-    // ?????? ???? ????? ???????? ????
-    0x0, 0x4d, 0x50, 0x5b, 0x5c, 0xe9,
-    // ?????? ?????? ????? ???????? ????
-    0x0, 0x45, 0x50, 0x5b, 0x5c, 0xe9,
-    // ?????? ?????? ????? ???????? ????
-    0x0, 0x44, 0x50, 0x5b, 0x5c, 0xe9,
-    // ?????? ?????? ????? ???????? ????
-    0x0, 0x43, 0x50, 0x5b, 0x5c, 0xe9,
-    // ?????? ??????????? ????? ???????? ????
-    0x0, 0x41, 0x42, 0x50, 0x5b, 0x5c, 0xe9,
-    // ?????? ?????????? ????? ???????? ????
-    0x0, 0x3e, 0x40, 0x50, 0x5b, 0x5c, 0xe9,
-    // ?????? ?????????? ????? ???????? ????
-    0x0, 0x30, 0x31, 0x3d, 0x5b, 0x5c, 0xe9,
-    // ?????? ???????????? ????? ???????? ????
-    0x0, 0xd, 0xe, 0x3d, 0x5b, 0x5c, 0xe9,
-    // ?????? ???????? ???????? ????
-    0x0, 0x25, 0x26, 0x5b, 0x5c, 0xe9,
-    // ?????? ??????????? ????? ???????? ????
-    0x0, 0x1, 0x2, 0x3d, 0x5b, 0x5c, 0xe9,
-    // ?????? ?????????? ????? ???????? ????
-    0x0, 0x27, 0x28, 0x3d, 0x5b, 0x5c, 0xe9,
-    // ?????? ???????????? ????? ???????? ????
-    0x0, 0x6, 0x7, 0x3d, 0x5b, 0x5c, 0xe9,
-    // ?????? ???????????? ????? ???????? ????
-    0x0, 0xb, 0xc, 0x3d, 0x5b, 0x5c, 0xe9,
-    // ?????? ???????? ????? ???????? ????
-    0x0, 0x4, 0x5, 0x3d, 0x5b, 0x5c, 0xe9,
-    // ?????? ???????? ???? ?????? ???????? ????
-    0x0, 0x4, 0x5, 0x18, 0x3a, 0x5b, 0x5c, 0xe9,
-    // ?????? ???????? ??? ?????? ???????? ????
-    0x0, 0x4, 0x5, 0x16, 0x32, 0x5b, 0x5c, 0xe9,
-    // ?????? ???????? ??? ?????? ???????? ????
-    0x0, 0x4, 0x5, 0x48, 0x4a, 0x5b, 0x5c, 0xe9,
-    // ?????? ???????? ?????? ?????? ???????? ????
-    0x0, 0x4, 0x5, 0x46, 0x4a, 0x5b, 0x5c, 0xe9,
-    // ?????? ???????? ???? ????? ???????? ????
-    0x0, 0x4, 0x5, 0x4c, 0x50, 0x5b, 0x5c, 0xe9,
-    // ?????? ???????? ????? ????? ???????? ????
-    0x0, 0x4, 0x5, 0x47, 0x50, 0x5b, 0x5c, 0xe9,
-    // ?????? ???????? ???? ????? ???????? ????
-    0x0, 0x4, 0x5, 0x4d, 0x50, 0x5b, 0x5c, 0xe9,
-    // ?????? ???????? ?????? ????? ???????? ????
-    0x0, 0x4, 0x5, 0x45, 0x50, 0x5b, 0x5c, 0xe9,
-    // ?????? ???????? ?????? ????? ???????? ????
-    0x0, 0x4, 0x5, 0x44, 0x50, 0x5b, 0x5c, 0xe9,
-    // ?????? ???????? ???????? ????
-    0x0, 0x22, 0x23, 0x5b, 0x5c, 0xe9,
-    // ?????? ??? ???????? ?????? ????? ???? ????
-    0x0, 0x8, 0x12, 0x13, 0x3c, 0x3d, 0x4d, 0xe9,
-    // ?????? ??? ???????? ?????? ????? ???? ????
-    0x0, 0x8, 0x12, 0x13, 0x3b, 0x3d, 0x4d, 0xe9,
-    // ?????? ??? ???????? ???? ????? ???? ????
-    0x0, 0x8, 0x12, 0x13, 0x35, 0x3d, 0x4d, 0xe9,
-    // ?????? ??? ???????? ????? ????? ???? ????
-    0x0, 0x8, 0x12, 0x13, 0x29, 0x3d, 0x4d, 0xe9,
-    // ?????? ??? ???????? ???? ????? ???? ????
-    0x0, 0x8, 0x12, 0x13, 0x34, 0x3d, 0x4d, 0xe9,
-    // ?????? ??? ???????? ??????? ????? ???? ????
-    0x0, 0x8, 0x12, 0x13, 0x33, 0x3d, 0x4d, 0xe9,
-    // ?????? ??? ???????? ???? ????? ???? ????
-    0x0, 0x8, 0x12, 0x13, 0x1e, 0x3d, 0x4d, 0xe9,
-    // ?????? ??? ???????? ???? ????? ???? ????
-    0x0, 0x8, 0x12, 0x13, 0x36, 0x3d, 0x4d, 0xe9,
-    // ?????? ??? ???????? ????? ?????? ???? ????
-    0x0, 0x8, 0x12, 0x13, 0x24, 0x32, 0x4d, 0xe9,
-    // ?????? ??? ???????? ????? ???? ????
-    0x0, 0x8, 0x12, 0x13, 0x3d, 0x4d, 0xe9,
-    // ?????? ??? ???????????? ????? ???? ????
-    0x0, 0x8, 0x19, 0x1a, 0x3d, 0x4d, 0xe9,
-    // ?????? ??? ???????????? ????? ???? ????
-    0x0, 0x8, 0x1b, 0x1c, 0x3d, 0x4d, 0xe9,
-    // ?????? ??? ?????????? ????? ???? ????
-    0x0, 0x8, 0x2a, 0x2b, 0x3d, 0x4d, 0xe9,
-    // ?????? ??? ??????????? ????? ???? ????
-    0x0, 0x8, 0x9, 0xa, 0x3d, 0x4d, 0xe9,
-    // ?????? ??? ???????? ???? ????
-    0x0, 0x8, 0x2c, 0x2d, 0x4d, 0xe9,
-    // ?????? ??? ???????????? ????? ???? ????
-    0x0, 0x8, 0x14, 0x15, 0x3d, 0x4d, 0xe9,
-    // ?????? ??? ?????????? ????? ???? ????
-    0x0, 0x8, 0x37, 0x38, 0x3d, 0x4d, 0xe9,
-    // ?????? ??? ?????????? ????? ???? ????
-    0x0, 0x8, 0x20, 0x21, 0x3d, 0x4d, 0xe9,
-    // ?????? ??? ??????????? ????? ???? ????
-    0x0, 0x8, 0x10, 0x11, 0x3d, 0x4d, 0xe9,
-    // ?????? ??? ?????? ????? ???? ????
-    0x0, 0x8, 0x39, 0x3d, 0x4d, 0xe9,
-    // ?????? ??? ?????? ????? ???? ????
-    0x0, 0x8, 0x3c, 0x3d, 0x4d, 0xe9,
-    // ?????? ??? ?????? ????? ???? ????
-    0x0, 0x8, 0x3b, 0x3d, 0x4d, 0xe9,
-    // ?????? ??? ???? ????? ???? ????
-    0x0, 0x8, 0x35, 0x3d, 0x4d, 0xe9,
-    // ?????? ??? ????? ????? ???? ????
-    0x0, 0x8, 0x29, 0x3d, 0x4d, 0xe9,
-    // ?????? ??? ???? ????? ???? ????
-    0x0, 0x8, 0x34, 0x3d, 0x4d, 0xe9,
-    // ?????? ??? ??????? ????? ???? ????
-    0x0, 0x8, 0x33, 0x3d, 0x4d, 0xe9,
-    // ?????? ??? ???? ????? ???? ????
-    0x0, 0x8, 0x1e, 0x3d, 0x4d, 0xe9,
-    // ?????? ??? ???? ????? ???? ????
-    0x0, 0x8, 0x36, 0x3d, 0x4d, 0xe9,
-    // ?????? ??? ????? ?????? ???? ????
-    0x0, 0x8, 0x24, 0x32, 0x4d, 0xe9,
-    // ?????? ????? ???? ????? ????
-    0x0, 0x3, 0x4d, 0x51, 0xe9,
-    // ?????? ???? ?????? ???????? ????
-    0x0, 0x18, 0x3a, 0x5d, 0x5e, 0xe9,
-    // ?????? ??? ?????? ???????? ????
-    0x0, 0x16, 0x32, 0x5d, 0x5e, 0xe9,
-    // ?????? ??? ?????? ???????? ????
-    0x0, 0x48, 0x4a, 0x5d, 0x5e, 0xe9,
-    // ?????? ?????? ?????? ???????? ????
-    0x0, 0x46, 0x4a, 0x5d, 0x5e, 0xe9,
-    // ?????? ???? ????? ???????? ????
-    0x0, 0x4c, 0x50, 0x5d, 0x5e, 0xe9,
-    // ?????? ????? ????? ???????? ????
-    0x0, 0x47, 0x50, 0x5d, 0x5e, 0xe9,
-    // ?????? ???? ????? ???????? ????
-    0x0, 0x4d, 0x50, 0x5d, 0x5e, 0xe9,
-    // ?????? ?????? ????? ???????? ????
-    0x0, 0x45, 0x50, 0x5d, 0x5e, 0xe9,
-    // ?????? ?????? ????? ???????? ????
-    0x0, 0x44, 0x50, 0x5d, 0x5e, 0xe9,
-    // ?????? ?????? ????? ???????? ????
-    0x0, 0x43, 0x50, 0x5d, 0x5e, 0xe9,
-    // ?????? ??????????? ????? ???????? ????
-    0x0, 0x41, 0x42, 0x50, 0x5d, 0x5e, 0xe9,
-    // ?????? ?????????? ????? ???????? ????
-    0x0, 0x3e, 0x40, 0x50, 0x5d, 0x5e, 0xe9,
-    // ?????? ?????????? ????? ???????? ????
-    0x0, 0x30, 0x31, 0x3d, 0x5d, 0x5e, 0xe9,
-    // ?????? ???????????? ????? ???????? ????
-    0x0, 0xd, 0xe, 0x3d, 0x5d, 0x5e, 0xe9,
-    // ?????? ???????? ???????? ????
-    0x0, 0x25, 0x26, 0x5d, 0x5e, 0xe9,
-    // ?????? ??????????? ????? ???????? ????
-    0x0, 0x1, 0x2, 0x3d, 0x5d, 0x5e, 0xe9,
-    // ?????? ?????????? ????? ???????? ????
-    0x0, 0x27, 0x28, 0x3d, 0x5d, 0x5e, 0xe9,
-    // ?????? ???????????? ????? ???????? ????
-    0x0, 0x6, 0x7, 0x3d, 0x5d, 0x5e, 0xe9,
-    // ?????? ???????????? ????? ???????? ????
-    0x0, 0xb, 0xc, 0x3d, 0x5d, 0x5e, 0xe9,
-    // ?????? ???????? ????? ???????? ????
-    0x0, 0x4, 0x5, 0x3d, 0x5d, 0x5e, 0xe9,
-    // ?????? ???????? ???? ?????? ???????? ????
-    0x0, 0x4, 0x5, 0x18, 0x3a, 0x5d, 0x5e, 0xe9,
-    // ?????? ???????? ??? ?????? ???????? ????
-    0x0, 0x4, 0x5, 0x16, 0x32, 0x5d, 0x5e, 0xe9,
-    // ?????? ???????? ??? ?????? ???????? ????
-    0x0, 0x4, 0x5, 0x48, 0x4a, 0x5d, 0x5e, 0xe9,
-    // ?????? ???????? ?????? ?????? ???????? ????
-    0x0, 0x4, 0x5, 0x46, 0x4a, 0x5d, 0x5e, 0xe9,
-    // ?????? ???????? ???? ????? ???????? ????
-    0x0, 0x4, 0x5, 0x4c, 0x50, 0x5d, 0x5e, 0xe9,
-    // ?????? ???????? ????? ????? ???????? ????
-    0x0, 0x4, 0x5, 0x47, 0x50, 0x5d, 0x5e, 0xe9,
-    // ?????? ???????? ???? ????? ???????? ????
-    0x0, 0x4, 0x5, 0x4d, 0x50, 0x5d, 0x5e, 0xe9,
-    // ?????? ???????? ?????? ????? ???????? ????
-    0x0, 0x4, 0x5, 0x45, 0x50, 0x5d, 0x5e, 0xe9,
-    // ?????? ???????? ?????? ????? ???????? ????
-    0x0, 0x4, 0x5, 0x44, 0x50, 0x5d, 0x5e, 0xe9,
-    // ?????? ???????? ???????? ????
-    0x0, 0x22, 0x23, 0x5d, 0x5e, 0xe9,
-    // ?????? ??? ???????? ?????? ????? ?????? ????
-    0x0, 0x8, 0x12, 0x13, 0x3c, 0x3d, 0x45, 0xe9,
-    // ?????? ??? ???????? ?????? ????? ?????? ????
-    0x0, 0x8, 0x12, 0x13, 0x3b, 0x3d, 0x45, 0xe9,
-    // ?????? ??? ???????? ???? ????? ?????? ????
-    0x0, 0x8, 0x12, 0x13, 0x35, 0x3d, 0x45, 0xe9,
-    // ?????? ??? ???????? ????? ????? ?????? ????
-    0x0, 0x8, 0x12, 0x13, 0x29, 0x3d, 0x45, 0xe9,
-    // ?????? ??? ???????? ???? ????? ?????? ????
-    0x0, 0x8, 0x12, 0x13, 0x34, 0x3d, 0x45, 0xe9,
-    // ?????? ??? ???????? ??????? ????? ?????? ????
-    0x0, 0x8, 0x12, 0x13, 0x33, 0x3d, 0x45, 0xe9,
-    // ?????? ??? ???????? ???? ????? ?????? ????
-    0x0, 0x8, 0x12, 0x13, 0x1e, 0x3d, 0x45, 0xe9,
-    // ?????? ??? ???????? ???? ????? ?????? ????
-    0x0, 0x8, 0x12, 0x13, 0x36, 0x3d, 0x45, 0xe9,
-    // ?????? ??? ???????? ????? ?????? ?????? ????
-    0x0, 0x8, 0x12, 0x13, 0x24, 0x32, 0x45, 0xe9,
-    // ?????? ??? ???????? ????? ?????? ????
-    0x0, 0x8, 0x12, 0x13, 0x3d, 0x45, 0xe9,
-    // ?????? ??? ???????????? ????? ?????? ????
-    0x0, 0x8, 0x19, 0x1a, 0x3d, 0x45, 0xe9,
-    // ?????? ??? ???????????? ????? ?????? ????
-    0x0, 0x8, 0x1b, 0x1c, 0x3d, 0x45, 0xe9,
-    // ?????? ??? ?????????? ????? ?????? ????
-    0x0, 0x8, 0x2a, 0x2b, 0x3d, 0x45, 0xe9,
-    // ?????? ??? ??????????? ????? ?????? ????
-    0x0, 0x8, 0x9, 0xa, 0x3d, 0x45, 0xe9,
-    // ?????? ??? ???????? ?????? ????
-    0x0, 0x8, 0x2c, 0x2d, 0x45, 0xe9,
-    // ?????? ??? ???????????? ????? ?????? ????
-    0x0, 0x8, 0x14, 0x15, 0x3d, 0x45, 0xe9,
-    // ?????? ??? ?????????? ????? ?????? ????
-    0x0, 0x8, 0x37, 0x38, 0x3d, 0x45, 0xe9,
-    // ?????? ??? ?????????? ????? ?????? ????
-    0x0, 0x8, 0x20, 0x21, 0x3d, 0x45, 0xe9,
-    // ?????? ??? ??????????? ????? ?????? ????
-    0x0, 0x8, 0x10, 0x11, 0x3d, 0x45, 0xe9,
-    // ?????? ??? ?????? ????? ?????? ????
-    0x0, 0x8, 0x39, 0x3d, 0x45, 0xe9,
-    // ?????? ??? ?????? ????? ?????? ????
-    0x0, 0x8, 0x3c, 0x3d, 0x45, 0xe9,
-    // ?????? ??? ?????? ????? ?????? ????
-    0x0, 0x8, 0x3b, 0x3d, 0x45, 0xe9,
-    // ?????? ??? ???? ????? ?????? ????
-    0x0, 0x8, 0x35, 0x3d, 0x45, 0xe9,
-    // ?????? ??? ????? ????? ?????? ????
-    0x0, 0x8, 0x29, 0x3d, 0x45, 0xe9,
-    // ?????? ??? ???? ????? ?????? ????
-    0x0, 0x8, 0x34, 0x3d, 0x45, 0xe9,
-    // ?????? ??? ??????? ????? ?????? ????
-    0x0, 0x8, 0x33, 0x3d, 0x45, 0xe9,
-    // ?????? ??? ???? ????? ?????? ????
-    0x0, 0x8, 0x1e, 0x3d, 0x45, 0xe9,
-    // ?????? ??? ???? ????? ?????? ????
-    0x0, 0x8, 0x36, 0x3d, 0x45, 0xe9,
-    // ?????? ??? ????? ?????? ?????? ????
-    0x0, 0x8, 0x24, 0x32, 0x45, 0xe9,
-    // ?????? ????? ?????? ????? ????
-    0x0, 0x3, 0x45, 0x51, 0xe9,
-    // ?????? ???? ?????? ???????? ????
-    0x0, 0x18, 0x3a, 0x67, 0x68, 0xe9,
-    // ?????? ??? ?????? ???????? ????
-    0x0, 0x16, 0x32, 0x67, 0x68, 0xe9,
-    // ?????? ??? ?????? ???????? ????
-    0x0, 0x48, 0x4a, 0x67, 0x68, 0xe9,
-    // ?????? ?????? ?????? ???????? ????
-    0x0, 0x46, 0x4a, 0x67, 0x68, 0xe9,
-    // ?????? ???? ????? ???????? ????
-    0x0, 0x4c, 0x50, 0x67, 0x68, 0xe9,
-    // ?????? ????? ????? ???????? ????
-    0x0, 0x47, 0x50, 0x67, 0x68, 0xe9,
-    // ?????? ???? ????? ???????? ????
-    0x0, 0x4d, 0x50, 0x67, 0x68, 0xe9,
-    // ?????? ?????? ????? ???????? ????
-    0x0, 0x45, 0x50, 0x67, 0x68, 0xe9,
-    // ?????? ?????? ????? ???????? ????
-    0x0, 0x44, 0x50, 0x67, 0x68, 0xe9,
-    // ?????? ?????? ????? ???????? ????
-    0x0, 0x43, 0x50, 0x67, 0x68, 0xe9,
-    // ?????? ??????????? ????? ???????? ????
-    0x0, 0x41, 0x42, 0x50, 0x67, 0x68, 0xe9,
-    // ?????? ?????????? ????? ???????? ????
-    0x0, 0x3e, 0x40, 0x50, 0x67, 0x68, 0xe9,
-    // ?????? ?????????? ????? ???????? ????
-    0x0, 0x30, 0x31, 0x3d, 0x67, 0x68, 0xe9,
-    // ?????? ???????????? ????? ???????? ????
-    0x0, 0xd, 0xe, 0x3d, 0x67, 0x68, 0xe9,
-    // ?????? ???????? ???????? ????
-    0x0, 0x25, 0x26, 0x67, 0x68, 0xe9,
-    // ?????? ??????????? ????? ???????? ????
-    0x0, 0x1, 0x2, 0x3d, 0x67, 0x68, 0xe9,
-    // ?????? ?????????? ????? ???????? ????
-    0x0, 0x27, 0x28, 0x3d, 0x67, 0x68, 0xe9,
-    // ?????? ???????????? ????? ???????? ????
-    0x0, 0x6, 0x7, 0x3d, 0x67, 0x68, 0xe9,
-    // ?????? ???????????? ????? ???????? ????
-    0x0, 0xb, 0xc, 0x3d, 0x67, 0x68, 0xe9,
-    // ?????? ???????? ????? ???????? ????
-    0x0, 0x4, 0x5, 0x3d, 0x67, 0x68, 0xe9,
-    // ?????? ???????? ???? ?????? ???????? ????
-    0x0, 0x4, 0x5, 0x18, 0x3a, 0x67, 0x68, 0xe9,
-    // ?????? ???????? ??? ?????? ???????? ????
-    0x0, 0x4, 0x5, 0x16, 0x32, 0x67, 0x68, 0xe9,
-    // ?????? ???????? ??? ?????? ???????? ????
-    0x0, 0x4, 0x5, 0x48, 0x4a, 0x67, 0x68, 0xe9,
-    // ?????? ???????? ?????? ?????? ???????? ????
-    0x0, 0x4, 0x5, 0x46, 0x4a, 0x67, 0x68, 0xe9,
-    // ?????? ???????? ???? ????? ???????? ????
-    0x0, 0x4, 0x5, 0x4c, 0x50, 0x67, 0x68, 0xe9,
-    // ?????? ???????? ????? ????? ???????? ????
-    0x0, 0x4, 0x5, 0x47, 0x50, 0x67, 0x68, 0xe9,
-    // ?????? ???????? ???? ????? ???????? ????
-    0x0, 0x4, 0x5, 0x4d, 0x50, 0x67, 0x68, 0xe9,
-    // ?????? ???????? ?????? ????? ???????? ????
-    0x0, 0x4, 0x5, 0x45, 0x50, 0x67, 0x68, 0xe9,
-    // ?????? ???????? ?????? ????? ???????? ????
-    0x0, 0x4, 0x5, 0x44, 0x50, 0x67, 0x68, 0xe9,
-    // ?????? ???????? ???????? ????
-    0x0, 0x22, 0x23, 0x67, 0x68, 0xe9,
-    // ?????? ??? ???????? ?????? ????? ?????? ????
-    0x0, 0x8, 0x12, 0x13, 0x3c, 0x3d, 0x44, 0xe9,
-    // ?????? ??? ???????? ?????? ????? ?????? ????
-    0x0, 0x8, 0x12, 0x13, 0x3b, 0x3d, 0x44, 0xe9,
-    // ?????? ??? ???????? ???? ????? ?????? ????
-    0x0, 0x8, 0x12, 0x13, 0x35, 0x3d, 0x44, 0xe9,
-    // ?????? ??? ???????? ????? ????? ?????? ????
-    0x0, 0x8, 0x12, 0x13, 0x29, 0x3d, 0x44, 0xe9,
-    // ?????? ??? ???????? ???? ????? ?????? ????
-    0x0, 0x8, 0x12, 0x13, 0x34, 0x3d, 0x44, 0xe9,
-    // ?????? ??? ???????? ??????? ????? ?????? ????
-    0x0, 0x8, 0x12, 0x13, 0x33, 0x3d, 0x44, 0xe9,
-    // ?????? ??? ???????? ???? ????? ?????? ????
-    0x0, 0x8, 0x12, 0x13, 0x1e, 0x3d, 0x44, 0xe9,
-    // ?????? ??? ???????? ???? ????? ?????? ????
-    0x0, 0x8, 0x12, 0x13, 0x36, 0x3d, 0x44, 0xe9,
-    // ?????? ??? ???????? ????? ?????? ?????? ????
-    0x0, 0x8, 0x12, 0x13, 0x24, 0x32, 0x44, 0xe9,
-    // ?????? ??? ???????? ????? ?????? ????
-    0x0, 0x8, 0x12, 0x13, 0x3d, 0x44, 0xe9,
-    // ?????? ??? ???????????? ????? ?????? ????
-    0x0, 0x8, 0x19, 0x1a, 0x3d, 0x44, 0xe9,
-    // ?????? ??? ???????????? ????? ?????? ????
-    0x0, 0x8, 0x1b, 0x1c, 0x3d, 0x44, 0xe9,
-    // ?????? ??? ?????????? ????? ?????? ????
-    0x0, 0x8, 0x2a, 0x2b, 0x3d, 0x44, 0xe9,
-    // ?????? ??? ??????????? ????? ?????? ????
-    0x0, 0x8, 0x9, 0xa, 0x3d, 0x44, 0xe9,
-    // ?????? ??? ???????? ?????? ????
-    0x0, 0x8, 0x2c, 0x2d, 0x44, 0xe9,
-    // ?????? ??? ???????????? ????? ?????? ????
-    0x0, 0x8, 0x14, 0x15, 0x3d, 0x44, 0xe9,
-    // ?????? ??? ?????????? ????? ?????? ????
-    0x0, 0x8, 0x37, 0x38, 0x3d, 0x44, 0xe9,
-    // ?????? ??? ?????????? ????? ?????? ????
-    0x0, 0x8, 0x20, 0x21, 0x3d, 0x44, 0xe9,
-    // ?????? ??? ??????????? ????? ?????? ????
-    0x0, 0x8, 0x10, 0x11, 0x3d, 0x44, 0xe9,
-    // ?????? ??? ?????? ????? ?????? ????
-    0x0, 0x8, 0x39, 0x3d, 0x44, 0xe9,
-    // ?????? ??? ?????? ????? ?????? ????
-    0x0, 0x8, 0x3c, 0x3d, 0x44, 0xe9,
-    // ?????? ??? ?????? ????? ?????? ????
-    0x0, 0x8, 0x3b, 0x3d, 0x44, 0xe9,
-    // ?????? ??? ???? ????? ?????? ????
-    0x0, 0x8, 0x35, 0x3d, 0x44, 0xe9,
-    // ?????? ??? ????? ????? ?????? ????
-    0x0, 0x8, 0x29, 0x3d, 0x44, 0xe9,
-    // ?????? ??? ???? ????? ?????? ????
-    0x0, 0x8, 0x34, 0x3d, 0x44, 0xe9,
-    // ?????? ??? ??????? ????? ?????? ????
-    0x0, 0x8, 0x33, 0x3d, 0x44, 0xe9,
-    // ?????? ??? ???? ????? ?????? ????
-    0x0, 0x8, 0x1e, 0x3d, 0x44, 0xe9,
-    // ?????? ??? ???? ????? ?????? ????
-    0x0, 0x8, 0x36, 0x3d, 0x44, 0xe9,
-    // ?????? ??? ????? ?????? ?????? ????
-    0x0, 0x8, 0x24, 0x32, 0x44, 0xe9,
-    // ?????? ????? ?????? ????? ????
-    0x0, 0x3, 0x44, 0x51, 0xe9,
-    // ?????? ???? ?????? ???????? ????
-    0x0, 0x18, 0x3a, 0x60, 0x61, 0xe9,
-    // ?????? ??? ?????? ???????? ????
-    0x0, 0x16, 0x32, 0x60, 0x61, 0xe9,
-    // ?????? ??? ?????? ???????? ????
-    0x0, 0x48, 0x4a, 0x60, 0x61, 0xe9,
-    // ?????? ?????? ?????? ???????? ????
-    0x0, 0x46, 0x4a, 0x60, 0x61, 0xe9,
-    // ?????? ???? ????? ???????? ????
-    0x0, 0x4c, 0x50, 0x60, 0x61, 0xe9,
-    // ?????? ????? ????? ???????? ????
-    0x0, 0x47, 0x50, 0x60, 0x61, 0xe9,
-    // ?????? ???? ????? ???????? ????
-    0x0, 0x4d, 0x50, 0x60, 0x61, 0xe9,
-    // ?????? ?????? ????? ???????? ????
-    0x0, 0x45, 0x50, 0x60, 0x61, 0xe9,
-    // ?????? ?????? ????? ???????? ????
-    0x0, 0x44, 0x50, 0x60, 0x61, 0xe9,
-    // ?????? ?????? ????? ???????? ????
-    0x0, 0x43, 0x50, 0x60, 0x61, 0xe9,
-    // ?????? ??????????? ????? ???????? ????
-    0x0, 0x41, 0x42, 0x50, 0x60, 0x61, 0xe9,
-    // ?????? ?????????? ????? ???????? ????
-    0x0, 0x3e, 0x40, 0x50, 0x60, 0x61, 0xe9,
-    // ?????? ?????????? ????? ???????? ????
-    0x0, 0x30, 0x31, 0x3d, 0x60, 0x61, 0xe9,
-    // ?????? ???????????? ????? ???????? ????
-    0x0, 0xd, 0xe, 0x3d, 0x60, 0x61, 0xe9,
-    // ?????? ???????? ???????? ????
-    0x0, 0x25, 0x26, 0x60, 0x61, 0xe9,
-    // ?????? ??????????? ????? ???????? ????
-    0x0, 0x1, 0x2, 0x3d, 0x60, 0x61, 0xe9,
-    // ?????? ?????????? ????? ???????? ????
-    0x0, 0x27, 0x28, 0x3d, 0x60, 0x61, 0xe9,
-    // ?????? ???????????? ????? ???????? ????
-    0x0, 0x6, 0x7, 0x3d, 0x60, 0x61, 0xe9,
-    // ?????? ???????????? ????? ???????? ????
-    0x0, 0xb, 0xc, 0x3d, 0x60, 0x61, 0xe9,
-    // ?????? ???????? ????? ???????? ????
-    0x0, 0x4, 0x5, 0x3d, 0x60, 0x61, 0xe9,
-    // ?????? ???????? ???? ?????? ???????? ????
-    0x0, 0x4, 0x5, 0x18, 0x3a, 0x60, 0x61, 0xe9,
-    // ?????? ???????? ??? ?????? ???????? ????
-    0x0, 0x4, 0x5, 0x16, 0x32, 0x60, 0x61, 0xe9,
-    // ?????? ???????? ??? ?????? ???????? ????
-    0x0, 0x4, 0x5, 0x48, 0x4a, 0x60, 0x61, 0xe9,
-    // ?????? ???????? ?????? ?????? ???????? ????
-    0x0, 0x4, 0x5, 0x46, 0x4a, 0x60, 0x61, 0xe9,
-    // ?????? ???????? ???? ????? ???????? ????
-    0x0, 0x4, 0x5, 0x4c, 0x50, 0x60, 0x61, 0xe9,
-    // ?????? ???????? ????? ????? ???????? ????
-    0x0, 0x4, 0x5, 0x47, 0x50, 0x60, 0x61, 0xe9,
-    // ?????? ???????? ???? ????? ???????? ????
-    0x0, 0x4, 0x5, 0x4d, 0x50, 0x60, 0x61, 0xe9,
-    // ?????? ???????? ?????? ????? ???????? ????
-    0x0, 0x4, 0x5, 0x45, 0x50, 0x60, 0x61, 0xe9,
-    // ?????? ???????? ?????? ????? ???????? ????
-    0x0, 0x4, 0x5, 0x44, 0x50, 0x60, 0x61, 0xe9,
-    // ?????? ???????? ???????? ????
-    0x0, 0x22, 0x23, 0x60, 0x61, 0xe9,
-    // ?????? ??? ???????? ?????? ????? ?????? ????
-    0x0, 0x8, 0x12, 0x13, 0x3c, 0x3d, 0x43, 0xe9,
-    // ?????? ??? ???????? ?????? ????? ?????? ????
-    0x0, 0x8, 0x12, 0x13, 0x3b, 0x3d, 0x43, 0xe9,
-    // ?????? ??? ???????? ???? ????? ?????? ????
-    0x0, 0x8, 0x12, 0x13, 0x35, 0x3d, 0x43, 0xe9,
-    // ?????? ??? ???????? ????? ????? ?????? ????
-    0x0, 0x8, 0x12, 0x13, 0x29, 0x3d, 0x43, 0xe9,
-    // ?????? ??? ???????? ???? ????? ?????? ????
-    0x0, 0x8, 0x12, 0x13, 0x34, 0x3d, 0x43, 0xe9,
-    // ?????? ??? ???????? ??????? ????? ?????? ????
-    0x0, 0x8, 0x12, 0x13, 0x33, 0x3d, 0x43, 0xe9,
-    // ?????? ??? ???????? ???? ????? ?????? ????
-    0x0, 0x8, 0x12, 0x13, 0x1e, 0x3d, 0x43, 0xe9,
-    // ?????? ??? ???????? ???? ????? ?????? ????
-    0x0, 0x8, 0x12, 0x13, 0x36, 0x3d, 0x43, 0xe9,
-    // ?????? ??? ???????? ????? ?????? ?????? ????
-    0x0, 0x8, 0x12, 0x13, 0x24, 0x32, 0x43, 0xe9,
-    // ?????? ??? ???????? ????? ?????? ????
-    0x0, 0x8, 0x12, 0x13, 0x3d, 0x43, 0xe9,
-    // ?????? ??? ???????????? ????? ?????? ????
-    0x0, 0x8, 0x19, 0x1a, 0x3d, 0x43, 0xe9,
-    // ?????? ??? ???????????? ????? ?????? ????
-    0x0, 0x8, 0x1b, 0x1c, 0x3d, 0x43, 0xe9,
-    // ?????? ??? ?????????? ????? ?????? ????
-    0x0, 0x8, 0x2a, 0x2b, 0x3d, 0x43, 0xe9,
-    // ?????? ??? ??????????? ????? ?????? ????
-    0x0, 0x8, 0x9, 0xa, 0x3d, 0x43, 0xe9,
-    // ?????? ??? ???????? ?????? ????
-    0x0, 0x8, 0x2c, 0x2d, 0x43, 0xe9,
-    // ?????? ??? ???????????? ????? ?????? ????
-    0x0, 0x8, 0x14, 0x15, 0x3d, 0x43, 0xe9,
-    // ?????? ??? ?????????? ????? ?????? ????
-    0x0, 0x8, 0x37, 0x38, 0x3d, 0x43, 0xe9,
-    // ?????? ??? ?????????? ????? ?????? ????
-    0x0, 0x8, 0x20, 0x21, 0x3d, 0x43, 0xe9,
-    // ?????? ??? ??????????? ????? ?????? ????
-    0x0, 0x8, 0x10, 0x11, 0x3d, 0x43, 0xe9,
-    // ?????? ??? ?????? ????? ?????? ????
-    0x0, 0x8, 0x39, 0x3d, 0x43, 0xe9,
-    // ?????? ??? ?????? ????? ?????? ????
-    0x0, 0x8, 0x3c, 0x3d, 0x43, 0xe9,
-    // ?????? ??? ?????? ????? ?????? ????
-    0x0, 0x8, 0x3b, 0x3d, 0x43, 0xe9,
-    // ?????? ??? ???? ????? ?????? ????
-    0x0, 0x8, 0x35, 0x3d, 0x43, 0xe9,
-    // ?????? ??? ????? ????? ?????? ????
-    0x0, 0x8, 0x29, 0x3d, 0x43, 0xe9,
-    // ?????? ??? ???? ????? ?????? ????
-    0x0, 0x8, 0x34, 0x3d, 0x43, 0xe9,
-    // ?????? ??? ??????? ????? ?????? ????
-    0x0, 0x8, 0x33, 0x3d, 0x43, 0xe9,
-    // ?????? ??? ???? ????? ?????? ????
-    0x0, 0x8, 0x1e, 0x3d, 0x43, 0xe9,
-    // ?????? ??? ???? ????? ?????? ????
-    0x0, 0x8, 0x36, 0x3d, 0x43, 0xe9,
-    // ?????? ??? ????? ?????? ?????? ????
-    0x0, 0x8, 0x24, 0x32, 0x43, 0xe9,
-    // ?????? ????? ?????? ????? ????
-    0x0, 0x3, 0x43, 0x51, 0xe9,
-    // ?????? ???? ?????? ????????????? ????
-    0x0, 0x18, 0x3a, 0x54, 0x55, 0xe9,
-    // ?????? ??? ?????? ????????????? ????
-    0x0, 0x16, 0x32, 0x54, 0x55, 0xe9,
-    // ?????? ??? ?????? ????????????? ????
-    0x0, 0x48, 0x4a, 0x54, 0x55, 0xe9,
-    // ?????? ?????? ?????? ????????????? ????
-    0x0, 0x46, 0x4a, 0x54, 0x55, 0xe9,
-    // ?????? ???? ????? ????????????? ????
-    0x0, 0x4c, 0x50, 0x54, 0x55, 0xe9,
-    // ?????? ????? ????? ????????????? ????
-    0x0, 0x47, 0x50, 0x54, 0x55, 0xe9,
-    // ?????? ???? ????? ????????????? ????
-    0x0, 0x4d, 0x50, 0x54, 0x55, 0xe9,
-    // ?????? ?????? ????? ????????????? ????
-    0x0, 0x45, 0x50, 0x54, 0x55, 0xe9,
-    // ?????? ?????? ????? ????????????? ????
-    0x0, 0x44, 0x50, 0x54, 0x55, 0xe9,
-    // ?????? ?????? ????? ????????????? ????
-    0x0, 0x43, 0x50, 0x54, 0x55, 0xe9,
-    // ?????? ??????????? ????? ????????????? ????
-    0x0, 0x41, 0x42, 0x50, 0x54, 0x55, 0xe9,
-    // ?????? ?????????? ????? ????????????? ????
-    0x0, 0x3e, 0x40, 0x50, 0x54, 0x55, 0xe9,
-    // ?????? ?????????? ????? ????????????? ????
-    0x0, 0x30, 0x31, 0x3d, 0x54, 0x55, 0xe9,
-    // ?????? ???????????? ????? ????????????? ????
-    0x0, 0xd, 0xe, 0x3d, 0x54, 0x55, 0xe9,
-    // ?????? ???????? ????????????? ????
-    0x0, 0x25, 0x26, 0x54, 0x55, 0xe9,
-    // ?????? ??????????? ????? ????????????? ????
-    0x0, 0x1, 0x2, 0x3d, 0x54, 0x55, 0xe9,
-    // ?????? ?????????? ????? ????????????? ????
-    0x0, 0x27, 0x28, 0x3d, 0x54, 0x55, 0xe9,
-    // ?????? ???????????? ????? ????????????? ????
-    0x0, 0x6, 0x7, 0x3d, 0x54, 0x55, 0xe9,
-    // ?????? ???????????? ????? ????????????? ????
-    0x0, 0xb, 0xc, 0x3d, 0x54, 0x55, 0xe9,
-    // ?????? ???????? ????? ????????????? ????
-    0x0, 0x4, 0x5, 0x3d, 0x54, 0x55, 0xe9,
-    // ?????? ???????? ???? ?????? ????????????? ????
-    0x0, 0x4, 0x5, 0x18, 0x3a, 0x54, 0x55, 0xe9,
-    // ?????? ???????? ??? ?????? ????????????? ????
-    0x0, 0x4, 0x5, 0x16, 0x32, 0x54, 0x55, 0xe9,
-    // ?????? ???????? ??? ?????? ????????????? ????
-    0x0, 0x4, 0x5, 0x48, 0x4a, 0x54, 0x55, 0xe9,
-    // ?????? ???????? ?????? ?????? ????????????? ????
-    0x0, 0x4, 0x5, 0x46, 0x4a, 0x54, 0x55, 0xe9,
-    // ?????? ???????? ???? ????? ????????????? ????
-    0x0, 0x4, 0x5, 0x4c, 0x50, 0x54, 0x55, 0xe9,
-    // ?????? ???????? ????? ????? ????????????? ????
-    0x0, 0x4, 0x5, 0x47, 0x50, 0x54, 0x55, 0xe9,
-    // ?????? ???????? ???? ????? ????????????? ????
-    0x0, 0x4, 0x5, 0x4d, 0x50, 0x54, 0x55, 0xe9,
-    // ?????? ???????? ?????? ????? ????????????? ????
-    0x0, 0x4, 0x5, 0x45, 0x50, 0x54, 0x55, 0xe9,
-    // ?????? ???????? ?????? ????? ????????????? ????
-    0x0, 0x4, 0x5, 0x44, 0x50, 0x54, 0x55, 0xe9,
-    // ?????? ???????? ????????????? ????
-    0x0, 0x22, 0x23, 0x54, 0x55, 0xe9,
-    // ?????? ??? ???????? ?????? ????? ??????????? ????
-    0x0, 0x8, 0x12, 0x13, 0x3c, 0x3d, 0x41, 0x42, 0xe9,
-    // ?????? ??? ???????? ?????? ????? ??????????? ????
-    0x0, 0x8, 0x12, 0x13, 0x3b, 0x3d, 0x41, 0x42, 0xe9,
-    // ?????? ??? ???????? ???? ????? ??????????? ????
-    0x0, 0x8, 0x12, 0x13, 0x35, 0x3d, 0x41, 0x42, 0xe9,
-    // ?????? ??? ???????? ????? ????? ??????????? ????
-    0x0, 0x8, 0x12, 0x13, 0x29, 0x3d, 0x41, 0x42, 0xe9,
-    // ?????? ??? ???????? ???? ????? ??????????? ????
-    0x0, 0x8, 0x12, 0x13, 0x34, 0x3d, 0x41, 0x42, 0xe9,
-    // ?????? ??? ???????? ??????? ????? ??????????? ????
-    0x0, 0x8, 0x12, 0x13, 0x33, 0x3d, 0x41, 0x42, 0xe9,
-    // ?????? ??? ???????? ???? ????? ??????????? ????
-    0x0, 0x8, 0x12, 0x13, 0x1e, 0x3d, 0x41, 0x42, 0xe9,
-    // ?????? ??? ???????? ???? ????? ??????????? ????
-    0x0, 0x8, 0x12, 0x13, 0x36, 0x3d, 0x41, 0x42, 0xe9,
-    // ?????? ??? ???????? ????? ?????? ??????????? ????
-    0x0, 0x8, 0x12, 0x13, 0x24, 0x32, 0x41, 0x42, 0xe9,
-    // ?????? ??? ???????? ????? ??????????? ????
-    0x0, 0x8, 0x12, 0x13, 0x3d, 0x41, 0x42, 0xe9,
-    // ?????? ??? ???????????? ????? ??????????? ????
-    0x0, 0x8, 0x19, 0x1a, 0x3d, 0x41, 0x42, 0xe9,
-    // ?????? ??? ???????????? ????? ??????????? ????
-    0x0, 0x8, 0x1b, 0x1c, 0x3d, 0x41, 0x42, 0xe9,
-    // ?????? ??? ?????????? ????? ??????????? ????
-    0x0, 0x8, 0x2a, 0x2b, 0x3d, 0x41, 0x42, 0xe9,
-    // ?????? ??? ??????????? ????? ??????????? ????
-    0x0, 0x8, 0x9, 0xa, 0x3d, 0x41, 0x42, 0xe9,
-    // ?????? ??? ???????? ??????????? ????
-    0x0, 0x8, 0x2c, 0x2d, 0x41, 0x42, 0xe9,
-    // ?????? ??? ???????????? ????? ??????????? ????
-    0x0, 0x8, 0x14, 0x15, 0x3d, 0x41, 0x42, 0xe9,
-    // ?????? ??? ?????????? ????? ??????????? ????
-    0x0, 0x8, 0x37, 0x38, 0x3d, 0x41, 0x42, 0xe9,
-    // ?????? ??? ?????????? ????? ??????????? ????
-    0x0, 0x8, 0x20, 0x21, 0x3d, 0x41, 0x42, 0xe9,
-    // ?????? ??? ??????????? ????? ??????????? ????
-    0x0, 0x8, 0x10, 0x11, 0x3d, 0x41, 0x42, 0xe9,
-    // ?????? ??? ?????? ????? ??????????? ????
-    0x0, 0x8, 0x39, 0x3d, 0x41, 0x42, 0xe9,
-    // ?????? ??? ?????? ????? ??????????? ????
-    0x0, 0x8, 0x3c, 0x3d, 0x41, 0x42, 0xe9,
-    // ?????? ??? ?????? ????? ??????????? ????
-    0x0, 0x8, 0x3b, 0x3d, 0x41, 0x42, 0xe9,
-    // ?????? ??? ???? ????? ??????????? ????
-    0x0, 0x8, 0x35, 0x3d, 0x41, 0x42, 0xe9,
-    // ?????? ??? ????? ????? ??????????? ????
-    0x0, 0x8, 0x29, 0x3d, 0x41, 0x42, 0xe9,
-    // ?????? ??? ???? ????? ??????????? ????
-    0x0, 0x8, 0x34, 0x3d, 0x41, 0x42, 0xe9,
-    // ?????? ??? ??????? ????? ??????????? ????
-    0x0, 0x8, 0x33, 0x3d, 0x41, 0x42, 0xe9,
-    // ?????? ??? ???? ????? ??????????? ????
-    0x0, 0x8, 0x1e, 0x3d, 0x41, 0x42, 0xe9,
-    // ?????? ??? ???? ????? ??????????? ????
-    0x0, 0x8, 0x36, 0x3d, 0x41, 0x42, 0xe9,
-    // ?????? ??? ????? ?????? ??????????? ????
-    0x0, 0x8, 0x24, 0x32, 0x41, 0x42, 0xe9,
-    // ?????? ????? ??????????? ????? ????
-    0x0, 0x3, 0x41, 0x42, 0x51, 0xe9,
-    // ?????? ???? ?????? ???????????? ????
-    0x0, 0x18, 0x3a, 0x52, 0x53, 0xe9,
-    // ?????? ??? ?????? ???????????? ????
-    0x0, 0x16, 0x32, 0x52, 0x53, 0xe9,
-    // ?????? ??? ?????? ???????????? ????
-    0x0, 0x48, 0x4a, 0x52, 0x53, 0xe9,
-    // ?????? ?????? ?????? ???????????? ????
-    0x0, 0x46, 0x4a, 0x52, 0x53, 0xe9,
-    // ?????? ???? ????? ???????????? ????
-    0x0, 0x4c, 0x50, 0x52, 0x53, 0xe9,
-    // ?????? ????? ????? ???????????? ????
-    0x0, 0x47, 0x50, 0x52, 0x53, 0xe9,
-    // ?????? ???? ????? ???????????? ????
-    0x0, 0x4d, 0x50, 0x52, 0x53, 0xe9,
-    // ?????? ?????? ????? ???????????? ????
-    0x0, 0x45, 0x50, 0x52, 0x53, 0xe9,
-    // ?????? ?????? ????? ???????????? ????
-    0x0, 0x44, 0x50, 0x52, 0x53, 0xe9,
-    // ?????? ?????? ????? ???????????? ????
-    0x0, 0x43, 0x50, 0x52, 0x53, 0xe9,
-    // ?????? ??????????? ????? ???????????? ????
-    0x0, 0x41, 0x42, 0x50, 0x52, 0x53, 0xe9,
-    // ?????? ?????????? ????? ???????????? ????
-    0x0, 0x3e, 0x40, 0x50, 0x52, 0x53, 0xe9,
-    // ?????? ?????????? ????? ???????????? ????
-    0x0, 0x30, 0x31, 0x3d, 0x52, 0x53, 0xe9,
-    // ?????? ???????????? ????? ???????????? ????
-    0x0, 0xd, 0xe, 0x3d, 0x52, 0x53, 0xe9,
-    // ?????? ???????? ???????????? ????
-    0x0, 0x25, 0x26, 0x52, 0x53, 0xe9,
-    // ?????? ??????????? ????? ???????????? ????
-    0x0, 0x1, 0x2, 0x3d, 0x52, 0x53, 0xe9,
-    // ?????? ?????????? ????? ???????????? ????
-    0x0, 0x27, 0x28, 0x3d, 0x52, 0x53, 0xe9,
-    // ?????? ???????????? ????? ???????????? ????
-    0x0, 0x6, 0x7, 0x3d, 0x52, 0x53, 0xe9,
-    // ?????? ???????????? ????? ???????????? ????
-    0x0, 0xb, 0xc, 0x3d, 0x52, 0x53, 0xe9,
-    // ?????? ???????? ????? ???????????? ????
-    0x0, 0x4, 0x5, 0x3d, 0x52, 0x53, 0xe9,
-    // ?????? ???????? ???? ?????? ???????????? ????
-    0x0, 0x4, 0x5, 0x18, 0x3a, 0x52, 0x53, 0xe9,
-    // ?????? ???????? ??? ?????? ???????????? ????
-    0x0, 0x4, 0x5, 0x16, 0x32, 0x52, 0x53, 0xe9,
-    // ?????? ???????? ??? ?????? ???????????? ????
-    0x0, 0x4, 0x5, 0x48, 0x4a, 0x52, 0x53, 0xe9,
-    // ?????? ???????? ?????? ?????? ???????????? ????
-    0x0, 0x4, 0x5, 0x46, 0x4a, 0x52, 0x53, 0xe9,
-    // ?????? ???????? ???? ????? ???????????? ????
-    0x0, 0x4, 0x5, 0x4c, 0x50, 0x52, 0x53, 0xe9,
-    // ?????? ???????? ????? ????? ???????????? ????
-    0x0, 0x4, 0x5, 0x47, 0x50, 0x52, 0x53, 0xe9,
-    // ?????? ???????? ???? ????? ???????????? ????
-    0x0, 0x4, 0x5, 0x4d, 0x50, 0x52, 0x53, 0xe9,
-    // ?????? ???????? ?????? ????? ???????????? ????
-    0x0, 0x4, 0x5, 0x45, 0x50, 0x52, 0x53, 0xe9,
-    // ?????? ???????? ?????? ????? ???????????? ????
-    0x0, 0x4, 0x5, 0x44, 0x50, 0x52, 0x53, 0xe9,
-    // ?????? ???????? ???????????? ???
-    0x0, 0x22, 0x23, 0x52, 0x53, 0xe5,
-    // ?????? ??? ???????? ?????? ????? ?????????? ???
-    0x0, 0x8, 0x12, 0x13, 0x3c, 0x3d, 0x3e, 0x40, 0xe5,
-    // ?????? ??? ???????? ?????? ????? ?????????? ???
-    0x0, 0x8, 0x12, 0x13, 0x3b, 0x3d, 0x3e, 0x40, 0xe5,
-    // ?????? ??? ???????? ???? ????? ?????????? ???
-    0x0, 0x8, 0x12, 0x13, 0x35, 0x3d, 0x3e, 0x40, 0xe5,
-    // ?????? ??? ???????? ????? ????? ?????????? ???
-    0x0, 0x8, 0x12, 0x13, 0x29, 0x3d, 0x3e, 0x40, 0xe5,
-    // ?????? ??? ???????? ???? ????? ?????????? ???
-    0x0, 0x8, 0x12, 0x13, 0x34, 0x3d, 0x3e, 0x40, 0xe5,
-    // ?????? ??? ???????? ??????? ????? ?????????? ???
-    0x0, 0x8, 0x12, 0x13, 0x33, 0x3d, 0x3e, 0x40, 0xe5,
-    // ?????? ??? ???????? ???? ????? ?????????? ???
-    0x0, 0x8, 0x12, 0x13, 0x1e, 0x3d, 0x3e, 0x40, 0xe5,
-    // ?????? ??? ???????? ???? ????? ?????????? ???
-    0x0, 0x8, 0x12, 0x13, 0x36, 0x3d, 0x3e, 0x40, 0xe5,
-    // ?????? ??? ???????? ????? ?????? ?????????? ???
-    0x0, 0x8, 0x12, 0x13, 0x24, 0x32, 0x3e, 0x40, 0xe5,
-    // ?????? ??? ???????? ????? ?????????? ???
-    0x0, 0x8, 0x12, 0x13, 0x3d, 0x3e, 0x40, 0xe5,
-    // ?????? ??? ???????????? ????? ?????????? ???
-    0x0, 0x8, 0x19, 0x1a, 0x3d, 0x3e, 0x40, 0xe5,
-    // ?????? ??? ???????????? ????? ?????????? ???
-    0x0, 0x8, 0x1b, 0x1c, 0x3d, 0x3e, 0x40, 0xe5,
-    // ?????? ??? ?????????? ????? ?????????? ???
-    0x0, 0x8, 0x2a, 0x2b, 0x3d, 0x3e, 0x40, 0xe5,
-    // ?????? ??? ??????????? ????? ?????????? ???
-    0x0, 0x8, 0x9, 0xa, 0x3d, 0x3e, 0x40, 0xe5,
-    // ?????? ??? ???????? ?????????? ???
-    0x0, 0x8, 0x2c, 0x2d, 0x3e, 0x40, 0xe5,
-    // ?????? ??? ???????????? ????? ?????????? ???
-    0x0, 0x8, 0x14, 0x15, 0x3d, 0x3e, 0x40, 0xe5,
-    // ?????? ??? ?????????? ????? ?????????? ???
-    0x0, 0x8, 0x37, 0x38, 0x3d, 0x3e, 0x40, 0xe5,
-    // ?????? ??? ?????????? ????? ?????????? ???
-    0x0, 0x8, 0x20, 0x21, 0x3d, 0x3e, 0x40, 0xe5,
-    // ?????? ??? ??????????? ????? ?????????? ???
-    0x0, 0x8, 0x10, 0x11, 0x3d, 0x3e, 0x40, 0xe5,
-    // ?????? ??? ?????? ????? ?????????? ???
-    0x0, 0x8, 0x39, 0x3d, 0x3e, 0x40, 0xe5,
-    // ?????? ??? ?????? ????? ?????????? ???
-    0x0, 0x8, 0x3c, 0x3d, 0x3e, 0x40, 0xe5,
-    // ?????? ??? ?????? ????? ?????????? ???
-    0x0, 0x8, 0x3b, 0x3d, 0x3e, 0x40, 0xe5,
-    // ?????? ??? ???? ????? ?????????? ???
-    0x0, 0x8, 0x35, 0x3d, 0x3e, 0x40, 0xe5,
-    // ?????? ??? ????? ????? ?????????? ???
-    0x0, 0x8, 0x29, 0x3d, 0x3e, 0x40, 0xe5,
-    // ?????? ??? ???? ????? ?????????? ???
-    0x0, 0x8, 0x34, 0x3d, 0x3e, 0x40, 0xe5,
-    // ?????? ??? ??????? ????? ?????????? ???
-    0x0, 0x8, 0x33, 0x3d, 0x3e, 0x40, 0xe5,
-    // ?????? ??? ???? ????? ?????????? ???
-    0x0, 0x8, 0x1e, 0x3d, 0x3e, 0x40, 0xe5,
-    // ?????? ??? ???? ????? ?????????? ???
-    0x0, 0x8, 0x36, 0x3d, 0x3e, 0x40, 0xe5,
-    // ?????? ??? ????? ?????? ?????????? ???
-    0x0, 0x8, 0x24, 0x32, 0x3e, 0x40, 0xe5,
-    // ?????? ???????
-    0x0, 0x9d,
-    // ?????? ???? ?????? ??????? ???
-    0x0, 0x18, 0x3a, 0x62, 0xe5,
-    // ?????? ??? ?????? ??????? ???
-    0x0, 0x16, 0x32, 0x62, 0xe5,
-    // ?????? ??? ?????? ??????? ???
-    0x0, 0x48, 0x4a, 0x62, 0xe5,
-    // ?????? ?????? ?????? ??????? ???
-    0x0, 0x46, 0x4a, 0x62, 0xe5,
-    // ?????? ???? ????? ??????? ???
-    0x0, 0x4c, 0x50, 0x62, 0xe5,
-    // ?????? ????? ????? ??????? ???
-    0x0, 0x47, 0x50, 0x62, 0xe5,
-    // ?????? ???? ????? ??????? ???
-    0x0, 0x4d, 0x50, 0x62, 0xe5,
-    // ?????? ?????? ????? ??????? ???
-    0x0, 0x45, 0x50, 0x62, 0xe5,
-    // ?????? ?????? ????? ??????? ???
-    0x0, 0x44, 0x50, 0x62, 0xe5,
-    // ?????? ?????? ????? ??????? ???
-    0x0, 0x43, 0x50, 0x62, 0xe5,
-    // ?????? ??????????? ????? ??????? ???
-    0x0, 0x41, 0x42, 0x50, 0x62, 0xe5,
-    // ?????? ?????????? ????? ??????? ???
-    0x0, 0x3e, 0x40, 0x50, 0x62, 0xe5,
-    // ?????? ?????????? ????? ??????? ???
-    0x0, 0x30, 0x31, 0x3d, 0x62, 0xe5,
-    // ?????? ???????????? ????? ??????? ???
-    0x0, 0xd, 0xe, 0x3d, 0x62, 0xe5,
-    // ?????? ???????? ??????? ???
-    0x0, 0x25, 0x26, 0x62, 0xe5,
-    // ?????? ??????????? ????? ??????? ???
-    0x0, 0x1, 0x2, 0x3d, 0x62, 0xe5,
-    // ?????? ?????????? ????? ??????? ???
-    0x0, 0x27, 0x28, 0x3d, 0x62, 0xe5,
-    // ?????? ???????????? ????? ??????? ???
-    0x0, 0x6, 0x7, 0x3d, 0x62, 0xe5,
-    // ?????? ???????????? ????? ??????? ???
-    0x0, 0xb, 0xc, 0x3d, 0x62, 0xe5,
-    // ?????? ???????? ????? ??????? ???
-    0x0, 0x4, 0x5, 0x3d, 0x62, 0xe5,
-    // ?????? ???????? ???? ?????? ??????? ???
-    0x0, 0x4, 0x5, 0x18, 0x3a, 0x62, 0xe5,
-    // ?????? ???????? ??? ?????? ??????? ???
-    0x0, 0x4, 0x5, 0x16, 0x32, 0x62, 0xe5,
-    // ?????? ???????? ??? ?????? ??????? ???
-    0x0, 0x4, 0x5, 0x48, 0x4a, 0x62, 0xe5,
-    // ?????? ???????? ?????? ?????? ??????? ???
-    0x0, 0x4, 0x5, 0x46, 0x4a, 0x62, 0xe5,
-    // ?????? ???????? ???? ????? ??????? ???
-    0x0, 0x4, 0x5, 0x4c, 0x50, 0x62, 0xe5,
-    // ?????? ???????? ????? ????? ??????? ???
-    0x0, 0x4, 0x5, 0x47, 0x50, 0x62, 0xe5,
-    // ?????? ???????? ???? ????? ??????? ???
-    0x0, 0x4, 0x5, 0x4d, 0x50, 0x62, 0xe5,
-    // ?????? ???????? ?????? ????? ??????? ???
-    0x0, 0x4, 0x5, 0x45, 0x50, 0x62, 0xe5,
-    // ?????? ???????? ?????? ????? ??????? ???
-    0x0, 0x4, 0x5, 0x44, 0x50, 0x62, 0xe5,
-    // ?????? ???????? ??????? ???
-    0x0, 0x22, 0x23, 0x62, 0xe5,
-    // ?????? ??? ???????? ?????? ????? ??? ???
-    0x0, 0x8, 0x12, 0x13, 0x3c, 0x3d, 0x4b, 0xe5,
-    // ?????? ??? ???????? ?????? ????? ??? ???
-    0x0, 0x8, 0x12, 0x13, 0x3b, 0x3d, 0x4b, 0xe5,
-    // ?????? ??? ???????? ???? ????? ??? ???
-    0x0, 0x8, 0x12, 0x13, 0x35, 0x3d, 0x4b, 0xe5,
-    // ?????? ??? ???????? ????? ????? ??? ???
-    0x0, 0x8, 0x12, 0x13, 0x29, 0x3d, 0x4b, 0xe5,
-    // ?????? ??? ???????? ???? ????? ??? ???
-    0x0, 0x8, 0x12, 0x13, 0x34, 0x3d, 0x4b, 0xe5,
-    // ?????? ??? ???????? ??????? ????? ??? ???
-    0x0, 0x8, 0x12, 0x13, 0x33, 0x3d, 0x4b, 0xe5,
-    // ?????? ??? ???????? ???? ????? ??? ???
-    0x0, 0x8, 0x12, 0x13, 0x1e, 0x3d, 0x4b, 0xe5,
-    // ?????? ??? ???????? ???? ????? ??? ???
-    0x0, 0x8, 0x12, 0x13, 0x36, 0x3d, 0x4b, 0xe5,
-    // ?????? ??? ???????? ????? ?????? ??? ???
-    0x0, 0x8, 0x12, 0x13, 0x24, 0x32, 0x4b, 0xe5,
-    // ?????? ??? ???????? ????? ??? ???
-    0x0, 0x8, 0x12, 0x13, 0x3d, 0x4b, 0xe5,
-    // ?????? ??? ???????????? ????? ??? ???
-    0x0, 0x8, 0x19, 0x1a, 0x3d, 0x4b, 0xe5,
-    // ?????? ??? ???????????? ????? ??? ???
-    0x0, 0x8, 0x1b, 0x1c, 0x3d, 0x4b, 0xe5,
-    // ?????? ??? ?????????? ????? ??? ???
-    0x0, 0x8, 0x2a, 0x2b, 0x3d, 0x4b, 0xe5,
-    // ?????? ??? ??????????? ????? ??? ???
-    0x0, 0x8, 0x9, 0xa, 0x3d, 0x4b, 0xe5,
-    // ?????? ??? ???????? ??? ???
-    0x0, 0x8, 0x2c, 0x2d, 0x4b, 0xe5,
-    // ?????? ??? ???????????? ????? ??? ???
-    0x0, 0x8, 0x14, 0x15, 0x3d, 0x4b, 0xe5,
-    // ?????? ??? ?????????? ????? ??? ???
-    0x0, 0x8, 0x37, 0x38, 0x3d, 0x4b, 0xe5,
-    // ?????? ??? ?????????? ????? ??? ???
-    0x0, 0x8, 0x20, 0x21, 0x3d, 0x4b, 0xe5,
-    // ?????? ??? ??????????? ????? ??? ???
-    0x0, 0x8, 0x10, 0x11, 0x3d, 0x4b, 0xe5,
-    // ?????? ??? ?????? ????? ??? ???
-    0x0, 0x8, 0x39, 0x3d, 0x4b, 0xe5,
-    // ?????? ??? ?????? ????? ??? ???
-    0x0, 0x8, 0x3c, 0x3d, 0x4b, 0xe5,
-    // ?????? ??? ?????? ????? ??? ???
-    0x0, 0x8, 0x3b, 0x3d, 0x4b, 0xe5,
-    // ?????? ??? ???? ????? ??? ???
-    0x0, 0x8, 0x35, 0x3d, 0x4b, 0xe5,
-    // ?????? ??? ????? ????? ??? ???
-    0x0, 0x8, 0x29, 0x3d, 0x4b, 0xe5,
-    // ?????? ??? ???? ????? ??? ???
-    0x0, 0x8, 0x34, 0x3d, 0x4b, 0xe5,
-    // ?????? ??? ??????? ????? ??? ???
-    0x0, 0x8, 0x33, 0x3d, 0x4b, 0xe5,
-    // ?????? ??? ???? ????? ??? ???
-    0x0, 0x8, 0x1e, 0x3d, 0x4b, 0xe5,
-    // ?????? ??? ???? ????? ??? ???
-    0x0, 0x8, 0x36, 0x3d, 0x4b, 0xe5,
-    // ?????? ??? ????? ?????? ??? ???
-    0x0, 0x8, 0x24, 0x32, 0x4b, 0xe5,
-    // ?????? ????? ???? ??? ???
-    0x0, 0x3, 0x2e, 0x4b, 0xe5,
-    // ?????? ???? ?????? ??????? ???
-    0x0, 0x18, 0x3a, 0x64, 0xe5,
-    // ?????? ??? ?????? ??????? ???
-    0x0, 0x16, 0x32, 0x64, 0xe5,
-    // ?????? ??? ?????? ??????? ???
-    0x0, 0x48, 0x4a, 0x64, 0xe5,
-    // ?????? ?????? ?????? ??????? ???
-    0x0, 0x46, 0x4a, 0x64, 0xe5,
-    // ?????? ???? ????? ??????? ???
-    0x0, 0x4c, 0x50, 0x64, 0xe5,
-    // ?????? ????? ????? ??????? ???
-    0x0, 0x47, 0x50, 0x64, 0xe5,
-    // ?????? ???? ????? ??????? ???
-    0x0, 0x4d, 0x50, 0x64, 0xe5,
-    // ?????? ?????? ????? ??????? ???
-    0x0, 0x45, 0x50, 0x64, 0xe5,
-    // ?????? ?????? ????? ??????? ???
-    0x0, 0x44, 0x50, 0x64, 0xe5,
-    // ?????? ?????? ????? ??????? ???
-    0x0, 0x43, 0x50, 0x64, 0xe5,
-    // ?????? ??????????? ????? ??????? ???
-    0x0, 0x41, 0x42, 0x50, 0x64, 0xe5,
-    // ?????? ?????????? ????? ??????? ???
-    0x0, 0x3e, 0x40, 0x50, 0x64, 0xe5,
-    // ?????? ?????????? ????? ??????? ???
-    0x0, 0x30, 0x31, 0x3d, 0x64, 0xe5,
-    // ?????? ???????????? ????? ??????? ???
-    0x0, 0xd, 0xe, 0x3d, 0x64, 0xe5,
-    // ?????? ???????? ??????? ???
-    0x0, 0x25, 0x26, 0x64, 0xe5,
-    // ?????? ??????????? ????? ??????? ???
-    0x0, 0x1, 0x2, 0x3d, 0x64, 0xe5,
-    // ?????? ?????????? ????? ??????? ???
-    0x0, 0x27, 0x28, 0x3d, 0x64, 0xe5,
-    // ?????? ???????????? ????? ??????? ???
-    0x0, 0x6, 0x7, 0x3d, 0x64, 0xe5,
-    // ?????? ???????????? ????? ??????? ???
-    0x0, 0xb, 0xc, 0x3d, 0x64, 0xe5,
-    // ?????? ???????? ????? ??????? ???
-    0x0, 0x4, 0x5, 0x3d, 0x64, 0xe5,
-    // ?????? ???????? ???? ?????? ??????? ???
-    0x0, 0x4, 0x5, 0x18, 0x3a, 0x64, 0xe5,
-    // ?????? ???????? ??? ?????? ??????? ???
-    0x0, 0x4, 0x5, 0x16, 0x32, 0x64, 0xe5,
-    // ?????? ???????? ??? ?????? ??????? ???
-    0x0, 0x4, 0x5, 0x48, 0x4a, 0x64, 0xe5,
-    // ?????? ???????? ?????? ?????? ??????? ???
-    0x0, 0x4, 0x5, 0x46, 0x4a, 0x64, 0xe5,
-    // ?????? ???????? ???? ????? ??????? ???
-    0x0, 0x4, 0x5, 0x4c, 0x50, 0x64, 0xe5,
-    // ?????? ???????? ????? ????? ??????? ???
-    0x0, 0x4, 0x5, 0x47, 0x50, 0x64, 0xe5,
-    // ?????? ???????? ???? ????? ??????? ???
-    0x0, 0x4, 0x5, 0x4d, 0x50, 0x64, 0xe5,
-    // ?????? ???????? ?????? ????? ??????? ???
-    0x0, 0x4, 0x5, 0x45, 0x50, 0x64, 0xe5,
-    // ?????? ???????? ?????? ????? ??????? ???
-    0x0, 0x4, 0x5, 0x44, 0x50, 0x64, 0xe5,
-    // ?????? ???????? ??????? ???
-    0x0, 0x22, 0x23, 0x64, 0xe5,
-    // ?????? ??? ???????? ?????? ????? ??? ???? ???
-    0x0, 0x8, 0x12, 0x13, 0x3c, 0x3d, 0x49, 0x4e, 0xe5,
-    // ?????? ??? ???????? ?????? ????? ??? ???? ???
-    0x0, 0x8, 0x12, 0x13, 0x3b, 0x3d, 0x49, 0x4e, 0xe5,
-    // ?????? ??? ???????? ???? ????? ??? ???? ???
-    0x0, 0x8, 0x12, 0x13, 0x35, 0x3d, 0x49, 0x4e, 0xe5,
-    // ?????? ??? ???????? ????? ????? ??? ???? ???
-    0x0, 0x8, 0x12, 0x13, 0x29, 0x3d, 0x49, 0x4e, 0xe5,
-    // ?????? ??? ???????? ???? ????? ??? ???? ???
-    0x0, 0x8, 0x12, 0x13, 0x34, 0x3d, 0x49, 0x4e, 0xe5,
-    // ?????? ??? ???????? ??????? ????? ??? ???? ???
-    0x0, 0x8, 0x12, 0x13, 0x33, 0x3d, 0x49, 0x4e, 0xe5,
-    // ?????? ??? ???????? ???? ????? ??? ???? ???
-    0x0, 0x8, 0x12, 0x13, 0x1e, 0x3d, 0x49, 0x4e, 0xe5,
-    // ?????? ??? ???????? ???? ????? ??? ???? ???
-    0x0, 0x8, 0x12, 0x13, 0x36, 0x3d, 0x49, 0x4e, 0xe5,
-    // ?????? ??? ???????? ????? ?????? ??? ???? ???
-    0x0, 0x8, 0x12, 0x13, 0x24, 0x32, 0x49, 0x4e, 0xe5,
-    // ?????? ??? ???????? ????? ??? ???? ???
-    0x0, 0x8, 0x12, 0x13, 0x3d, 0x49, 0x4e, 0xe5,
-    // ?????? ??? ???????????? ????? ??? ???? ???
-    0x0, 0x8, 0x19, 0x1a, 0x3d, 0x49, 0x4e, 0xe5,
-    // ?????? ??? ???????????? ????? ??? ???? ???
-    0x0, 0x8, 0x1b, 0x1c, 0x3d, 0x49, 0x4e, 0xe5,
-    // ?????? ??? ?????????? ????? ??? ???? ???
-    0x0, 0x8, 0x2a, 0x2b, 0x3d, 0x49, 0x4e, 0xe5,
-    // ?????? ??? ??????????? ????? ??? ???? ???
-    0x0, 0x8, 0x9, 0xa, 0x3d, 0x49, 0x4e, 0xe5,
-    // ?????? ??? ???????? ??? ???? ???
-    0x0, 0x8, 0x2c, 0x2d, 0x49, 0x4e, 0xe5,
-    // ?????? ??? ???????????? ????? ??? ???? ???
-    0x0, 0x8, 0x14, 0x15, 0x3d, 0x49, 0x4e, 0xe5,
-    // ?????? ??? ?????????? ????? ??? ???? ???
-    0x0, 0x8, 0x37, 0x38, 0x3d, 0x49, 0x4e, 0xe5,
-    // ?????? ??? ?????????? ????? ??? ???? ???
-    0x0, 0x8, 0x20, 0x21, 0x3d, 0x49, 0x4e, 0xe5,
-    // ?????? ??? ??????????? ????? ??? ???? ???
-    0x0, 0x8, 0x10, 0x11, 0x3d, 0x49, 0x4e, 0xe5,
-    // ?????? ??? ?????? ????? ??? ???? ???
-    0x0, 0x8, 0x39, 0x3d, 0x49, 0x4e, 0xe5,
-    // ?????? ??? ?????? ????? ??? ???? ???
-    0x0, 0x8, 0x3c, 0x3d, 0x49, 0x4e, 0xe5,
-    // ?????? ??? ?????? ????? ??? ???? ???
-    0x0, 0x8, 0x3b, 0x3d, 0x49, 0x4e, 0xe5,
-    // ?????? ??? ???? ????? ??? ???? ???
-    0x0, 0x8, 0x35, 0x3d, 0x49, 0x4e, 0xe5,
-    // ?????? ??? ????? ????? ??? ???? ???
-    0x0, 0x8, 0x29, 0x3d, 0x49, 0x4e, 0xe5,
-    // ?????? ??? ???? ????? ??? ???? ???
-    0x0, 0x8, 0x34, 0x3d, 0x49, 0x4e, 0xe5,
-    // ?????? ??? ??????? ????? ??? ???? ???
-    0x0, 0x8, 0x33, 0x3d, 0x49, 0x4e, 0xe5,
-    // ?????? ??? ???? ????? ??? ???? ???
-    0x0, 0x8, 0x1e, 0x3d, 0x49, 0x4e, 0xe5,
-    // ?????? ??? ???? ????? ??? ???? ???
-    0x0, 0x8, 0x36, 0x3d, 0x49, 0x4e, 0xe5,
-    // ?????? ??? ????? ?????? ??? ???? ???
-    0x0, 0x8, 0x24, 0x32, 0x49, 0x4e, 0xe5,
-    // ?????? ????? ??? ???? ???
-    0x0, 0x3, 0x49, 0x4e, 0xe5,
-    // ?????? ???? ?????? ???????? ???
-    0x0, 0x18, 0x3a, 0x59, 0x5a, 0xe5,
-    // ?????? ??? ?????? ???????? ???
-    0x0, 0x16, 0x32, 0x59, 0x5a, 0xe5,
-    // ?????? ??? ?????? ???????? ???
-    0x0, 0x48, 0x4a, 0x59, 0x5a, 0xe5,
-    // ?????? ?????? ?????? ???????? ???
-    0x0, 0x46, 0x4a, 0x59, 0x5a, 0xe5,
-    // ?????? ???? ????? ???????? ???
-    0x0, 0x4c, 0x50, 0x59, 0x5a, 0xe5,
-    // ?????? ????? ????? ???????? ???
-    0x0, 0x47, 0x50, 0x59, 0x5a, 0xe5,
-    // ?????? ???? ????? ???????? ???
-    0x0, 0x4d, 0x50, 0x59, 0x5a, 0xe5,
-    // ?????? ?????? ????? ???????? ???
-    0x0, 0x45, 0x50, 0x59, 0x5a, 0xe5,
-    // ?????? ?????? ????? ???????? ???
-    0x0, 0x44, 0x50, 0x59, 0x5a, 0xe5,
-    // ?????? ?????? ????? ???????? ???
-    0x0, 0x43, 0x50, 0x59, 0x5a, 0xe5,
-    // ?????? ??????????? ????? ???????? ???
-    0x0, 0x41, 0x42, 0x50, 0x59, 0x5a, 0xe5,
-    // ?????? ?????????? ????? ???????? ???
-    0x0, 0x3e, 0x40, 0x50, 0x59, 0x5a, 0xe5,
-    // ?????? ?????????? ????? ???????? ???
-    0x0, 0x30, 0x31, 0x3d, 0x59, 0x5a, 0xe5,
-    // ?????? ???????????? ????? ???????? ???
-    0x0, 0xd, 0xe, 0x3d, 0x59, 0x5a, 0xe5,
-    // ?????? ???????? ???????? ???
-    0x0, 0x25, 0x26, 0x59, 0x5a, 0xe5,
-    // ?????? ??????????? ????? ???????? ???
-    0x0, 0x1, 0x2, 0x3d, 0x59, 0x5a, 0xe5,
-    // ?????? ?????????? ????? ???????? ???
-    0x0, 0x27, 0x28, 0x3d, 0x59, 0x5a, 0xe5,
-    // ?????? ???????????? ????? ???????? ???
-    0x0, 0x6, 0x7, 0x3d, 0x59, 0x5a, 0xe5,
-    // ?????? ???????????? ????? ???????? ???
-    0x0, 0xb, 0xc, 0x3d, 0x59, 0x5a, 0xe5,
-    // ?????? ???????? ????? ???????? ???
-    0x0, 0x4, 0x5, 0x3d, 0x59, 0x5a, 0xe5,
-    // ?????? ???????? ???? ?????? ???????? ???
-    0x0, 0x4, 0x5, 0x18, 0x3a, 0x59, 0x5a, 0xe5,
-    // ?????? ???????? ??? ?????? ???????? ???
-    0x0, 0x4, 0x5, 0x16, 0x32, 0x59, 0x5a, 0xe5,
-    // ?????? ???????? ??? ?????? ???????? ???
-    0x0, 0x4, 0x5, 0x48, 0x4a, 0x59, 0x5a, 0xe5,
-    // ?????? ???????? ?????? ?????? ???????? ???
-    0x0, 0x4, 0x5, 0x46, 0x4a, 0x59, 0x5a, 0xe5,
-    // ?????? ???????? ???? ????? ???????? ???
-    0x0, 0x4, 0x5, 0x4c, 0x50, 0x59, 0x5a, 0xe5,
-    // ?????? ???????? ????? ????? ???????? ???
-    0x0, 0x4, 0x5, 0x47, 0x50, 0x59, 0x5a, 0xe5,
-    // ?????? ???????? ???? ????? ???????? ???
-    0x0, 0x4, 0x5, 0x4d, 0x50, 0x59, 0x5a, 0xe5,
-    // ?????? ???????? ?????? ????? ???????? ???
-    0x0, 0x4, 0x5, 0x45, 0x50, 0x59, 0x5a, 0xe5,
-    // ?????? ???????? ?????? ????? ???????? ???
-    0x0, 0x4, 0x5, 0x44, 0x50, 0x59, 0x5a, 0xe5,
-    // ?????? ???????? ???????? ???
-    0x0, 0x22, 0x23, 0x59, 0x5a, 0xe5,
-    // ?????? ??? ???????? ?????? ????? ??? ???? ???
-    0x0, 0x8, 0x12, 0x13, 0x3c, 0x3d, 0x48, 0x4e, 0xe5,
-    // ?????? ??? ???????? ?????? ????? ??? ???? ???
-    0x0, 0x8, 0x12, 0x13, 0x3b, 0x3d, 0x48, 0x4e, 0xe5,
-    // ?????? ??? ???????? ???? ????? ??? ???? ???
-    0x0, 0x8, 0x12, 0x13, 0x35, 0x3d, 0x48, 0x4e, 0xe5,
-    // ?????? ??? ???????? ????? ????? ??? ???? ???
-    0x0, 0x8, 0x12, 0x13, 0x29, 0x3d, 0x48, 0x4e, 0xe5,
-    // ?????? ??? ???????? ???? ????? ??? ???? ???
-    0x0, 0x8, 0x12, 0x13, 0x34, 0x3d, 0x48, 0x4e, 0xe5,
-    // ?????? ??? ???????? ??????? ????? ??? ???? ???
-    0x0, 0x8, 0x12, 0x13, 0x33, 0x3d, 0x48, 0x4e, 0xe5,
-    // ?????? ??? ???????? ???? ????? ??? ???? ???
-    0x0, 0x8, 0x12, 0x13, 0x1e, 0x3d, 0x48, 0x4e, 0xe5,
-    // ?????? ??? ???????? ???? ????? ??? ???? ???
-    0x0, 0x8, 0x12, 0x13, 0x36, 0x3d, 0x48, 0x4e, 0xe5,
-    // ?????? ??? ???????? ????? ?????? ??? ???? ???
-    0x0, 0x8, 0x12, 0x13, 0x24, 0x32, 0x48, 0x4e, 0xe5,
-    // ?????? ??? ???????? ????? ??? ???? ???
-    0x0, 0x8, 0x12, 0x13, 0x3d, 0x48, 0x4e, 0xe5,
-    // ?????? ??? ???????????? ????? ??? ???? ???
-    0x0, 0x8, 0x19, 0x1a, 0x3d, 0x48, 0x4e, 0xe5,
-    // ?????? ??? ???????????? ????? ??? ???? ???
-    0x0, 0x8, 0x1b, 0x1c, 0x3d, 0x48, 0x4e, 0xe5,
-    // ?????? ??? ?????????? ????? ??? ???? ???
-    0x0, 0x8, 0x2a, 0x2b, 0x3d, 0x48, 0x4e, 0xe5,
-    // ?????? ??? ??????????? ????? ??? ???? ???
-    0x0, 0x8, 0x9, 0xa, 0x3d, 0x48, 0x4e, 0xe5,
-    // ?????? ??? ???????? ??? ???? ???
-    0x0, 0x8, 0x2c, 0x2d, 0x48, 0x4e, 0xe5,
-    // ?????? ??? ???????????? ????? ??? ???? ???
-    0x0, 0x8, 0x14, 0x15, 0x3d, 0x48, 0x4e, 0xe5,
-    // ?????? ??? ?????????? ????? ??? ???? ???
-    0x0, 0x8, 0x37, 0x38, 0x3d, 0x48, 0x4e, 0xe5,
-    // ?????? ??? ?????????? ????? ??? ???? ???
-    0x0, 0x8, 0x20, 0x21, 0x3d, 0x48, 0x4e, 0xe5,
-    // ?????? ??? ??????????? ????? ??? ???? ???
-    0x0, 0x8, 0x10, 0x11, 0x3d, 0x48, 0x4e, 0xe5,
-    // ?????? ??? ?????? ????? ??? ???? ???
-    0x0, 0x8, 0x39, 0x3d, 0x48, 0x4e, 0xe5,
-    // ?????? ??? ?????? ????? ??? ???? ???
-    0x0, 0x8, 0x3c, 0x3d, 0x48, 0x4e, 0xe5,
-    // ?????? ??? ?????? ????? ??? ???? ???
-    0x0, 0x8, 0x3b, 0x3d, 0x48, 0x4e, 0xe5,
-    // ?????? ??? ???? ????? ??? ???? ???
-    0x0, 0x8, 0x35, 0x3d, 0x48, 0x4e, 0xe5,
-    // ?????? ??? ????? ????? ??? ???? ???
-    0x0, 0x8, 0x29, 0x3d, 0x48, 0x4e, 0xe5,
-    // ?????? ??? ???? ????? ??? ???? ???
-    0x0, 0x8, 0x34, 0x3d, 0x48, 0x4e, 0xe5,
-    // ?????? ??? ??????? ????? ??? ???? ???
-    0x0, 0x8, 0x33, 0x3d, 0x48, 0x4e, 0xe5,
-    // ?????? ??? ???? ????? ??? ???? ???
-    0x0, 0x8, 0x1e, 0x3d, 0x48, 0x4e, 0xe5,
-    // ?????? ??? ???? ????? ??? ???? ???
-    0x0, 0x8, 0x36, 0x3d, 0x48, 0x4e, 0xe5,
-    // ?????? ??? ????? ?????? ??? ???? ???
-    0x0, 0x8, 0x24, 0x32, 0x48, 0x4e, 0xe5,
-    // ?????? ????? ??? ???? ???
-    0x0, 0x3, 0x48, 0x4e, 0xe5,
-    // ?????? ???? ?????? ?????????? ???
-    0x0, 0x18, 0x3a, 0x56, 0x57, 0xe5,
-    // ?????? ??? ?????? ?????????? ???
-    0x0, 0x16, 0x32, 0x56, 0x57, 0xe5,
-    // ?????? ??? ?????? ?????????? ???
-    0x0, 0x48, 0x4a, 0x56, 0x57, 0xe5,
-    // ?????? ?????? ?????? ?????????? ???
-    0x0, 0x46, 0x4a, 0x56, 0x57, 0xe5,
-    // ?????? ???? ????? ?????????? ???
-    0x0, 0x4c, 0x50, 0x56, 0x57, 0xe5,
-    // ?????? ????? ????? ?????????? ???
-    0x0, 0x47, 0x50, 0x56, 0x57, 0xe5,
-    // ?????? ???? ????? ?????????? ???
-    0x0, 0x4d, 0x50, 0x56, 0x57, 0xe5,
-    // ?????? ?????? ????? ?????????? ???
-    0x0, 0x45, 0x50, 0x56, 0x57, 0xe5,
-    // ?????? ?????? ????? ?????????? ???
-    0x0, 0x44, 0x50, 0x56, 0x57, 0xe5,
-    // ?????? ?????? ????? ?????????? ???
-    0x0, 0x43, 0x50, 0x56, 0x57, 0xe5,
-    // ?????? ??????????? ????? ?????????? ???
-    0x0, 0x41, 0x42, 0x50, 0x56, 0x57, 0xe5,
-    // ?????? ?????????? ????? ?????????? ???
-    0x0, 0x3e, 0x40, 0x50, 0x56, 0x57, 0xe5,
-    // ?????? ?????????? ????? ?????????? ???
-    0x0, 0x30, 0x31, 0x3d, 0x56, 0x57, 0xe5,
-    // ?????? ???????????? ????? ?????????? ???
-    0x0, 0xd, 0xe, 0x3d, 0x56, 0x57, 0xe5,
-    // ?????? ???????? ?????????? ???
-    0x0, 0x25, 0x26, 0x56, 0x57, 0xe5,
-    // ?????? ??????????? ????? ?????????? ???
-    0x0, 0x1, 0x2, 0x3d, 0x56, 0x57, 0xe5,
-    // ?????? ?????????? ????? ?????????? ???
-    0x0, 0x27, 0x28, 0x3d, 0x56, 0x57, 0xe5,
-    // ?????? ???????????? ????? ?????????? ???
-    0x0, 0x6, 0x7, 0x3d, 0x56, 0x57, 0xe5,
-    // ?????? ???????????? ????? ?????????? ???
-    0x0, 0xb, 0xc, 0x3d, 0x56, 0x57, 0xe5,
-    // ?????? ???????? ????? ?????????? ???
-    0x0, 0x4, 0x5, 0x3d, 0x56, 0x57, 0xe5,
-    // ?????? ???????? ???? ?????? ?????????? ???
-    0x0, 0x4, 0x5, 0x18, 0x3a, 0x56, 0x57, 0xe5,
-    // ?????? ???????? ??? ?????? ?????????? ???
-    0x0, 0x4, 0x5, 0x16, 0x32, 0x56, 0x57, 0xe5,
-    // ?????? ???????? ??? ?????? ?????????? ???
-    0x0, 0x4, 0x5, 0x48, 0x4a, 0x56, 0x57, 0xe5,
-    // ?????? ???????? ?????? ?????? ?????????? ???
-    0x0, 0x4, 0x5, 0x46, 0x4a, 0x56, 0x57, 0xe5,
-    // ?????? ???????? ???? ????? ?????????? ???
-    0x0, 0x4, 0x5, 0x4c, 0x50, 0x56, 0x57, 0xe5,
-    // ?????? ???????? ????? ????? ?????????? ???
-    0x0, 0x4, 0x5, 0x47, 0x50, 0x56, 0x57, 0xe5,
-    // ?????? ???????? ???? ????? ?????????? ???
-    0x0, 0x4, 0x5, 0x4d, 0x50, 0x56, 0x57, 0xe5,
-    // ?????? ???????? ?????? ????? ?????????? ???
-    0x0, 0x4, 0x5, 0x45, 0x50, 0x56, 0x57, 0xe5,
-    // ?????? ???????? ?????? ????? ?????????? ???
-    0x0, 0x4, 0x5, 0x44, 0x50, 0x56, 0x57, 0xe5,
-    // ?????? ???????? ?????????? ???
-    0x0, 0x22, 0x23, 0x56, 0x57, 0xe5,
-    // ?????? ??? ???????? ?????? ????? ?????? ???? ???
-    0x0, 0x8, 0x12, 0x13, 0x3c, 0x3d, 0x46, 0x4e, 0xe5,
-    // ?????? ??? ???????? ?????? ????? ?????? ???? ???
-    0x0, 0x8, 0x12, 0x13, 0x3b, 0x3d, 0x46, 0x4e, 0xe5,
-    // ?????? ??? ???????? ???? ????? ?????? ???? ???
-    0x0, 0x8, 0x12, 0x13, 0x35, 0x3d, 0x46, 0x4e, 0xe5,
-    // ?????? ??? ???????? ????? ????? ?????? ???? ???
-    0x0, 0x8, 0x12, 0x13, 0x29, 0x3d, 0x46, 0x4e, 0xe5,
-    // ?????? ??? ???????? ???? ????? ?????? ???? ???
-    0x0, 0x8, 0x12, 0x13, 0x34, 0x3d, 0x46, 0x4e, 0xe5,
-    // ?????? ??? ???????? ??????? ????? ?????? ???? ???
-    0x0, 0x8, 0x12, 0x13, 0x33, 0x3d, 0x46, 0x4e, 0xe5,
-    // ?????? ??? ???????? ???? ????? ?????? ???? ???
-    0x0, 0x8, 0x12, 0x13, 0x1e, 0x3d, 0x46, 0x4e, 0xe5,
-    // ?????? ??? ???????? ???? ????? ?????? ???? ???
-    0x0, 0x8, 0x12, 0x13, 0x36, 0x3d, 0x46, 0x4e, 0xe5,
-    // ?????? ??? ???????? ????? ?????? ?????? ???? ???
-    0x0, 0x8, 0x12, 0x13, 0x24, 0x32, 0x46, 0x4e, 0xe5,
-    // ?????? ??? ???????? ????? ?????? ???? ???
-    0x0, 0x8, 0x12, 0x13, 0x3d, 0x46, 0x4e, 0xe5,
-    // ?????? ??? ???????????? ????? ?????? ???? ???
-    0x0, 0x8, 0x19, 0x1a, 0x3d, 0x46, 0x4e, 0xe5,
-    // ?????? ??? ???????????? ????? ?????? ???? ???
-    0x0, 0x8, 0x1b, 0x1c, 0x3d, 0x46, 0x4e, 0xe5,
-    // ?????? ??? ?????????? ????? ?????? ???? ???
-    0x0, 0x8, 0x2a, 0x2b, 0x3d, 0x46, 0x4e, 0xe5,
-    // ?????? ??? ??????????? ????? ?????? ???? ???
-    0x0, 0x8, 0x9, 0xa, 0x3d, 0x46, 0x4e, 0xe5,
-    // ?????? ??? ???????? ?????? ???? ???
-    0x0, 0x8, 0x2c, 0x2d, 0x46, 0x4e, 0xe5,
-    // ?????? ??? ???????????? ????? ?????? ???? ???
-    0x0, 0x8, 0x14, 0x15, 0x3d, 0x46, 0x4e, 0xe5,
-    // ?????? ??? ?????????? ????? ?????? ???? ???
-    0x0, 0x8, 0x37, 0x38, 0x3d, 0x46, 0x4e, 0xe5,
-    // ?????? ??? ?????????? ????? ?????? ???? ???
-    0x0, 0x8, 0x20, 0x21, 0x3d, 0x46, 0x4e, 0xe5,
-    // ?????? ??? ??????????? ????? ?????? ???? ???
-    0x0, 0x8, 0x10, 0x11, 0x3d, 0x46, 0x4e, 0xe5,
-    // ?????? ??? ?????? ????? ?????? ???? ???
-    0x0, 0x8, 0x39, 0x3d, 0x46, 0x4e, 0xe5,
-    // ?????? ??? ?????? ????? ?????? ???? ???
-    0x0, 0x8, 0x3c, 0x3d, 0x46, 0x4e, 0xe5,
-    // ?????? ??? ?????? ????? ?????? ???? ???
-    0x0, 0x8, 0x3b, 0x3d, 0x46, 0x4e, 0xe5,
-    // ?????? ??? ???? ????? ?????? ???? ???
-    0x0, 0x8, 0x35, 0x3d, 0x46, 0x4e, 0xe5,
-    // ?????? ??? ????? ????? ?????? ???? ???
-    0x0, 0x8, 0x29, 0x3d, 0x46, 0x4e, 0xe5,
-    // ?????? ??? ???? ????? ?????? ???? ???
-    0x0, 0x8, 0x34, 0x3d, 0x46, 0x4e, 0xe5,
-    // ?????? ??? ??????? ????? ?????? ???? ???
-    0x0, 0x8, 0x33, 0x3d, 0x46, 0x4e, 0xe5,
-    // ?????? ??? ???? ????? ?????? ???? ???
-    0x0, 0x8, 0x1e, 0x3d, 0x46, 0x4e, 0xe5,
-    // ?????? ??? ???? ????? ?????? ???? ???
-    0x0, 0x8, 0x36, 0x3d, 0x46, 0x4e, 0xe5,
-    // ?????? ??? ????? ?????? ?????? ???? ???
-    0x0, 0x8, 0x24, 0x32, 0x46, 0x4e, 0xe5,
-    // ?????? ????? ?????? ???? ???
-    0x0, 0x3, 0x46, 0x4e, 0xe5,
-    // ?????? ???? ?????? ?????? ???
-    0x0, 0x18, 0x3a, 0x63, 0xe5,
-    // ?????? ??? ?????? ?????? ???
-    0x0, 0x16, 0x32, 0x63, 0xe5,
-    // ?????? ??? ?????? ?????? ???
-    0x0, 0x48, 0x4a, 0x63, 0xe5,
-    // ?????? ?????? ?????? ?????? ???
-    0x0, 0x46, 0x4a, 0x63, 0xe5,
-    // ?????? ???? ????? ?????? ???
-    0x0, 0x4c, 0x50, 0x63, 0xe5,
-    // ?????? ????? ????? ?????? ???
-    0x0, 0x47, 0x50, 0x63, 0xe5,
-    // ?????? ???? ????? ?????? ???
-    0x0, 0x4d, 0x50, 0x63, 0xe5,
-    // ?????? ?????? ????? ?????? ???
-    0x0, 0x45, 0x50, 0x63, 0xe5,
-    // ?????? ?????? ????? ?????? ???
-    0x0, 0x44, 0x50, 0x63, 0xe5,
-    // ?????? ?????? ????? ?????? ???
-    0x0, 0x43, 0x50, 0x63, 0xe5,
-    // ?????? ??????????? ????? ?????? ???
-    0x0, 0x41, 0x42, 0x50, 0x63, 0xe5,
-    // ?????? ?????????? ????? ?????? ???
-    0x0, 0x3e, 0x40, 0x50, 0x63, 0xe5,
-    // ?????? ?????????? ????? ?????? ???
-    0x0, 0x30, 0x31, 0x3d, 0x63, 0xe5,
-    // ?????? ???????????? ????? ?????? ???
-    0x0, 0xd, 0xe, 0x3d, 0x63, 0xe5,
-    // ?????? ???????? ?????? ???
-    0x0, 0x25, 0x26, 0x63, 0xe5,
-    // ?????? ??????????? ????? ?????? ???
-    0x0, 0x1, 0x2, 0x3d, 0x63, 0xe5,
-    // ?????? ?????????? ????? ?????? ???
-    0x0, 0x27, 0x28, 0x3d, 0x63, 0xe5,
-    // ?????? ???????????? ????? ?????? ???
-    0x0, 0x6, 0x7, 0x3d, 0x63, 0xe5,
-    // ?????? ???????????? ????? ?????? ???
-    0x0, 0xb, 0xc, 0x3d, 0x63, 0xe5,
-    // ?????? ???????? ????? ?????? ???
-    0x0, 0x4, 0x5, 0x3d, 0x63, 0xe5,
-    // ?????? ???????? ???? ?????? ?????? ???
-    0x0, 0x4, 0x5, 0x18, 0x3a, 0x63, 0xe5,
-    // ?????? ???????? ??? ?????? ?????? ???
-    0x0, 0x4, 0x5, 0x16, 0x32, 0x63, 0xe5,
-    // ?????? ???????? ??? ?????? ?????? ???
-    0x0, 0x4, 0x5, 0x48, 0x4a, 0x63, 0xe5,
-    // ?????? ???????? ?????? ?????? ?????? ???
-    0x0, 0x4, 0x5, 0x46, 0x4a, 0x63, 0xe5,
-    // ?????? ???????? ???? ????? ?????? ???
-    0x0, 0x4, 0x5, 0x4c, 0x50, 0x63, 0xe5,
-    // ?????? ???????? ????? ????? ?????? ???
-    0x0, 0x4, 0x5, 0x47, 0x50, 0x63, 0xe5,
-    // ?????? ???????? ???? ????? ?????? ???
-    0x0, 0x4, 0x5, 0x4d, 0x50, 0x63, 0xe5,
-    // ?????? ???????? ?????? ????? ?????? ???
-    0x0, 0x4, 0x5, 0x45, 0x50, 0x63, 0xe5,
-    // ?????? ???????? ?????? ????? ?????? ???
-    0x0, 0x4, 0x5, 0x44, 0x50, 0x63, 0xe5,
-    // ?????? ???????? ?????? ???
-    0x0, 0x22, 0x23, 0x63, 0xe5,
-    // ?????? ??? ???????? ?????? ????? ???? ???
-    0x0, 0x8, 0x12, 0x13, 0x3c, 0x3d, 0x4c, 0xe5,
-    // ?????? ??? ???????? ?????? ????? ???? ???
-    0x0, 0x8, 0x12, 0x13, 0x3b, 0x3d, 0x4c, 0xe5,
-    // ?????? ??? ???????? ???? ????? ???? ???
-    0x0, 0x8, 0x12, 0x13, 0x35, 0x3d, 0x4c, 0xe5,
-    // ?????? ??? ???????? ????? ????? ???? ???
-    0x0, 0x8, 0x12, 0x13, 0x29, 0x3d, 0x4c, 0xe5,
-    // ?????? ??? ???????? ???? ????? ???? ???
-    0x0, 0x8, 0x12, 0x13, 0x34, 0x3d, 0x4c, 0xe5,
-    // ?????? ??? ???????? ??????? ????? ???? ???
-    0x0, 0x8, 0x12, 0x13, 0x33, 0x3d, 0x4c, 0xe5,
-    // ?????? ??? ???????? ???? ????? ???? ???
-    0x0, 0x8, 0x12, 0x13, 0x1e, 0x3d, 0x4c, 0xe5,
-    // ?????? ??? ???????? ???? ????? ???? ???
-    0x0, 0x8, 0x12, 0x13, 0x36, 0x3d, 0x4c, 0xe5,
-    // ?????? ??? ???????? ????? ?????? ???? ???
-    0x0, 0x8, 0x12, 0x13, 0x24, 0x32, 0x4c, 0xe5,
-    // ?????? ??? ???????? ????? ???? ???
-    0x0, 0x8, 0x12, 0x13, 0x3d, 0x4c, 0xe5,
-    // ?????? ??? ???????????? ????? ???? ???
-    0x0, 0x8, 0x19, 0x1a, 0x3d, 0x4c, 0xe5,
-    // ?????? ??? ???????????? ????? ???? ???
-    0x0, 0x8, 0x1b, 0x1c, 0x3d, 0x4c, 0xe5,
-    // ?????? ??? ?????????? ????? ???? ???
-    0x0, 0x8, 0x2a, 0x2b, 0x3d, 0x4c, 0xe5,
-    // ?????? ??? ??????????? ????? ???? ???
-    0x0, 0x8, 0x9, 0xa, 0x3d, 0x4c, 0xe5,
-    // ?????? ??? ???????? ???? ???
-    0x0, 0x8, 0x2c, 0x2d, 0x4c, 0xe5,
-    // ?????? ??? ???????????? ????? ???? ???
-    0x0, 0x8, 0x14, 0x15, 0x3d, 0x4c, 0xe5,
-    // ?????? ??? ?????????? ????? ???? ???
-    0x0, 0x8, 0x37, 0x38, 0x3d, 0x4c, 0xe5,
-    // ?????? ??? ?????????? ????? ???? ???
-    0x0, 0x8, 0x20, 0x21, 0x3d, 0x4c, 0xe5,
-    // ?????? ??? ??????????? ????? ???? ???
-    0x0, 0x8, 0x10, 0x11, 0x3d, 0x4c, 0xe5,
-    // ?????? ??? ?????? ????? ???? ???
-    0x0, 0x8, 0x39, 0x3d, 0x4c, 0xe5,
-    // ?????? ??? ?????? ????? ???? ???
-    0x0, 0x8, 0x3c, 0x3d, 0x4c, 0xe5,
-    // ?????? ??? ?????? ????? ???? ???
-    0x0, 0x8, 0x3b, 0x3d, 0x4c, 0xe5,
-    // ?????? ??? ???? ????? ???? ???
-    0x0, 0x8, 0x35, 0x3d, 0x4c, 0xe5,
-    // ?????? ??? ????? ????? ???? ???
-    0x0, 0x8, 0x29, 0x3d, 0x4c, 0xe5,
-    // ?????? ??? ???? ????? ???? ???
-    0x0, 0x8, 0x34, 0x3d, 0x4c, 0xe5,
-    // ?????? ??? ??????? ????? ???? ???
-    0x0, 0x8, 0x33, 0x3d, 0x4c, 0xe5,
-    // ?????? ??? ???? ????? ???? ???
-    0x0, 0x8, 0x1e, 0x3d, 0x4c, 0xe5,
-    // ?????? ??? ???? ????? ???? ???
-    0x0, 0x8, 0x36, 0x3d, 0x4c, 0xe5,
-    // ?????? ??? ????? ?????? ???? ???
-    0x0, 0x8, 0x24, 0x32, 0x4c, 0xe5,
-    // ?????? ????? ???? ????? ???
-    0x0, 0x3, 0x4c, 0x51, 0xe5,
-    // ?????? ???? ?????? ??????? ??????
-    0x0, 0x18, 0x3a, 0x58, 0xea,
-    // ?????? ??? ?????? ??????? ??????
-    0x0, 0x16, 0x32, 0x58, 0xea,
-    // ?????? ??? ?????? ??????? ??????
-    0x0, 0x48, 0x4a, 0x58, 0xea,
-    // ?????? ?????? ?????? ??????? ??????
-    0x0, 0x46, 0x4a, 0x58, 0xea,
-    // ?????? ???? ????? ??????? ??????
-    0x0, 0x4c, 0x50, 0x58, 0xea,
-    // ?????? ????? ????? ??????? ??????
-    0x0, 0x47, 0x50, 0x58, 0xea,
-    // ?????? ???? ????? ??????? ??????
-    0x0, 0x4d, 0x50, 0x58, 0xea,
-    // ?????? ?????? ????? ??????? ??????
-    0x0, 0x45, 0x50, 0x58, 0xea,
-    // ?????? ?????? ????? ??????? ??????
-    0x0, 0x44, 0x50, 0x58, 0xea,
-    // ?????? ?????? ????? ??????? ??????
-    0x0, 0x43, 0x50, 0x58, 0xea,
-    // ?????? ??????????? ????? ??????? ??????
-    0x0, 0x41, 0x42, 0x50, 0x58, 0xea,
-    // ?????? ?????????? ????? ??????? ??????
-    0x0, 0x3e, 0x40, 0x50, 0x58, 0xea,
-    // ?????? ?????????? ????? ??????? ??????
-    0x0, 0x30, 0x31, 0x3d, 0x58, 0xea,
-    // ?????? ???????????? ????? ??????? ??????
-    0x0, 0xd, 0xe, 0x3d, 0x58, 0xea,
-    // ?????? ???????? ??????? ??????
-    0x0, 0x25, 0x26, 0x58, 0xea,
-    // ?????? ??????????? ????? ??????? ??????
-    0x0, 0x1, 0x2, 0x3d, 0x58, 0xea,
-    // ?????? ?????????? ????? ??????? ??????
-    0x0, 0x27, 0x28, 0x3d, 0x58, 0xea,
-    // ?????? ???????????? ????? ??????? ??????
-    0x0, 0x6, 0x7, 0x3d, 0x58, 0xea,
-    // ?????? ???????????? ????? ??????? ??????
-    0x0, 0xb, 0xc, 0x3d, 0x58, 0xea,
-    // ?????? ???????? ????? ??????? ??????
-    0x0, 0x4, 0x5, 0x3d, 0x58, 0xea,
-    // ?????? ???????? ???? ?????? ??????? ??????
-    0x0, 0x4, 0x5, 0x18, 0x3a, 0x58, 0xea,
-    // ?????? ???????? ??? ?????? ??????? ??????
-    0x0, 0x4, 0x5, 0x16, 0x32, 0x58, 0xea,
-    // ?????? ???????? ??? ?????? ??????? ??????
-    0x0, 0x4, 0x5, 0x48, 0x4a, 0x58, 0xea,
-    // ?????? ???????? ?????? ?????? ??????? ??????
-    0x0, 0x4, 0x5, 0x46, 0x4a, 0x58, 0xea,
-    // ?????? ???????? ???? ????? ??????? ??????
-    0x0, 0x4, 0x5, 0x4c, 0x50, 0x58, 0xea,
-    // ?????? ???????? ????? ????? ??????? ??????
-    0x0, 0x4, 0x5, 0x47, 0x50, 0x58, 0xea,
-    // ?????? ???????? ???? ????? ??????? ??????
-    0x0, 0x4, 0x5, 0x4d, 0x50, 0x58, 0xea,
-    // ?????? ???????? ?????? ????? ??????? ??????
-    0x0, 0x4, 0x5, 0x45, 0x50, 0x58, 0xea,
-    // ?????? ???????? ?????? ????? ??????? ??????
-    0x0, 0x4, 0x5, 0x44, 0x50, 0x58, 0xea,
-    // ?????? ???????? ??????? ??????
-    0x0, 0x22, 0x23, 0x58, 0xea,
-    // ?????? ??? ???????? ?????? ????? ????? ??????
-    0x0, 0x8, 0x12, 0x13, 0x3c, 0x3d, 0x47, 0xea,
-    // ?????? ??? ???????? ?????? ????? ????? ??????
-    0x0, 0x8, 0x12, 0x13, 0x3b, 0x3d, 0x47, 0xea,
-    // ?????? ??? ???????? ???? ????? ????? ??????
-    0x0, 0x8, 0x12, 0x13, 0x35, 0x3d, 0x47, 0xea,
-    // ?????? ??? ???????? ????? ????? ????? ??????
-    0x0, 0x8, 0x12, 0x13, 0x29, 0x3d, 0x47, 0xea,
-    // ?????? ??? ???????? ???? ????? ????? ??????
-    0x0, 0x8, 0x12, 0x13, 0x34, 0x3d, 0x47, 0xea,
-    // ?????? ??? ???????? ??????? ????? ????? ??????
-    0x0, 0x8, 0x12, 0x13, 0x33, 0x3d, 0x47, 0xea,
-    // ?????? ??? ???????? ???? ????? ????? ??????
-    0x0, 0x8, 0x12, 0x13, 0x1e, 0x3d, 0x47, 0xea,
-    // ?????? ??? ???????? ???? ????? ????? ??????
-    0x0, 0x8, 0x12, 0x13, 0x36, 0x3d, 0x47, 0xea,
-    // ?????? ??? ???????? ????? ?????? ????? ??????
-    0x0, 0x8, 0x12, 0x13, 0x24, 0x32, 0x47, 0xea,
-    // ?????? ??? ???????? ????? ????? ??????
-    0x0, 0x8, 0x12, 0x13, 0x3d, 0x47, 0xea,
-    // ?????? ??? ???????????? ????? ????? ??????
-    0x0, 0x8, 0x19, 0x1a, 0x3d, 0x47, 0xea,
-    // ?????? ??? ???????????? ????? ????? ??????
-    0x0, 0x8, 0x1b, 0x1c, 0x3d, 0x47, 0xea,
-    // ?????? ??? ?????????? ????? ????? ??????
-    0x0, 0x8, 0x2a, 0x2b, 0x3d, 0x47, 0xea,
-    // ?????? ??? ??????????? ????? ????? ??????
-    0x0, 0x8, 0x9, 0xa, 0x3d, 0x47, 0xea,
-    // ?????? ??? ???????? ????? ??????
-    0x0, 0x8, 0x2c, 0x2d, 0x47, 0xea,
-    // ?????? ??? ???????????? ????? ????? ??????
-    0x0, 0x8, 0x14, 0x15, 0x3d, 0x47, 0xea,
-    // ?????? ??? ?????????? ????? ????? ??????
-    0x0, 0x8, 0x37, 0x38, 0x3d, 0x47, 0xea,
-    // ?????? ??? ?????????? ????? ????? ??????
-    0x0, 0x8, 0x20, 0x21, 0x3d, 0x47, 0xea,
-    // ?????? ??? ??????????? ????? ????? ??????
-    0x0, 0x8, 0x10, 0x11, 0x3d, 0x47, 0xea,
-    // ?????? ??? ?????? ????? ????? ??????
-    0x0, 0x8, 0x39, 0x3d, 0x47, 0xea,
-    // ?????? ??? ?????? ????? ????? ??????
-    0x0, 0x8, 0x3c, 0x3d, 0x47, 0xea,
-    // ?????? ??? ?????? ????? ????? ??????
-    0x0, 0x8, 0x3b, 0x3d, 0x47, 0xea,
-    // ?????? ??? ???? ????? ????? ??????
-    0x0, 0x8, 0x35, 0x3d, 0x47, 0xea,
-    // ?????? ??? ????? ????? ????? ??????
-    0x0, 0x8, 0x29, 0x3d, 0x47, 0xea,
-    // ?????? ??? ???? ????? ????? ??????
-    0x0, 0x8, 0x34, 0x3d, 0x47, 0xea,
-    // ?????? ??? ??????? ????? ????? ??????
-    0x0, 0x8, 0x33, 0x3d, 0x47, 0xea,
-    // ?????? ??? ???? ????? ????? ??????
-    0x0, 0x8, 0x1e, 0x3d, 0x47, 0xea,
-    // ?????? ??? ???? ????? ????? ??????
-    0x0, 0x8, 0x36, 0x3d, 0x47, 0xea,
-    // ?????? ??? ????? ?????? ????? ??????
-    0x0, 0x8, 0x24, 0x32, 0x47, 0xea,
-    // ?????? ????? ????? ????? ??????
-    0x0, 0x3, 0x47, 0x51, 0xea,
-    // ?????? ???? ?????? ???????? ??????
-    0x0, 0x18, 0x3a, 0x5b, 0x5c, 0xea,
-    // ?????? ??? ?????? ???????? ??????
-    0x0, 0x16, 0x32, 0x5b, 0x5c, 0xea,
-    // ?????? ??? ?????? ???????? ??????
-    0x0, 0x48, 0x4a, 0x5b, 0x5c, 0xea,
-    // ?????? ?????? ?????? ???????? ??????
-    0x0, 0x46, 0x4a, 0x5b, 0x5c, 0xea,
-    // ?????? ???? ????? ???????? ??????
-    0x0, 0x4c, 0x50, 0x5b, 0x5c, 0xea,
-    // ?????? ????? ????? ???????? ??????
-    0x0, 0x47, 0x50, 0x5b, 0x5c, 0xea,
-    // ?????? ???? ????? ???????? ??????
-    0x0, 0x4d, 0x50, 0x5b, 0x5c, 0xea,
-    // ?????? ?????? ????? ???????? ??????
-    0x0, 0x45, 0x50, 0x5b, 0x5c, 0xea,
-    // ?????? ?????? ????? ???????? ??????
-    0x0, 0x44, 0x50, 0x5b, 0x5c, 0xea,
-    // ?????? ?????? ????? ???????? ??????
-    0x0, 0x43, 0x50, 0x5b, 0x5c, 0xea,
-    // ?????? ??????????? ????? ???????? ??????
-    0x0, 0x41, 0x42, 0x50, 0x5b, 0x5c, 0xea,
-    // ?????? ?????????? ????? ???????? ??????
-    0x0, 0x3e, 0x40, 0x50, 0x5b, 0x5c, 0xea,
-    // ?????? ?????????? ????? ???????? ??????
-    0x0, 0x30, 0x31, 0x3d, 0x5b, 0x5c, 0xea,
-    // ?????? ???????????? ????? ???????? ??????
-    0x0, 0xd, 0xe, 0x3d, 0x5b, 0x5c, 0xea,
-    // ?????? ???????? ???????? ??????
-    0x0, 0x25, 0x26, 0x5b, 0x5c, 0xea,
-    // ?????? ??????????? ????? ???????? ??????
-    0x0, 0x1, 0x2, 0x3d, 0x5b, 0x5c, 0xea,
-    // ?????? ?????????? ????? ???????? ??????
-    0x0, 0x27, 0x28, 0x3d, 0x5b, 0x5c, 0xea,
-    // ?????? ???????????? ????? ???????? ??????
-    0x0, 0x6, 0x7, 0x3d, 0x5b, 0x5c, 0xea,
-    // ?????? ???????????? ????? ???????? ??????
-    0x0, 0xb, 0xc, 0x3d, 0x5b, 0x5c, 0xea,
-    // ?????? ???????? ????? ???????? ??????
-    0x0, 0x4, 0x5, 0x3d, 0x5b, 0x5c, 0xea,
-    // ?????? ???????? ???? ?????? ???????? ??????
-    0x0, 0x4, 0x5, 0x18, 0x3a, 0x5b, 0x5c, 0xea,
-    // ?????? ???????? ??? ?????? ???????? ??????
-    0x0, 0x4, 0x5, 0x16, 0x32, 0x5b, 0x5c, 0xea,
-    // ?????? ???????? ??? ?????? ???????? ??????
-    0x0, 0x4, 0x5, 0x48, 0x4a, 0x5b, 0x5c, 0xea,
-    // ?????? ???????? ?????? ?????? ???????? ??????
-    0x0, 0x4, 0x5, 0x46, 0x4a, 0x5b, 0x5c, 0xea,
-    // ?????? ???????? ???? ????? ???????? ??????
-    0x0, 0x4, 0x5, 0x4c, 0x50, 0x5b, 0x5c, 0xea,
-    // ?????? ???????? ????? ????? ???????? ??????
-    0x0, 0x4, 0x5, 0x47, 0x50, 0x5b, 0x5c, 0xea,
-    // ?????? ???????? ???? ????? ???????? ??????
-    0x0, 0x4, 0x5, 0x4d, 0x50, 0x5b, 0x5c, 0xea,
-    // ?????? ???????? ?????? ????? ???????? ??????
-    0x0, 0x4, 0x5, 0x45, 0x50, 0x5b, 0x5c, 0xea,
-    // ?????? ???????? ?????? ????? ???????? ??????
-    0x0, 0x4, 0x5, 0x44, 0x50, 0x5b, 0x5c, 0xea,
-    // ?????? ???????? ???????? ??????
-    0x0, 0x22, 0x23, 0x5b, 0x5c, 0xea,
-    // ?????? ??? ???????? ?????? ????? ???? ??????
-    0x0, 0x8, 0x12, 0x13, 0x3c, 0x3d, 0x4d, 0xea,
-    // ?????? ??? ???????? ?????? ????? ???? ??????
-    0x0, 0x8, 0x12, 0x13, 0x3b, 0x3d, 0x4d, 0xea,
-    // ?????? ??? ???????? ???? ????? ???? ??????
-    0x0, 0x8, 0x12, 0x13, 0x35, 0x3d, 0x4d, 0xea,
-    // ?????? ??? ???????? ????? ????? ???? ??????
-    0x0, 0x8, 0x12, 0x13, 0x29, 0x3d, 0x4d, 0xea,
-    // ?????? ??? ???????? ???? ????? ???? ??????
-    0x0, 0x8, 0x12, 0x13, 0x34, 0x3d, 0x4d, 0xea,
-    // ?????? ??? ???????? ??????? ????? ???? ??????
-    0x0, 0x8, 0x12, 0x13, 0x33, 0x3d, 0x4d, 0xea,
-    // ?????? ??? ???????? ???? ????? ???? ??????
-    0x0, 0x8, 0x12, 0x13, 0x1e, 0x3d, 0x4d, 0xea,
-    // ?????? ??? ???????? ???? ????? ???? ??????
-    0x0, 0x8, 0x12, 0x13, 0x36, 0x3d, 0x4d, 0xea,
-    // ?????? ??? ???????? ????? ?????? ???? ??????
-    0x0, 0x8, 0x12, 0x13, 0x24, 0x32, 0x4d, 0xea,
-    // ?????? ??? ???????? ????? ???? ??????
-    0x0, 0x8, 0x12, 0x13, 0x3d, 0x4d, 0xea,
-    // ?????? ??? ???????????? ????? ???? ??????
-    0x0, 0x8, 0x19, 0x1a, 0x3d, 0x4d, 0xea,
-    // ?????? ??? ???????????? ????? ???? ??????
-    0x0, 0x8, 0x1b, 0x1c, 0x3d, 0x4d, 0xea,
-    // ?????? ??? ?????????? ????? ???? ??????
-    0x0, 0x8, 0x2a, 0x2b, 0x3d, 0x4d, 0xea,
-    // ?????? ??? ??????????? ????? ???? ??????
-    0x0, 0x8, 0x9, 0xa, 0x3d, 0x4d, 0xea,
-    // ?????? ??? ???????? ???? ??????
-    0x0, 0x8, 0x2c, 0x2d, 0x4d, 0xea,
-    // ?????? ??? ???????????? ????? ???? ??????
-    0x0, 0x8, 0x14, 0x15, 0x3d, 0x4d, 0xea,
-    // ?????? ??? ?????????? ????? ???? ??????
-    0x0, 0x8, 0x37, 0x38, 0x3d, 0x4d, 0xea,
-    // ?????? ??? ?????????? ????? ???? ??????
-    0x0, 0x8, 0x20, 0x21, 0x3d, 0x4d, 0xea,
-    // ?????? ??? ??????????? ????? ???? ??????
-    0x0, 0x8, 0x10, 0x11, 0x3d, 0x4d, 0xea,
-    // ?????? ??? ?????? ????? ???? ??????
-    0x0, 0x8, 0x39, 0x3d, 0x4d, 0xea,
-    // ?????? ??? ?????? ????? ???? ??????
-    0x0, 0x8, 0x3c, 0x3d, 0x4d, 0xea,
-    // ?????? ??? ?????? ????? ???? ??????
-    0x0, 0x8, 0x3b, 0x3d, 0x4d, 0xea,
-    // ?????? ??? ???? ????? ???? ??????
-    0x0, 0x8, 0x35, 0x3d, 0x4d, 0xea,
-    // ?????? ??? ????? ????? ???? ??????
-    0x0, 0x8, 0x29, 0x3d, 0x4d, 0xea,
-    // ?????? ??? ???? ????? ???? ??????
-    0x0, 0x8, 0x34, 0x3d, 0x4d, 0xea,
-    // ?????? ??? ??????? ????? ???? ??????
-    0x0, 0x8, 0x33, 0x3d, 0x4d, 0xea,
-    // ?????? ??? ???? ????? ???? ??????
-    0x0, 0x8, 0x1e, 0x3d, 0x4d, 0xea,
-    // ?????? ??? ???? ????? ???? ??????
-    0x0, 0x8, 0x36, 0x3d, 0x4d, 0xea,
-    // ?????? ??? ????? ?????? ???? ??????
-    0x0, 0x8, 0x24, 0x32, 0x4d, 0xea,
-    // ?????? ????? ???? ????? ??????
-    0x0, 0x3, 0x4d, 0x51, 0xea,
-    // ?????? ???? ?????? ???????? ??????
-    0x0, 0x18, 0x3a, 0x5d, 0x5e, 0xea,
-    // ?????? ??? ?????? ???????? ??????
-    0x0, 0x16, 0x32, 0x5d, 0x5e, 0xea,
-    // ?????? ??? ?????? ???????? ??????
-    0x0, 0x48, 0x4a, 0x5d, 0x5e, 0xea,
-    // ?????? ?????? ?????? ???????? ??????
-    0x0, 0x46, 0x4a, 0x5d, 0x5e, 0xea,
-    // ?????? ???? ????? ???????? ??????
-    0x0, 0x4c, 0x50, 0x5d, 0x5e, 0xea,
-    // ?????? ????? ????? ???????? ??????
-    0x0, 0x47, 0x50, 0x5d, 0x5e, 0xea,
-    // ?????? ???? ????? ???????? ??????
-    0x0, 0x4d, 0x50, 0x5d, 0x5e, 0xea,
-    // ?????? ?????? ????? ???????? ??????
-    0x0, 0x45, 0x50, 0x5d, 0x5e, 0xea,
-    // ?????? ?????? ????? ???????? ??????
-    0x0, 0x44, 0x50, 0x5d, 0x5e, 0xea,
-    // ?????? ?????? ????? ???????? ??????
-    0x0, 0x43, 0x50, 0x5d, 0x5e, 0xea,
-    // ?????? ??????????? ????? ???????? ??????
-    0x0, 0x41, 0x42, 0x50, 0x5d, 0x5e, 0xea,
-    // ?????? ?????????? ????? ???????? ??????
-    0x0, 0x3e, 0x40, 0x50, 0x5d, 0x5e, 0xea,
-    // ?????? ?????????? ????? ???????? ??????
-    0x0, 0x30, 0x31, 0x3d, 0x5d, 0x5e, 0xea,
-    // ?????? ???????????? ????? ???????? ??????
-    0x0, 0xd, 0xe, 0x3d, 0x5d, 0x5e, 0xea,
-    // ?????? ???????? ???????? ??????
-    0x0, 0x25, 0x26, 0x5d, 0x5e, 0xea,
-    // ?????? ??????????? ????? ???????? ??????
-    0x0, 0x1, 0x2, 0x3d, 0x5d, 0x5e, 0xea,
-    // ?????? ?????????? ????? ???????? ??????
-    0x0, 0x27, 0x28, 0x3d, 0x5d, 0x5e, 0xea,
-    // ?????? ???????????? ????? ???????? ??????
-    0x0, 0x6, 0x7, 0x3d, 0x5d, 0x5e, 0xea,
-    // ?????? ???????????? ????? ???????? ??????
-    0x0, 0xb, 0xc, 0x3d, 0x5d, 0x5e, 0xea,
-    // ?????? ???????? ????? ???????? ??????
-    0x0, 0x4, 0x5, 0x3d, 0x5d, 0x5e, 0xea,
-    // ?????? ???????? ???? ?????? ???????? ??????
-    0x0, 0x4, 0x5, 0x18, 0x3a, 0x5d, 0x5e, 0xea,
-    // ?????? ???????? ??? ?????? ???????? ??????
-    0x0, 0x4, 0x5, 0x16, 0x32, 0x5d, 0x5e, 0xea,
-    // ?????? ???????? ??? ?????? ???????? ??????
-    0x0, 0x4, 0x5, 0x48, 0x4a, 0x5d, 0x5e, 0xea,
-    // ?????? ???????? ?????? ?????? ???????? ??????
-    0x0, 0x4, 0x5, 0x46, 0x4a, 0x5d, 0x5e, 0xea,
-    // ?????? ???????? ???? ????? ???????? ??????
-    0x0, 0x4, 0x5, 0x4c, 0x50, 0x5d, 0x5e, 0xea,
-    // ?????? ???????? ????? ????? ???????? ??????
-    0x0, 0x4, 0x5, 0x47, 0x50, 0x5d, 0x5e, 0xea,
-    // ?????? ???????? ???? ????? ???????? ??????
-    0x0, 0x4, 0x5, 0x4d, 0x50, 0x5d, 0x5e, 0xea,
-    // ?????? ???????? ?????? ????? ???????? ??????
-    0x0, 0x4, 0x5, 0x45, 0x50, 0x5d, 0x5e, 0xea,
-    // ?????? ???????? ?????? ????? ???????? ??????
-    0x0, 0x4, 0x5, 0x44, 0x50, 0x5d, 0x5e, 0xea,
-    // ?????? ???????? ???????? ??????
-    0x0, 0x22, 0x23, 0x5d, 0x5e, 0xea,
-    // ?????? ??? ???????? ?????? ????? ?????? ??????
-    0x0, 0x8, 0x12, 0x13, 0x3c, 0x3d, 0x45, 0xea,
-    // ?????? ??? ???????? ?????? ????? ?????? ??????
-    0x0, 0x8, 0x12, 0x13, 0x3b, 0x3d, 0x45, 0xea,
-    // ?????? ??? ???????? ???? ????? ?????? ??????
-    0x0, 0x8, 0x12, 0x13, 0x35, 0x3d, 0x45, 0xea,
-    // ?????? ??? ???????? ????? ????? ?????? ??????
-    0x0, 0x8, 0x12, 0x13, 0x29, 0x3d, 0x45, 0xea,
-    // ?????? ??? ???????? ???? ????? ?????? ??????
-    0x0, 0x8, 0x12, 0x13, 0x34, 0x3d, 0x45, 0xea,
-    // ?????? ??? ???????? ??????? ????? ?????? ??????
-    0x0, 0x8, 0x12, 0x13, 0x33, 0x3d, 0x45, 0xea,
-    // ?????? ??? ???????? ???? ????? ?????? ??????
-    0x0, 0x8, 0x12, 0x13, 0x1e, 0x3d, 0x45, 0xea,
-    // ?????? ??? ???????? ???? ????? ?????? ??????
-    0x0, 0x8, 0x12, 0x13, 0x36, 0x3d, 0x45, 0xea,
-    // ?????? ??? ???????? ????? ?????? ?????? ??????
-    0x0, 0x8, 0x12, 0x13, 0x24, 0x32, 0x45, 0xea,
-    // ?????? ??? ???????? ????? ?????? ??????
-    0x0, 0x8, 0x12, 0x13, 0x3d, 0x45, 0xea,
-    // ?????? ??? ???????????? ????? ?????? ??????
-    0x0, 0x8, 0x19, 0x1a, 0x3d, 0x45, 0xea,
-    // ?????? ??? ???????????? ????? ?????? ??????
-    0x0, 0x8, 0x1b, 0x1c, 0x3d, 0x45, 0xea,
-    // ?????? ??? ?????????? ????? ?????? ??????
-    0x0, 0x8, 0x2a, 0x2b, 0x3d, 0x45, 0xea,
-    // ?????? ??? ??????????? ????? ?????? ??????
-    0x0, 0x8, 0x9, 0xa, 0x3d, 0x45, 0xea,
-    // ?????? ??? ???????? ?????? ??????
-    0x0, 0x8, 0x2c, 0x2d, 0x45, 0xea,
-    // ?????? ??? ???????????? ????? ?????? ??????
-    0x0, 0x8, 0x14, 0x15, 0x3d, 0x45, 0xea,
-    // ?????? ??? ?????????? ????? ?????? ??????
-    0x0, 0x8, 0x37, 0x38, 0x3d, 0x45, 0xea,
-    // ?????? ??? ?????????? ????? ?????? ??????
-    0x0, 0x8, 0x20, 0x21, 0x3d, 0x45, 0xea,
-    // ?????? ??? ??????????? ????? ?????? ??????
-    0x0, 0x8, 0x10, 0x11, 0x3d, 0x45, 0xea,
-    // ?????? ??? ?????? ????? ?????? ??????
-    0x0, 0x8, 0x39, 0x3d, 0x45, 0xea,
-    // ?????? ??? ?????? ????? ?????? ??????
-    0x0, 0x8, 0x3c, 0x3d, 0x45, 0xea,
-    // ?????? ??? ?????? ????? ?????? ??????
-    0x0, 0x8, 0x3b, 0x3d, 0x45, 0xea,
-    // ?????? ??? ???? ????? ?????? ??????
-    0x0, 0x8, 0x35, 0x3d, 0x45, 0xea,
-    // ?????? ??? ????? ????? ?????? ??????
-    0x0, 0x8, 0x29, 0x3d, 0x45, 0xea,
-    // ?????? ??? ???? ????? ?????? ??????
-    0x0, 0x8, 0x34, 0x3d, 0x45, 0xea,
-    // ?????? ??? ??????? ????? ?????? ??????
-    0x0, 0x8, 0x33, 0x3d, 0x45, 0xea,
-    // ?????? ??? ???? ????? ?????? ??????
-    0x0, 0x8, 0x1e, 0x3d, 0x45, 0xea,
-    // ?????? ??? ???? ????? ?????? ??????
-    0x0, 0x8, 0x36, 0x3d, 0x45, 0xea,
-    // ?????? ??? ????? ?????? ?????? ??????
-    0x0, 0x8, 0x24, 0x32, 0x45, 0xea,
-    // ?????? ????? ?????? ????? ??????
-    0x0, 0x3, 0x45, 0x51, 0xea,
-    // ?????? ???? ?????? ???????? ??????
-    0x0, 0x18, 0x3a, 0x67, 0x68, 0xea,
-    // ?????? ??? ?????? ???????? ??????
-    0x0, 0x16, 0x32, 0x67, 0x68, 0xea,
-    // ?????? ??? ?????? ???????? ??????
-    0x0, 0x48, 0x4a, 0x67, 0x68, 0xea,
-    // ?????? ?????? ?????? ???????? ??????
-    0x0, 0x46, 0x4a, 0x67, 0x68, 0xea,
-    // ?????? ???? ????? ???????? ??????
-    0x0, 0x4c, 0x50, 0x67, 0x68, 0xea,
-    // ?????? ????? ????? ???????? ??????
-    0x0, 0x47, 0x50, 0x67, 0x68, 0xea,
-    // ?????? ???? ????? ???????? ??????
-    0x0, 0x4d, 0x50, 0x67, 0x68, 0xea,
-    // ?????? ?????? ????? ???????? ??????
-    0x0, 0x45, 0x50, 0x67, 0x68, 0xea,
-    // ?????? ?????? ????? ???????? ??????
-    0x0, 0x44, 0x50, 0x67, 0x68, 0xea,
-    // ?????? ?????? ????? ???????? ??????
-    0x0, 0x43, 0x50, 0x67, 0x68, 0xea,
-    // ?????? ??????????? ????? ???????? ??????
-    0x0, 0x41, 0x42, 0x50, 0x67, 0x68, 0xea,
-    // ?????? ?????????? ????? ???????? ??????
-    0x0, 0x3e, 0x40, 0x50, 0x67, 0x68, 0xea,
-    // ?????? ?????????? ????? ???????? ??????
-    0x0, 0x30, 0x31, 0x3d, 0x67, 0x68, 0xea,
-    // ?????? ???????????? ????? ???????? ??????
-    0x0, 0xd, 0xe, 0x3d, 0x67, 0x68, 0xea,
-    // ?????? ???????? ???????? ??????
-    0x0, 0x25, 0x26, 0x67, 0x68, 0xea,
-    // ?????? ??????????? ????? ???????? ??????
-    0x0, 0x1, 0x2, 0x3d, 0x67, 0x68, 0xea,
-    // ?????? ?????????? ????? ???????? ??????
-    0x0, 0x27, 0x28, 0x3d, 0x67, 0x68, 0xea,
-    // ?????? ???????????? ????? ???????? ??????
-    0x0, 0x6, 0x7, 0x3d, 0x67, 0x68, 0xea,
-    // ?????? ???????????? ????? ???????? ??????
-    0x0, 0xb, 0xc, 0x3d, 0x67, 0x68, 0xea,
-    // ?????? ???????? ????? ???????? ??????
-    0x0, 0x4, 0x5, 0x3d, 0x67, 0x68, 0xea,
-    // ?????? ???????? ???? ?????? ???????? ??????
-    0x0, 0x4, 0x5, 0x18, 0x3a, 0x67, 0x68, 0xea,
-    // ?????? ???????? ??? ?????? ???????? ??????
-    0x0, 0x4, 0x5, 0x16, 0x32, 0x67, 0x68, 0xea,
-    // ?????? ???????? ??? ?????? ???????? ??????
-    0x0, 0x4, 0x5, 0x48, 0x4a, 0x67, 0x68, 0xea,
-    // ?????? ???????? ?????? ?????? ???????? ??????
-    0x0, 0x4, 0x5, 0x46, 0x4a, 0x67, 0x68, 0xea,
-    // ?????? ???????? ???? ????? ???????? ??????
-    0x0, 0x4, 0x5, 0x4c, 0x50, 0x67, 0x68, 0xea,
-    // ?????? ???????? ????? ????? ???????? ??????
-    0x0, 0x4, 0x5, 0x47, 0x50, 0x67, 0x68, 0xea,
-    // ?????? ???????? ???? ????? ???????? ??????
-    0x0, 0x4, 0x5, 0x4d, 0x50, 0x67, 0x68, 0xea,
-    // ?????? ???????? ?????? ????? ???????? ??????
-    0x0, 0x4, 0x5, 0x45, 0x50, 0x67, 0x68, 0xea,
-    // ?????? ???????? ?????? ????? ???????? ??????
-    0x0, 0x4, 0x5, 0x44, 0x50, 0x67, 0x68, 0xea,
-    // ?????? ???????? ???????? ??????
-    0x0, 0x22, 0x23, 0x67, 0x68, 0xea,
-    // ?????? ??? ???????? ?????? ????? ?????? ??????
-    0x0, 0x8, 0x12, 0x13, 0x3c, 0x3d, 0x44, 0xea,
-    // ?????? ??? ???????? ?????? ????? ?????? ??????
-    0x0, 0x8, 0x12, 0x13, 0x3b, 0x3d, 0x44, 0xea,
-    // ?????? ??? ???????? ???? ????? ?????? ??????
-    0x0, 0x8, 0x12, 0x13, 0x35, 0x3d, 0x44, 0xea,
-    // ?????? ??? ???????? ????? ????? ?????? ??????
-    0x0, 0x8, 0x12, 0x13, 0x29, 0x3d, 0x44, 0xea,
-    // ?????? ??? ???????? ???? ????? ?????? ??????
-    0x0, 0x8, 0x12, 0x13, 0x34, 0x3d, 0x44, 0xea,
-    // ?????? ??? ???????? ??????? ????? ?????? ??????
-    0x0, 0x8, 0x12, 0x13, 0x33, 0x3d, 0x44, 0xea,
-    // ?????? ??? ???????? ???? ????? ?????? ??????
-    0x0, 0x8, 0x12, 0x13, 0x1e, 0x3d, 0x44, 0xea,
-    // ?????? ??? ???????? ???? ????? ?????? ??????
-    0x0, 0x8, 0x12, 0x13, 0x36, 0x3d, 0x44, 0xea,
-    // ?????? ??? ???????? ????? ?????? ?????? ??????
-    0x0, 0x8, 0x12, 0x13, 0x24, 0x32, 0x44, 0xea,
-    // ?????? ??? ???????? ????? ?????? ??????
-    0x0, 0x8, 0x12, 0x13, 0x3d, 0x44, 0xea,
-    // ?????? ??? ???????????? ????? ?????? ??????
-    0x0, 0x8, 0x19, 0x1a, 0x3d, 0x44, 0xea,
-    // ?????? ??? ???????????? ????? ?????? ??????
-    0x0, 0x8, 0x1b, 0x1c, 0x3d, 0x44, 0xea,
-    // ?????? ??? ?????????? ????? ?????? ??????
-    0x0, 0x8, 0x2a, 0x2b, 0x3d, 0x44, 0xea,
-    // ?????? ??? ??????????? ????? ?????? ??????
-    0x0, 0x8, 0x9, 0xa, 0x3d, 0x44, 0xea,
-    // ?????? ??? ???????? ?????? ??????
-    0x0, 0x8, 0x2c, 0x2d, 0x44, 0xea,
-    // ?????? ??? ???????????? ????? ?????? ??????
-    0x0, 0x8, 0x14, 0x15, 0x3d, 0x44, 0xea,
-    // ?????? ??? ?????????? ????? ?????? ??????
-    0x0, 0x8, 0x37, 0x38, 0x3d, 0x44, 0xea,
-    // ?????? ??? ?????????? ????? ?????? ??????
-    0x0, 0x8, 0x20, 0x21, 0x3d, 0x44, 0xea,
-    // ?????? ??? ??????????? ????? ?????? ??????
-    0x0, 0x8, 0x10, 0x11, 0x3d, 0x44, 0xea,
-    // ?????? ??? ?????? ????? ?????? ??????
-    0x0, 0x8, 0x39, 0x3d, 0x44, 0xea,
-    // ?????? ??? ?????? ????? ?????? ??????
-    0x0, 0x8, 0x3c, 0x3d, 0x44, 0xea,
-    // ?????? ??? ?????? ????? ?????? ??????
-    0x0, 0x8, 0x3b, 0x3d, 0x44, 0xea,
-    // ?????? ??? ???? ????? ?????? ??????
-    0x0, 0x8, 0x35, 0x3d, 0x44, 0xea,
-    // ?????? ??? ????? ????? ?????? ??????
-    0x0, 0x8, 0x29, 0x3d, 0x44, 0xea,
-    // ?????? ??? ???? ????? ?????? ??????
-    0x0, 0x8, 0x34, 0x3d, 0x44, 0xea,
-    // ?????? ??? ??????? ????? ?????? ??????
-    0x0, 0x8, 0x33, 0x3d, 0x44, 0xea,
-    // ?????? ??? ???? ????? ?????? ??????
-    0x0, 0x8, 0x1e, 0x3d, 0x44, 0xea,
-    // ?????? ??? ???? ????? ?????? ??????
-    0x0, 0x8, 0x36, 0x3d, 0x44, 0xea,
-    // ?????? ??? ????? ?????? ?????? ??????
-    0x0, 0x8, 0x24, 0x32, 0x44, 0xea,
-    // ?????? ????? ?????? ????? ??????
-    0x0, 0x3, 0x44, 0x51, 0xea,
-    // ?????? ???? ?????? ???????? ??????
-    0x0, 0x18, 0x3a, 0x60, 0x61, 0xea,
-    // ?????? ??? ?????? ???????? ??????
-    0x0, 0x16, 0x32, 0x60, 0x61, 0xea,
-    // ?????? ??? ?????? ???????? ??????
-    0x0, 0x48, 0x4a, 0x60, 0x61, 0xea,
-    // ?????? ?????? ?????? ???????? ??????
-    0x0, 0x46, 0x4a, 0x60, 0x61, 0xea,
-    // ?????? ???? ????? ???????? ??????
-    0x0, 0x4c, 0x50, 0x60, 0x61, 0xea,
-    // ?????? ????? ????? ???????? ??????
-    0x0, 0x47, 0x50, 0x60, 0x61, 0xea,
-    // ?????? ???? ????? ???????? ??????
-    0x0, 0x4d, 0x50, 0x60, 0x61, 0xea,
-    // ?????? ?????? ????? ???????? ??????
-    0x0, 0x45, 0x50, 0x60, 0x61, 0xea,
-    // ?????? ?????? ????? ???????? ??????
-    0x0, 0x44, 0x50, 0x60, 0x61, 0xea,
-    // ?????? ?????? ????? ???????? ??????
-    0x0, 0x43, 0x50, 0x60, 0x61, 0xea,
-    // ?????? ??????????? ????? ???????? ??????
-    0x0, 0x41, 0x42, 0x50, 0x60, 0x61, 0xea,
-    // ?????? ?????????? ????? ???????? ??????
-    0x0, 0x3e, 0x40, 0x50, 0x60, 0x61, 0xea,
-    // ?????? ?????????? ????? ???????? ??????
-    0x0, 0x30, 0x31, 0x3d, 0x60, 0x61, 0xea,
-    // ?????? ???????????? ????? ???????? ??????
-    0x0, 0xd, 0xe, 0x3d, 0x60, 0x61, 0xea,
-    // ?????? ???????? ???????? ??????
-    0x0, 0x25, 0x26, 0x60, 0x61, 0xea,
-    // ?????? ??????????? ????? ???????? ??????
-    0x0, 0x1, 0x2, 0x3d, 0x60, 0x61, 0xea,
-    // ?????? ?????????? ????? ???????? ??????
-    0x0, 0x27, 0x28, 0x3d, 0x60, 0x61, 0xea,
-    // ?????? ???????????? ????? ???????? ??????
-    0x0, 0x6, 0x7, 0x3d, 0x60, 0x61, 0xea,
-    // ?????? ???????????? ????? ???????? ??????
-    0x0, 0xb, 0xc, 0x3d, 0x60, 0x61, 0xea,
-    // ?????? ???????? ????? ???????? ??????
-    0x0, 0x4, 0x5, 0x3d, 0x60, 0x61, 0xea,
-    // ?????? ???????? ???? ?????? ???????? ??????
-    0x0, 0x4, 0x5, 0x18, 0x3a, 0x60, 0x61, 0xea,
-    // ?????? ???????? ??? ?????? ???????? ??????
-    0x0, 0x4, 0x5, 0x16, 0x32, 0x60, 0x61, 0xea,
-    // ?????? ???????? ??? ?????? ???????? ??????
-    0x0, 0x4, 0x5, 0x48, 0x4a, 0x60, 0x61, 0xea,
-    // ?????? ???????? ?????? ?????? ???????? ??????
-    0x0, 0x4, 0x5, 0x46, 0x4a, 0x60, 0x61, 0xea,
-    // ?????? ???????? ???? ????? ???????? ??????
-    0x0, 0x4, 0x5, 0x4c, 0x50, 0x60, 0x61, 0xea,
-    // ?????? ???????? ????? ????? ???????? ??????
-    0x0, 0x4, 0x5, 0x47, 0x50, 0x60, 0x61, 0xea,
-    // ?????? ???????? ???? ????? ???????? ??????
-    0x0, 0x4, 0x5, 0x4d, 0x50, 0x60, 0x61, 0xea,
-    // ?????? ???????? ?????? ????? ???????? ??????
-    0x0, 0x4, 0x5, 0x45, 0x50, 0x60, 0x61, 0xea,
-    // ?????? ???????? ?????? ????? ???????? ??????
-    0x0, 0x4, 0x5, 0x44, 0x50, 0x60, 0x61, 0xea,
-    // ?????? ???????? ???????? ??????
-    0x0, 0x22, 0x23, 0x60, 0x61, 0xea,
-    // ?????? ??? ???????? ?????? ????? ?????? ??????
-    0x0, 0x8, 0x12, 0x13, 0x3c, 0x3d, 0x43, 0xea,
-    // ?????? ??? ???????? ?????? ????? ?????? ??????
-    0x0, 0x8, 0x12, 0x13, 0x3b, 0x3d, 0x43, 0xea,
-    // ?????? ??? ???????? ???? ????? ?????? ??????
-    0x0, 0x8, 0x12, 0x13, 0x35, 0x3d, 0x43, 0xea,
-    // ?????? ??? ???????? ????? ????? ?????? ??????
-    0x0, 0x8, 0x12, 0x13, 0x29, 0x3d, 0x43, 0xea,
-    // ?????? ??? ???????? ???? ????? ?????? ??????
-    0x0, 0x8, 0x12, 0x13, 0x34, 0x3d, 0x43, 0xea,
-    // ?????? ??? ???????? ??????? ????? ?????? ??????
-    0x0, 0x8, 0x12, 0x13, 0x33, 0x3d, 0x43, 0xea,
-    // ?????? ??? ???????? ???? ????? ?????? ??????
-    0x0, 0x8, 0x12, 0x13, 0x1e, 0x3d, 0x43, 0xea,
-    // ?????? ??? ???????? ???? ????? ?????? ??????
-    0x0, 0x8, 0x12, 0x13, 0x36, 0x3d, 0x43, 0xea,
-    // ?????? ??? ???????? ????? ?????? ?????? ??????
-    0x0, 0x8, 0x12, 0x13, 0x24, 0x32, 0x43, 0xea,
-    // ?????? ??? ???????? ????? ?????? ??????
-    0x0, 0x8, 0x12, 0x13, 0x3d, 0x43, 0xea,
-    // ?????? ??? ???????????? ????? ?????? ??????
-    0x0, 0x8, 0x19, 0x1a, 0x3d, 0x43, 0xea,
-    // ?????? ??? ???????????? ????? ?????? ??????
-    0x0, 0x8, 0x1b, 0x1c, 0x3d, 0x43, 0xea,
-    // ?????? ??? ?????????? ????? ?????? ??????
-    0x0, 0x8, 0x2a, 0x2b, 0x3d, 0x43, 0xea,
-    // ?????? ??? ??????????? ????? ?????? ??????
-    0x0, 0x8, 0x9, 0xa, 0x3d, 0x43, 0xea,
-    // ?????? ??? ???????? ?????? ??????
-    0x0, 0x8, 0x2c, 0x2d, 0x43, 0xea,
-    // ?????? ??? ???????????? ????? ?????? ??????
-    0x0, 0x8, 0x14, 0x15, 0x3d, 0x43, 0xea,
-    // ?????? ??? ?????????? ????? ?????? ??????
-    0x0, 0x8, 0x37, 0x38, 0x3d, 0x43, 0xea,
-    // ?????? ??? ?????????? ????? ?????? ??????
-    0x0, 0x8, 0x20, 0x21, 0x3d, 0x43, 0xea,
-    // ?????? ??? ??????????? ????? ?????? ??????
-    0x0, 0x8, 0x10, 0x11, 0x3d, 0x43, 0xea,
-    // ?????? ??? ?????? ????? ?????? ??????
-    0x0, 0x8, 0x39, 0x3d, 0x43, 0xea,
-    // ?????? ??? ?????? ????? ?????? ??????
-    0x0, 0x8, 0x3c, 0x3d, 0x43, 0xea,
-    // ?????? ??? ?????? ????? ?????? ??????
-    0x0, 0x8, 0x3b, 0x3d, 0x43, 0xea,
-    // ?????? ??? ???? ????? ?????? ??????
-    0x0, 0x8, 0x35, 0x3d, 0x43, 0xea,
-    // ?????? ??? ????? ????? ?????? ??????
-    0x0, 0x8, 0x29, 0x3d, 0x43, 0xea,
-    // ?????? ??? ???? ????? ?????? ??????
-    0x0, 0x8, 0x34, 0x3d, 0x43, 0xea,
-    // ?????? ??? ??????? ????? ?????? ??????
-    0x0, 0x8, 0x33, 0x3d, 0x43, 0xea,
-    // ?????? ??? ???? ????? ?????? ??????
-    0x0, 0x8, 0x1e, 0x3d, 0x43, 0xea,
-    // ?????? ??? ???? ????? ?????? ??????
-    0x0, 0x8, 0x36, 0x3d, 0x43, 0xea,
-    // ?????? ??? ????? ?????? ?????? ??????
-    0x0, 0x8, 0x24, 0x32, 0x43, 0xea,
-    // ?????? ????? ?????? ????? ??????
-    0x0, 0x3, 0x43, 0x51, 0xea,
-    // ?????? ???? ?????? ????????????? ??????
-    0x0, 0x18, 0x3a, 0x54, 0x55, 0xea,
-    // ?????? ??? ?????? ????????????? ??????
-    0x0, 0x16, 0x32, 0x54, 0x55, 0xea,
-    // ?????? ??? ?????? ????????????? ??????
-    0x0, 0x48, 0x4a, 0x54, 0x55, 0xea,
-    // ?????? ?????? ?????? ????????????? ??????
-    0x0, 0x46, 0x4a, 0x54, 0x55, 0xea,
-    // ?????? ???? ????? ????????????? ??????
-    0x0, 0x4c, 0x50, 0x54, 0x55, 0xea,
-    // ?????? ????? ????? ????????????? ??????
-    0x0, 0x47, 0x50, 0x54, 0x55, 0xea,
-    // ?????? ???? ????? ????????????? ??????
-    0x0, 0x4d, 0x50, 0x54, 0x55, 0xea,
-    // ?????? ?????? ????? ????????????? ??????
-    0x0, 0x45, 0x50, 0x54, 0x55, 0xea,
-    // ?????? ?????? ????? ????????????? ??????
-    0x0, 0x44, 0x50, 0x54, 0x55, 0xea,
-    // ?????? ?????? ????? ????????????? ??????
-    0x0, 0x43, 0x50, 0x54, 0x55, 0xea,
-    // ?????? ??????????? ????? ????????????? ??????
-    0x0, 0x41, 0x42, 0x50, 0x54, 0x55, 0xea,
-    // ?????? ?????????? ????? ????????????? ??????
-    0x0, 0x3e, 0x40, 0x50, 0x54, 0x55, 0xea,
-    // ?????? ?????????? ????? ????????????? ??????
-    0x0, 0x30, 0x31, 0x3d, 0x54, 0x55, 0xea,
-    // ?????? ???????????? ????? ????????????? ??????
-    0x0, 0xd, 0xe, 0x3d, 0x54, 0x55, 0xea,
-    // ?????? ???????? ????????????? ??????
-    0x0, 0x25, 0x26, 0x54, 0x55, 0xea,
-    // ?????? ??????????? ????? ????????????? ??????
-    0x0, 0x1, 0x2, 0x3d, 0x54, 0x55, 0xea,
-    // ?????? ?????????? ????? ????????????? ??????
-    0x0, 0x27, 0x28, 0x3d, 0x54, 0x55, 0xea,
-    // ?????? ???????????? ????? ????????????? ??????
-    0x0, 0x6, 0x7, 0x3d, 0x54, 0x55, 0xea,
-    // ?????? ???????????? ????? ????????????? ??????
-    0x0, 0xb, 0xc, 0x3d, 0x54, 0x55, 0xea,
-    // ?????? ???????? ????? ????????????? ??????
-    0x0, 0x4, 0x5, 0x3d, 0x54, 0x55, 0xea,
-    // ?????? ???????? ???? ?????? ????????????? ??????
-    0x0, 0x4, 0x5, 0x18, 0x3a, 0x54, 0x55, 0xea,
-    // ?????? ???????? ??? ?????? ????????????? ??????
-    0x0, 0x4, 0x5, 0x16, 0x32, 0x54, 0x55, 0xea,
-    // ?????? ???????? ??? ?????? ????????????? ??????
-    0x0, 0x4, 0x5, 0x48, 0x4a, 0x54, 0x55, 0xea,
-    // ?????? ???????? ?????? ?????? ????????????? ??????
-    0x0, 0x4, 0x5, 0x46, 0x4a, 0x54, 0x55, 0xea,
-    // ?????? ???????? ???? ????? ????????????? ??????
-    0x0, 0x4, 0x5, 0x4c, 0x50, 0x54, 0x55, 0xea,
-    // ?????? ???????? ????? ????? ????????????? ??????
-    0x0, 0x4, 0x5, 0x47, 0x50, 0x54, 0x55, 0xea,
-    // ?????? ???????? ???? ????? ????????????? ??????
-    0x0, 0x4, 0x5, 0x4d, 0x50, 0x54, 0x55, 0xea,
-    // ?????? ???????? ?????? ????? ????????????? ??????
-    0x0, 0x4, 0x5, 0x45, 0x50, 0x54, 0x55, 0xea,
-    // ?????? ???????? ?????? ????? ????????????? ??????
-    0x0, 0x4, 0x5, 0x44, 0x50, 0x54, 0x55, 0xea,
-    // ?????? ???????? ????????????? ??????
-    0x0, 0x22, 0x23, 0x54, 0x55, 0xea,
-    // ?????? ??? ???????? ?????? ????? ??????????? ??????
-    0x0, 0x8, 0x12, 0x13, 0x3c, 0x3d, 0x41, 0x42, 0xea,
-    // ?????? ??? ???????? ?????? ????? ??????????? ??????
-    0x0, 0x8, 0x12, 0x13, 0x3b, 0x3d, 0x41, 0x42, 0xea,
-    // ?????? ??? ???????? ???? ????? ??????????? ??????
-    0x0, 0x8, 0x12, 0x13, 0x35, 0x3d, 0x41, 0x42, 0xea,
-    // ?????? ??? ???????? ????? ????? ??????????? ??????
-    0x0, 0x8, 0x12, 0x13, 0x29, 0x3d, 0x41, 0x42, 0xea,
-    // ?????? ??? ???????? ???? ????? ??????????? ??????
-    0x0, 0x8, 0x12, 0x13, 0x34, 0x3d, 0x41, 0x42, 0xea,
-    // ?????? ??? ???????? ??????? ????? ??????????? ??????
-    0x0, 0x8, 0x12, 0x13, 0x33, 0x3d, 0x41, 0x42, 0xea,
-    // ?????? ??? ???????? ???? ????? ??????????? ??????
-    0x0, 0x8, 0x12, 0x13, 0x1e, 0x3d, 0x41, 0x42, 0xea,
-    // ?????? ??? ???????? ???? ????? ??????????? ??????
-    0x0, 0x8, 0x12, 0x13, 0x36, 0x3d, 0x41, 0x42, 0xea,
-    // ?????? ??? ???????? ????? ?????? ??????????? ??????
-    0x0, 0x8, 0x12, 0x13, 0x24, 0x32, 0x41, 0x42, 0xea,
-    // ?????? ??? ???????? ????? ??????????? ??????
-    0x0, 0x8, 0x12, 0x13, 0x3d, 0x41, 0x42, 0xea,
-    // ?????? ??? ???????????? ????? ??????????? ??????
-    0x0, 0x8, 0x19, 0x1a, 0x3d, 0x41, 0x42, 0xea,
-    // ?????? ??? ???????????? ????? ??????????? ??????
-    0x0, 0x8, 0x1b, 0x1c, 0x3d, 0x41, 0x42, 0xea,
-    // ?????? ??? ?????????? ????? ??????????? ??????
-    0x0, 0x8, 0x2a, 0x2b, 0x3d, 0x41, 0x42, 0xea,
-    // ?????? ??? ??????????? ????? ??????????? ??????
-    0x0, 0x8, 0x9, 0xa, 0x3d, 0x41, 0x42, 0xea,
-    // ?????? ??? ???????? ??????????? ??????
-    0x0, 0x8, 0x2c, 0x2d, 0x41, 0x42, 0xea,
-    // ?????? ??? ???????????? ????? ??????????? ??????
-    0x0, 0x8, 0x14, 0x15, 0x3d, 0x41, 0x42, 0xea,
-    // ?????? ??? ?????????? ????? ??????????? ??????
-    0x0, 0x8, 0x37, 0x38, 0x3d, 0x41, 0x42, 0xea,
-    // ?????? ??? ?????????? ????? ??????????? ??????
-    0x0, 0x8, 0x20, 0x21, 0x3d, 0x41, 0x42, 0xea,
-    // ?????? ??? ??????????? ????? ??????????? ??????
-    0x0, 0x8, 0x10, 0x11, 0x3d, 0x41, 0x42, 0xea,
-    // ?????? ??? ?????? ????? ??????????? ??????
-    0x0, 0x8, 0x39, 0x3d, 0x41, 0x42, 0xea,
-    // ?????? ??? ?????? ????? ??????????? ??????
-    0x0, 0x8, 0x3c, 0x3d, 0x41, 0x42, 0xea,
-    // ?????? ??? ?????? ????? ??????????? ??????
-    0x0, 0x8, 0x3b, 0x3d, 0x41, 0x42, 0xea,
-    // ?????? ??? ???? ????? ??????????? ??????
-    0x0, 0x8, 0x35, 0x3d, 0x41, 0x42, 0xea,
-    // ?????? ??? ????? ????? ??????????? ??????
-    0x0, 0x8, 0x29, 0x3d, 0x41, 0x42, 0xea,
-    // ?????? ??? ???? ????? ??????????? ??????
-    0x0, 0x8, 0x34, 0x3d, 0x41, 0x42, 0xea,
-    // ?????? ??? ??????? ????? ??????????? ??????
-    0x0, 0x8, 0x33, 0x3d, 0x41, 0x42, 0xea,
-    // ?????? ??? ???? ????? ??????????? ??????
-    0x0, 0x8, 0x1e, 0x3d, 0x41, 0x42, 0xea,
-    // ?????? ??? ???? ????? ??????????? ??????
-    0x0, 0x8, 0x36, 0x3d, 0x41, 0x42, 0xea,
-    // ?????? ??? ????? ?????? ??????????? ??????
-    0x0, 0x8, 0x24, 0x32, 0x41, 0x42, 0xea,
-    // ?????? ????? ??????????? ????? ??????
-    0x0, 0x3, 0x41, 0x42, 0x51, 0xea,
-    // ?????? ???? ?????? ???????????? ????
-    0x0, 0x18, 0x3a, 0x52, 0x53, 0xe6,
-    // ?????? ??? ?????? ???????????? ????
-    0x0, 0x16, 0x32, 0x52, 0x53, 0xe6,
-    // ?????? ??? ?????? ???????????? ????
-    0x0, 0x48, 0x4a, 0x52, 0x53, 0xe6,
-    // ?????? ?????? ?????? ???????????? ????
-    0x0, 0x46, 0x4a, 0x52, 0x53, 0xe6,
-    // ?????? ???? ????? ???????????? ????
-    0x0, 0x4c, 0x50, 0x52, 0x53, 0xe6,
-    // ?????? ????? ????? ???????????? ????
-    0x0, 0x47, 0x50, 0x52, 0x53, 0xe6,
-    // ?????? ???? ????? ???????????? ????
-    0x0, 0x4d, 0x50, 0x52, 0x53, 0xe6,
-    // ?????? ?????? ????? ???????????? ????
-    0x0, 0x45, 0x50, 0x52, 0x53, 0xe6,
-    // ?????? ?????? ????? ???????????? ????
-    0x0, 0x44, 0x50, 0x52, 0x53, 0xe6,
-    // ?????? ?????? ????? ???????????? ????
-    0x0, 0x43, 0x50, 0x52, 0x53, 0xe6,
-    // ?????? ??????????? ????? ???????????? ????
-    0x0, 0x41, 0x42, 0x50, 0x52, 0x53, 0xe6,
-    // ?????? ?????????? ????? ???????????? ????
-    0x0, 0x3e, 0x40, 0x50, 0x52, 0x53, 0xe6,
-    // ?????? ?????????? ????? ???????????? ????
-    0x0, 0x30, 0x31, 0x3d, 0x52, 0x53, 0xe6,
-    // ?????? ???????????? ????? ???????????? ????
-    0x0, 0xd, 0xe, 0x3d, 0x52, 0x53, 0xe6,
-    // ?????? ???????? ???????????? ????
-    0x0, 0x25, 0x26, 0x52, 0x53, 0xe6,
-    // ?????? ??????????? ????? ???????????? ????
-    0x0, 0x1, 0x2, 0x3d, 0x52, 0x53, 0xe6,
-    // ?????? ?????????? ????? ???????????? ????
-    0x0, 0x27, 0x28, 0x3d, 0x52, 0x53, 0xe6,
-    // ?????? ???????????? ????? ???????????? ????
-    0x0, 0x6, 0x7, 0x3d, 0x52, 0x53, 0xe6,
-    // ?????? ???????????? ????? ???????????? ????
-    0x0, 0xb, 0xc, 0x3d, 0x52, 0x53, 0xe6,
-    // ?????? ???????? ????? ???????????? ????
-    0x0, 0x4, 0x5, 0x3d, 0x52, 0x53, 0xe6,
-    // ?????? ???????? ???? ?????? ???????????? ????
-    0x0, 0x4, 0x5, 0x18, 0x3a, 0x52, 0x53, 0xe6,
-    // ?????? ???????? ??? ?????? ???????????? ????
-    0x0, 0x4, 0x5, 0x16, 0x32, 0x52, 0x53, 0xe6,
-    // ?????? ???????? ??? ?????? ???????????? ????
-    0x0, 0x4, 0x5, 0x48, 0x4a, 0x52, 0x53, 0xe6,
-    // ?????? ???????? ?????? ?????? ???????????? ????
-    0x0, 0x4, 0x5, 0x46, 0x4a, 0x52, 0x53, 0xe6,
-    // ?????? ???????? ???? ????? ???????????? ????
-    0x0, 0x4, 0x5, 0x4c, 0x50, 0x52, 0x53, 0xe6,
-    // ?????? ???????? ????? ????? ???????????? ????
-    0x0, 0x4, 0x5, 0x47, 0x50, 0x52, 0x53, 0xe6,
-    // ?????? ???????? ???? ????? ???????????? ????
-    0x0, 0x4, 0x5, 0x4d, 0x50, 0x52, 0x53, 0xe6,
-    // ?????? ???????? ?????? ????? ???????????? ????
-    0x0, 0x4, 0x5, 0x45, 0x50, 0x52, 0x53, 0xe6,
-    // ?????? ???????? ?????? ????? ???????????? ????
-    0x0, 0x4, 0x5, 0x44, 0x50, 0x52, 0x53, 0xe6,
-    // ?????? ???????? ???????????? ????
-    0x0, 0x22, 0x23, 0x52, 0x53, 0xe6,
-    // ?????? ??? ???????? ?????? ????? ?????????? ????
-    0x0, 0x8, 0x12, 0x13, 0x3c, 0x3d, 0x3e, 0x40, 0xe6,
-    // ?????? ??? ???????? ?????? ????? ?????????? ????
-    0x0, 0x8, 0x12, 0x13, 0x3b, 0x3d, 0x3e, 0x40, 0xe6,
-    // ?????? ??? ???????? ???? ????? ?????????? ????
-    0x0, 0x8, 0x12, 0x13, 0x35, 0x3d, 0x3e, 0x40, 0xe6,
-    // ?????? ??? ???????? ????? ????? ?????????? ????
-    0x0, 0x8, 0x12, 0x13, 0x29, 0x3d, 0x3e, 0x40, 0xe6,
-    // ?????? ??? ???????? ???? ????? ?????????? ????
-    0x0, 0x8, 0x12, 0x13, 0x34, 0x3d, 0x3e, 0x40, 0xe6,
-    // ?????? ??? ???????? ??????? ????? ?????????? ????
-    0x0, 0x8, 0x12, 0x13, 0x33, 0x3d, 0x3e, 0x40, 0xe6,
-    // ?????? ??? ???????? ???? ????? ?????????? ????
-    0x0, 0x8, 0x12, 0x13, 0x1e, 0x3d, 0x3e, 0x40, 0xe6,
-    // ?????? ??? ???????? ???? ????? ?????????? ????
-    0x0, 0x8, 0x12, 0x13, 0x36, 0x3d, 0x3e, 0x40, 0xe6,
-    // ?????? ??? ???????? ????? ?????? ?????????? ????
-    0x0, 0x8, 0x12, 0x13, 0x24, 0x32, 0x3e, 0x40, 0xe6,
-    // ?????? ??? ???????? ????? ?????????? ????
-    0x0, 0x8, 0x12, 0x13, 0x3d, 0x3e, 0x40, 0xe6,
-    // ?????? ??? ???????????? ????? ?????????? ????
-    0x0, 0x8, 0x19, 0x1a, 0x3d, 0x3e, 0x40, 0xe6,
-    // ?????? ??? ???????????? ????? ?????????? ????
-    0x0, 0x8, 0x1b, 0x1c, 0x3d, 0x3e, 0x40, 0xe6,
-    // ?????? ??? ?????????? ????? ?????????? ????
-    0x0, 0x8, 0x2a, 0x2b, 0x3d, 0x3e, 0x40, 0xe6,
-    // ?????? ??? ??????????? ????? ?????????? ????
-    0x0, 0x8, 0x9, 0xa, 0x3d, 0x3e, 0x40, 0xe6,
-    // ?????? ??? ???????? ?????????? ????
-    0x0, 0x8, 0x2c, 0x2d, 0x3e, 0x40, 0xe6,
-    // ?????? ??? ???????????? ????? ?????????? ????
-    0x0, 0x8, 0x14, 0x15, 0x3d, 0x3e, 0x40, 0xe6,
-    // ?????? ??? ?????????? ????? ?????????? ????
-    0x0, 0x8, 0x37, 0x38, 0x3d, 0x3e, 0x40, 0xe6,
-    // ?????? ??? ?????????? ????? ?????????? ????
-    0x0, 0x8, 0x20, 0x21, 0x3d, 0x3e, 0x40, 0xe6,
-    // ?????? ??? ??????????? ????? ?????????? ????
-    0x0, 0x8, 0x10, 0x11, 0x3d, 0x3e, 0x40, 0xe6,
-    // ?????? ??? ?????? ????? ?????????? ????
-    0x0, 0x8, 0x39, 0x3d, 0x3e, 0x40, 0xe6,
-    // ?????? ??? ?????? ????? ?????????? ????
-    0x0, 0x8, 0x3c, 0x3d, 0x3e, 0x40, 0xe6,
-    // ?????? ??? ?????? ????? ?????????? ????
-    0x0, 0x8, 0x3b, 0x3d, 0x3e, 0x40, 0xe6,
-    // ?????? ??? ???? ????? ?????????? ????
-    0x0, 0x8, 0x35, 0x3d, 0x3e, 0x40, 0xe6,
-    // ?????? ??? ????? ????? ?????????? ????
-    0x0, 0x8, 0x29, 0x3d, 0x3e, 0x40, 0xe6,
-    // ?????? ??? ???? ????? ?????????? ????
-    0x0, 0x8, 0x34, 0x3d, 0x3e, 0x40, 0xe6,
-    // ?????? ??? ??????? ????? ?????????? ????
-    0x0, 0x8, 0x33, 0x3d, 0x3e, 0x40, 0xe6,
-    // ?????? ??? ???? ????? ?????????? ????
-    0x0, 0x8, 0x1e, 0x3d, 0x3e, 0x40, 0xe6,
-    // ?????? ??? ???? ????? ?????????? ????
-    0x0, 0x8, 0x36, 0x3d, 0x3e, 0x40, 0xe6,
-    // ?????? ??? ????? ?????? ?????????? ????
-    0x0, 0x8, 0x24, 0x32, 0x3e, 0x40, 0xe6,
+// The clock phrases are stored as a small dictionary of words (runs of LED
+// channels) plus, for every minute of the day, the number of the hour word
+// to display.  The phrase for a minute is always made of two words:
+//
+//   minute word: word number (minuteOfDay % 60), i.e. words 0-59 hold the
+//                part of the phrase which only depends on the minute
+//   hour word:   word number clockMapHourWords[minuteOfDay], which holds
+//                the rest of the phrase (hour name, "minutes" and so on)
+//
+// Each word is a list of channels with the last channel flagged by the stop
+// bit (0x80).
+//
+// The tables are built from the phrase for each minute of the day in
+// hosttests/clockphrases.c by hosttests/clockmapgen.c.  To change the clock
+// face edit the phrases there, run "make clockmap-tables" in hosttests and
+// paste the output over the three tables below; hosttests/clockmaptest.c
+// checks that displayMinute() shows every phrase.
+//
+// The channels are written as logical channel numbers but CH() and CH_END()
+// remap them to physical TLC5940 channels at compile time (see channelmap.h)
+// so that displayMinute() can pass them straight to setLedBrightness().
+#define CH(channel)		CHANNELMAP_CHANNEL(channel)
+#define CH_END(channel)	(CHANNELMAP_CHANNEL(channel) | 0x80)
+
+// The look up tables *must* use the pgmspace type definitions...
+const prog_uchar clockMapWords[] PROGMEM = {
+    // minute words
+    CH_END(0x0),	// 0
+    CH(0x0), CH(0x18), CH_END(0x3a),	// 1
+    CH(0x0), CH(0x16), CH_END(0x32),	// 2
+    CH(0x0), CH(0x48), CH_END(0x4a),	// 3
+    CH(0x0), CH(0x46), CH_END(0x4a),	// 4
+    CH(0x0), CH(0x4c), CH_END(0x50),	// 5
+    CH(0x0), CH(0x47), CH_END(0x50),	// 6
+    CH(0x0), CH(0x4d), CH_END(0x50),	// 7
+    CH(0x0), CH(0x45), CH_END(0x50),	// 8
+    CH(0x0), CH(0x44), CH_END(0x50),	// 9
+    CH(0x0), CH(0x43), CH_END(0x50),	// 10
+    CH(0x0), CH(0x41), CH(0x42), CH_END(0x50),	// 11
+    CH(0x0), CH(0x3e), CH(0x40), CH_END(0x50),	// 12
+    CH(0x0), CH(0x30), CH(0x31), CH_END(0x3d),	// 13
+    CH(0x0), CH(0xd), CH(0xe), CH_END(0x3d),	// 14
+    CH(0x0), CH(0x25), CH_END(0x26),	// 15
+    CH(0x0), CH(0x1), CH(0x2), CH_END(0x3d),	// 16
+    CH(0x0), CH(0x27), CH(0x28), CH_END(0x3d),	// 17
+    CH(0x0), CH(0x6), CH(0x7), CH_END(0x3d),	// 18
+    CH(0x0), CH(0xb), CH(0xc), CH_END(0x3d),	// 19
+    CH(0x0), CH(0x4), CH(0x5), CH_END(0x3d),	// 20
+    CH(0x0), CH(0x4), CH(0x5), CH(0x18), CH_END(0x3a),	// 21
+    CH(0x0), CH(0x4), CH(0x5), CH(0x16), CH_END(0x32),	// 22
+    CH(0x0), CH(0x4), CH(0x5), CH(0x48), CH_END(0x4a),	// 23
+    CH(0x0), CH(0x4), CH(0x5), CH(0x46), CH_END(0x4a),	// 24
+    CH(0x0), CH(0x4), CH(0x5), CH(0x4c), CH_END(0x50),	// 25
+    CH(0x0), CH(0x4), CH(0x5), CH(0x47), CH_END(0x50),	// 26
+    CH(0x0), CH(0x4), CH(0x5), CH(0x4d), CH_END(0x50),	// 27
+    CH(0x0), CH(0x4), CH(0x5), CH(0x45), CH_END(0x50),	// 28
+    CH(0x0), CH(0x4), CH(0x5), CH(0x44), CH_END(0x50),	// 29
+    CH(0x0), CH(0x22), CH_END(0x23),	// 30
+    CH(0x0), CH(0x8), CH(0x12), CH(0x13), CH(0x3c), CH_END(0x3d),	// 31
+    CH(0x0), CH(0x8), CH(0x12), CH(0x13), CH(0x3b), CH_END(0x3d),	// 32
+    CH(0x0), CH(0x8), CH(0x12), CH(0x13), CH(0x35), CH_END(0x3d),	// 33
+    CH(0x0), CH(0x8), CH(0x12), CH(0x13), CH(0x29), CH_END(0x3d),	// 34
+    CH(0x0), CH(0x8), CH(0x12), CH(0x13), CH(0x34), CH_END(0x3d),	// 35
+    CH(0x0), CH(0x8), CH(0x12), CH(0x13), CH(0x33), CH_END(0x3d),	// 36
+    CH(0x0), CH(0x8), CH(0x12), CH(0x13), CH(0x1e), CH_END(0x3d),	// 37
+    CH(0x0), CH(0x8), CH(0x12), CH(0x13), CH(0x36), CH_END(0x3d),	// 38
+    CH(0x0), CH(0x8), CH(0x12), CH(0x13), CH(0x24), CH_END(0x32),	// 39
+    CH(0x0), CH(0x8), CH(0x12), CH(0x13), CH_END(0x3d),	// 40
+    CH(0x0), CH(0x8), CH(0x19), CH(0x1a), CH_END(0x3d),	// 41
+    CH(0x0), CH(0x8), CH(0x1b), CH(0x1c), CH_END(0x3d),	// 42
+    CH(0x0), CH(0x8), CH(0x2a), CH(0x2b), CH_END(0x3d),	// 43
+    CH(0x0), CH(0x8), CH(0x9), CH(0xa), CH_END(0x3d),	// 44
+    CH(0x0), CH(0x8), CH(0x2c), CH_END(0x2d),	// 45
+    CH(0x0), CH(0x8), CH(0x14), CH(0x15), CH_END(0x3d),	// 46
+    CH(0x0), CH(0x8), CH(0x37), CH(0x38), CH_END(0x3d),	// 47
+    CH(0x0), CH(0x8), CH(0x20), CH(0x21), CH_END(0x3d),	// 48
+    CH(0x0), CH(0x8), CH(0x10), CH(0x11), CH_END(0x3d),	// 49
+    CH(0x0), CH(0x8), CH(0x39), CH_END(0x3d),	// 50
+    CH(0x0), CH(0x8), CH(0x3c), CH_END(0x3d),	// 51
+    CH(0x0), CH(0x8), CH(0x3b), CH_END(0x3d),	// 52
+    CH(0x0), CH(0x8), CH(0x35), CH_END(0x3d),	// 53
+    CH(0x0), CH(0x8), CH(0x29), CH_END(0x3d),	// 54
+    CH(0x0), CH(0x8), CH(0x34), CH_END(0x3d),	// 55
+    CH(0x0), CH(0x8), CH(0x33), CH_END(0x3d),	// 56
+    CH(0x0), CH(0x8), CH(0x1e), CH_END(0x3d),	// 57
+    CH(0x0), CH(0x8), CH(0x36), CH_END(0x3d),	// 58
+    CH(0x0), CH(0x8), CH(0x24), CH_END(0x32),	// 59
+    // hour words
+    CH_END(0x17),	// 60
+    CH(0x62), CH_END(0x66),	// 61
+    CH(0x4b), CH_END(0x66),	// 62
+    CH(0x3), CH(0x2e), CH(0x4b), CH_END(0x66),	// 63
+    CH(0x64), CH_END(0x66),	// 64
+    CH(0x49), CH_END(0x66),	// 65
+    CH(0x3), CH(0x49), CH(0x4e), CH_END(0x66),	// 66
+    CH(0x59), CH(0x5a), CH_END(0x66),	// 67
+    CH(0x48), CH(0x4e), CH_END(0x66),	// 68
+    CH(0x3), CH(0x48), CH(0x4e), CH_END(0x66),	// 69
+    CH(0x56), CH(0x57), CH_END(0x69),	// 70
+    CH(0x46), CH_END(0x69),	// 71
+    CH(0x3), CH(0x46), CH(0x4e), CH_END(0x69),	// 72
+    CH(0x63), CH_END(0x69),	// 73
+    CH(0x4c), CH_END(0x69),	// 74
+    CH(0x3), CH(0x4c), CH(0x51), CH_END(0x69),	// 75
+    CH(0x58), CH_END(0x69),	// 76
+    CH(0x47), CH_END(0x69),	// 77
+    CH(0x3), CH(0x47), CH(0x51), CH_END(0x69),	// 78
+    CH(0x5b), CH(0x5c), CH_END(0x69),	// 79
+    CH(0x4d), CH_END(0x69),	// 80
+    CH(0x3), CH(0x4d), CH(0x51), CH_END(0x69),	// 81
+    CH(0x5d), CH(0x5e), CH_END(0x69),	// 82
+    CH(0x45), CH_END(0x69),	// 83
+    CH(0x3), CH(0x45), CH(0x51), CH_END(0x69),	// 84
+    CH(0x67), CH(0x68), CH_END(0x69),	// 85
+    CH(0x44), CH_END(0x69),	// 86
+    CH(0x3), CH(0x44), CH(0x51), CH_END(0x69),	// 87
+    CH(0x60), CH(0x61), CH_END(0x69),	// 88
+    CH(0x43), CH_END(0x69),	// 89
+    CH(0x3), CH(0x43), CH(0x51), CH_END(0x69),	// 90
+    CH(0x54), CH(0x55), CH_END(0x69),	// 91
+    CH(0x41), CH(0x42), CH_END(0x69),	// 92
+    CH(0x3), CH(0x41), CH(0x42), CH(0x51), CH_END(0x69),	// 93
+    CH(0x52), CH(0x53), CH_END(0x69),	// 94
+    CH(0x52), CH(0x53), CH_END(0x65),	// 95
+    CH(0x3e), CH(0x40), CH_END(0x65),	// 96
+    CH_END(0x1d),	// 97
+    CH(0x62), CH_END(0x65),	// 98
+    CH(0x4b), CH_END(0x65),	// 99
+    CH(0x3), CH(0x2e), CH(0x4b), CH_END(0x65),	// 100
+    CH(0x64), CH_END(0x65),	// 101
+    CH(0x49), CH(0x4e), CH_END(0x65),	// 102
+    CH(0x3), CH(0x49), CH(0x4e), CH_END(0x65),	// 103
+    CH(0x59), CH(0x5a), CH_END(0x65),	// 104
+    CH(0x48), CH(0x4e), CH_END(0x65),	// 105
+    CH(0x3), CH(0x48), CH(0x4e), CH_END(0x65),	// 106
+    CH(0x56), CH(0x57), CH_END(0x65),	// 107
+    CH(0x46), CH(0x4e), CH_END(0x65),	// 108
+    CH(0x3), CH(0x46), CH(0x4e), CH_END(0x65),	// 109
+    CH(0x63), CH_END(0x65),	// 110
+    CH(0x4c), CH_END(0x65),	// 111
+    CH(0x3), CH(0x4c), CH(0x51), CH_END(0x65),	// 112
+    CH(0x58), CH_END(0x6a),	// 113
+    CH(0x47), CH_END(0x6a),	// 114
+    CH(0x3), CH(0x47), CH(0x51), CH_END(0x6a),	// 115
+    CH(0x5b), CH(0x5c), CH_END(0x6a),	// 116
+    CH(0x4d), CH_END(0x6a),	// 117
+    CH(0x3), CH(0x4d), CH(0x51), CH_END(0x6a),	// 118
+    CH(0x5d), CH(0x5e), CH_END(0x6a),	// 119
+    CH(0x45), CH_END(0x6a),	// 120
+    CH(0x3), CH(0x45), CH(0x51), CH_END(0x6a),	// 121
+    CH(0x67), CH(0x68), CH_END(0x6a),	// 122
+    CH(0x44), CH_END(0x6a),	// 123
+    CH(0x3), CH(0x44), CH(0x51), CH_END(0x6a),	// 124
+    CH(0x60), CH(0x61), CH_END(0x6a),	// 125
+    CH(0x43), CH_END(0x6a),	// 126
+    CH(0x3), CH(0x43), CH(0x51), CH_END(0x6a),	// 127
+    CH(0x54), CH(0x55), CH_END(0x6a),	// 128
+    CH(0x41), CH(0x42), CH_END(0x6a),	// 129
+    CH(0x3), CH(0x41), CH(0x42), CH(0x51), CH_END(0x6a),	// 130
+    CH(0x52), CH(0x53), CH_END(0x66),	// 131
+    CH(0x3e), CH(0x40), CH_END(0x66),	// 132
 };
 
-// Display the correct string on the display for the minute of the day passed
-void displayMinute(int minuteOfDay, int brightness)
+// Offset of each word in clockMapWords
+const prog_uint16_t clockMapWordIndex[] PROGMEM = {
+    0x0, 0x1, 0x4, 0x7, 0xa, 0xd, 0x10, 0x13,
+    0x16, 0x19, 0x1c, 0x1f, 0x23, 0x27, 0x2b, 0x2f,
+    0x32, 0x36, 0x3a, 0x3e, 0x42, 0x46, 0x4b, 0x50,
+    0x55, 0x5a, 0x5f, 0x64, 0x69, 0x6e, 0x73, 0x76,
+    0x7c, 0x82, 0x88, 0x8e, 0x94, 0x9a, 0xa0, 0xa6,
+    0xac, 0xb1, 0xb6, 0xbb, 0xc0, 0xc5, 0xc9, 0xce,
+    0xd3, 0xd8, 0xdd, 0xe1, 0xe5, 0xe9, 0xed, 0xf1,
+    0xf5, 0xf9, 0xfd, 0x101, 0x105, 0x106, 0x108, 0x10a,
+    0x10e, 0x110, 0x112, 0x116, 0x119, 0x11c, 0x120, 0x123,
+    0x125, 0x129, 0x12b, 0x12d, 0x131, 0x133, 0x135, 0x139,
+    0x13c, 0x13e, 0x142, 0x145, 0x147, 0x14b, 0x14e, 0x150,
+    0x154, 0x157, 0x159, 0x15d, 0x160, 0x163, 0x168, 0x16b,
+    0x16e, 0x171, 0x172, 0x174, 0x176, 0x17a, 0x17c, 0x17f,
+    0x183, 0x186, 0x189, 0x18d, 0x190, 0x193, 0x197, 0x199,
+    0x19b, 0x19f, 0x1a1, 0x1a3, 0x1a7, 0x1aa, 0x1ac, 0x1b0,
+    0x1b3, 0x1b5, 0x1b9, 0x1bc, 0x1be, 0x1c2, 0x1c5, 0x1c7,
+    0x1cb, 0x1ce, 0x1d1, 0x1d6, 0x1d9,
+};
+
+// Hour word to display for each minute of the day
+const prog_uchar clockMapHourWords[] PROGMEM = {
+    // 00:00 - 00:59
+    0x3c, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d,
+    0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d,
+    0x3d, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e,
+    0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e,
+    // 01:00 - 01:59
+    0x3f, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
+    0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
+    // 02:00 - 02:59
+    0x42, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
+    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
+    0x43, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+    0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+    // 03:00 - 03:59
+    0x45, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46,
+    0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46,
+    0x46, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47,
+    0x47, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47,
+    // 04:00 - 04:59
+    0x48, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49,
+    0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49,
+    0x49, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a,
+    0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a,
+    // 05:00 - 05:59
+    0x4b, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c,
+    0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c,
+    0x4c, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d,
+    0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d,
+    // 06:00 - 06:59
+    0x4e, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f,
+    0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f,
+    0x4f, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50,
+    0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50,
+    // 07:00 - 07:59
+    0x51, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52,
+    0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52,
+    0x52, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53,
+    0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53,
+    // 08:00 - 08:59
+    0x54, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56,
+    0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56,
+    // 09:00 - 09:59
+    0x57, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58,
+    0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58,
+    0x58, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59,
+    0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59,
+    // 10:00 - 10:59
+    0x5a, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b,
+    0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b,
+    0x5b, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
+    0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
+    // 11:00 - 11:59
+    0x5d, 0x5e, 0x5e, 0x5e, 0x5e, 0x5e, 0x5e, 0x5e, 0x5e, 0x5e, 0x5e, 0x5e, 0x5e, 0x5e, 0x5e,
+    0x5e, 0x5e, 0x5e, 0x5e, 0x5e, 0x5e, 0x5e, 0x5e, 0x5e, 0x5e, 0x5e, 0x5e, 0x5e, 0x5e, 0x5e,
+    0x5f, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60,
+    0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60,
+    // 12:00 - 12:59
+    0x61, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62,
+    0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62,
+    0x62, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63,
+    0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63,
+    // 13:00 - 13:59
+    0x64, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65,
+    0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65,
+    0x65, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
+    0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
+    // 14:00 - 14:59
+    0x67, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68,
+    0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68,
+    0x68, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69,
+    0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69,
+    // 15:00 - 15:59
+    0x6a, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b,
+    0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b,
+    0x6b, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+    0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+    // 16:00 - 16:59
+    0x6d, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e,
+    0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e,
+    0x6e, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f,
+    0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f,
+    // 17:00 - 17:59
+    0x70, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71,
+    0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71,
+    0x71, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72,
+    0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72,
+    // 18:00 - 18:59
+    0x73, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74,
+    0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74,
+    0x74, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75,
+    0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75,
+    // 19:00 - 19:59
+    0x76, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77,
+    0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77,
+    0x77, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78,
+    0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78,
+    // 20:00 - 20:59
+    0x79, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+    0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+    0x7a, 0x7b, 0x7b, 0x7b, 0x7b, 0x7b, 0x7b, 0x7b, 0x7b, 0x7b, 0x7b, 0x7b, 0x7b, 0x7b, 0x7b,
+    0x7b, 0x7b, 0x7b, 0x7b, 0x7b, 0x7b, 0x7b, 0x7b, 0x7b, 0x7b, 0x7b, 0x7b, 0x7b, 0x7b, 0x7b,
+    // 21:00 - 21:59
+    0x7c, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d,
+    0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d,
+    0x7d, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e,
+    0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e,
+    // 22:00 - 22:59
+    0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
+    0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
+    // 23:00 - 23:59
+    0x82, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83,
+    0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83,
+    0x83, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84,
+    0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84,
+};
+
+// Frame of lit physical channels (one bit per channel) currently on the
+// display and the brightness they were set to
+unsigned char displayedFrame[NUMBEROF5940 * 2];
+int displayedFrameBrightness = 0;
+
+// Add the channels of a word from the clockMapWords dictionary to a frame
+void addWordToFrame(unsigned char wordNumber, unsigned char *frame)
 {
 	unsigned char doneFlag = 0;
-	int foundStopBits = 0;
-	int pointer = 0;
+	unsigned int pointer;
 	unsigned char channelNumber;
 	
-	// Range check
-	if (minuteOfDay > 1439) minuteOfDay = 0;
-	
-	// Clear the display
-	for (channelNumber = 0; channelNumber <= 106; channelNumber++)
-		setLedBrightness(channelMap(channelNumber), 0);
-		
-	// Check we are not at the start of the look up table
-	if (minuteOfDay != 0)
-	{
-		// Skip through the data counting the stop bits
-		// until we have skipped minuteOfDay - 1 stop bits
-		
-		while (foundStopBits < minuteOfDay)
-		{
-			channelNumber = pgm_read_byte_near(&clockMap[pointer]);
-			
-			// look for and count stop bits
-			if (channelNumber & 0x80)
-				foundStopBits++;
-				
-			pointer++;
-		}
-	}
+	// Find the start of the word
+	pointer = pgm_read_word_near(&clockMapWordIndex[wordNumber]);
 	
 	while (doneFlag != 1)
 	{
 		// Get the value from pgm space
-		channelNumber = pgm_read_byte_near(&clockMap[pointer]);
+		channelNumber = pgm_read_byte_near(&clockMapWords[pointer]);
 		
 		if (channelNumber & 0x80)
 		{
-			setLedBrightness(channelMap(channelNumber - 128), brightness);
+			channelNumber -= 128;
 			doneFlag = 1;
 		}
-		else
-		{
-			setLedBrightness(channelMap(channelNumber), brightness);
-		}
+		
+		frame[channelNumber >> 3] |= (1 << (channelNumber & 7));
 					
 		pointer++;
+	}
+}
+
+// Forget the displayed frame so the next displayMinute() sets every channel
+// (used when something other than the clock has been using the LEDs)
+void resetDisplayFrame(void)
+{
+	for (unsigned char byteNumber = 0; byteNumber < NUMBEROF5940 * 2; byteNumber++)
+		displayedFrame[byteNumber] = 0xFF;
+	
+	displayedFrameBrightness = -1;
+}
+
+// Display the correct string on the display for the minute of the day passed
+//
+// Only the channels which differ from the displayed frame are changed, so
+// words which stay lit from one minute to the next are left alone (all of the
+// lit channels are set if the brightness has changed).
+void displayMinute(int minuteOfDay, int brightness)
+{
+	unsigned char frame[NUMBEROF5940 * 2];
+	unsigned char byteNumber;
+	
+	// Range check
+	if (minuteOfDay > 1439) minuteOfDay = 0;
+	
+	// Build the frame from the minute word and the hour word
+	for (byteNumber = 0; byteNumber < NUMBEROF5940 * 2; byteNumber++) frame[byteNumber] = 0;
+	
+	addWordToFrame(minuteOfDay % 60, frame);
+	addWordToFrame(pgm_read_byte_near(&clockMapHourWords[minuteOfDay]), frame);
+	
+	// Update the channels which have changed
+	for (byteNumber = 0; byteNumber < NUMBEROF5940 * 2; byteNumber++)
+	{
+		unsigned char changed = frame[byteNumber] ^ displayedFrame[byteNumber];
+		if (brightness != displayedFrameBrightness) changed |= frame[byteNumber];
+		
+		if (changed == 0) continue;
 		
+		for (unsigned char bitNumber = 0; bitNumber < 8; bitNumber++)
+		{
+			if (!(changed & (1 << bitNumber))) continue;
+			
+			if (frame[byteNumber] & (1 << bitNumber))
+				setLedBrightness((byteNumber << 3) + bitNumber, brightness);
+			else setLedBrightness((byteNumber << 3) + bitNumber, 0);
+		}
+		
+		displayedFrame[byteNumber] = frame[byteNumber];
 	}
+	
+	displayedFrameBrightness = brightness;
 }
\ No newline at end of file
@@ -25,6 +25,7 @@
 #define CLOCKMAP_H_
 
 // Function prototypes
+void resetDisplayFrame(void);
 void displayMinute(int minuteOfDay, int brightness);
 
 #endif /* CLOCKMAP_H_ */
\ No newline at end of file
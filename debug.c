@@ -0,0 +1,39 @@
+/************************************************************************
+	debug.c
+
+    Word Clock Firmware - Debug telemetry
+    Copyright (C) 2026 Simon Inns
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+	Email: simon.inns@gmail.com
+
+************************************************************************/
+
+// Includes
+#include <avr/io.h>
+#include <avr/eeprom.h>
+#include "hardware.h"
+#include "debug.h"
+
+// EEPROM storage for the debug values
+unsigned int debugValues[NUMBEROFDEBUGSLOTS] EEMEM;
+
+// Write a debug value to EEPROM
+void writeDebugValue(unsigned char slot, unsigned int value)
+{
+	if (slot >= NUMBEROFDEBUGSLOTS) return;
+	
+	eeprom_update_word(&debugValues[slot], value);
+}
\ No newline at end of file
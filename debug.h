@@ -0,0 +1,44 @@
+/************************************************************************
+	debug.h
+
+    Word Clock Firmware - Debug telemetry
+    Copyright (C) 2026 Simon Inns
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+	Email: simon.inns@gmail.com
+
+************************************************************************/
+
+#ifndef DEBUG_H_
+#define DEBUG_H_
+
+// The clock has no spare serial port (the UART pins drive the RTC), so the
+// debug values are written to EEPROM where they can be read back with the
+// programmer (i.e. avrdude -U eeprom:r:eeprom.hex:i).  Each value is a 16 bit
+// word at address (slot * 2).
+//
+// Note: only write values which change rarely, EEPROM cells are good for
+// around 100,000 writes (writes of an unchanged value are skipped).
+
+// Debug value slots
+#define DEBUG_BOOTTIME		0	// mS from power on to the TLC5940s running
+#define DEBUG_DUTYCYCLE		1	// CPU awake time in 1/1000ths (clock running)
+#define DEBUG_CLOCKDRIFT	2	// Software clock drift in mS (signed) over the first resync period
+#define NUMBEROFDEBUGSLOTS	3
+
+// Function prototypes
+void writeDebugValue(unsigned char slot, unsigned int value);
+
+#endif /* DEBUG_H_ */
\ No newline at end of file
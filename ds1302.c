@@ -23,6 +23,7 @@
 
 // Includes
 #include <avr/io.h>
+#include <util/atomic.h>
 #include "hardware.h"
 #include "ds1302.h"
 #include <util/delay.h>
@@ -30,28 +31,49 @@
 // Global for clock status
 unsigned int clockStatus = CLOCK_UNSET;
 
+// Start a transfer (SCLK must be low when CE goes high)
+void startTransferRTC(void)
+{
+	cbi(RTC_SCLK_PORT, RTC_SCLK_PIN);
+	
+	// Chip enable high
+	sbi(RTC_CE_PORT, RTC_CE_PIN);
+	RTC_DELAY(RTC_TCC);
+}
+
+// End a transfer
+void endTransferRTC(void)
+{
+	RTC_DELAY(RTC_TCCH);
+	
+	// Chip enable low
+	cbi(RTC_CE_PORT, RTC_CE_PIN);
+	RTC_DELAY(RTC_TCWH);
+}
+
 // Send a byte to the RTC LSB first
+//
+// The RTC reads the data on the rising edge of SCLK, so each bit is set just
+// after SCLK goes low.  SCLK is left high.
 void sendByteRTC(unsigned int byte)
 {
 	// Set IO (PD1) to output
 	sbi(RTC_IO_PORT, RTC_IO_PIN); // Disable pull up by clearing PORT
 	sbi(RTC_IO_DIR_PORT, RTC_IO_DIR_PIN); // Configure as output by setting DDR to 1
-	_delay_us(US_DELAY);
 
 	for(unsigned int bitNo = 0; bitNo < 8; bitNo++)
 	{
 		// SCLK low
 		cbi(RTC_SCLK_PORT, RTC_SCLK_PIN);
-		_delay_us(US_DELAY);
 		
 		// Set the bit on the pin
 		if(byte & 0x01) sbi(RTC_IO_PORT, RTC_IO_PIN);
 		else cbi(RTC_IO_PORT, RTC_IO_PIN);
 		
 		// SCLK high
-		_delay_us(US_DELAY);
+		RTC_DELAY(RTC_MAX(RTC_TCL, RTC_TDC));
 		sbi(RTC_SCLK_PORT, RTC_SCLK_PIN);
-		_delay_us(US_DELAY);
+		RTC_DELAY(RTC_MAX(RTC_TCH, RTC_TCDH));
 		byte >>= 1;
 	}
 	
@@ -60,6 +82,10 @@ void sendByteRTC(unsigned int byte)
 }
 
 // Receive a byte from the RTC LSB first
+//
+// The RTC outputs each bit on the falling edge of SCLK (the first bit on the
+// falling edge after the last bit of the command), so this must follow a
+// sendByteRTC() or receiveByteRTC() with SCLK high.  SCLK is left low.
 unsigned int receiveByteRTC(void)
 {
 	unsigned int byte = 0;
@@ -67,15 +93,15 @@ unsigned int receiveByteRTC(void)
 	// Set IO (PD1) to input
 	cbi(RTC_IO_PORT, RTC_IO_PIN); // Disable pull up by clearing PORT
 	cbi(RTC_IO_DIR_PORT, RTC_IO_DIR_PIN); // Configure as input by setting DDR to 0
-	_delay_us(US_DELAY);
 
 	for (unsigned int bitNo = 0; bitNo < 8; bitNo++)
 	{
-		// Strobe the serial clock
+		// Strobe the serial clock (the pin input synchroniser adds 2 cycles
+		// to the read data delay)
 		sbi(RTC_SCLK_PORT, RTC_SCLK_PIN);
-		_delay_us(US_DELAY);
+		RTC_DELAY(RTC_TCH);
 		cbi(RTC_SCLK_PORT, RTC_SCLK_PIN);
-		_delay_us(US_DELAY);
+		RTC_DELAY(RTC_MAX(RTC_TCL, RTC_TCDD + (2 * 1000000000UL / F_CPU)));
 		
 		// Read the pin status and write the bit into the byte
 		if (RTC_IO_INP & (1 << RTC_IO_PIN)) byte |= 0x01 << bitNo;
@@ -87,31 +113,23 @@ unsigned int receiveByteRTC(void)
 // Send a command word to the RTC
 void sendCommandRTC(unsigned int command, unsigned int data)
 {
-	// Chip enable high
-	sbi(RTC_CE_PORT, RTC_CE_PIN);
-	_delay_us(US_DELAY);
+	startTransferRTC();
 	
 	sendByteRTC(command);
 	sendByteRTC(data);
 	
-	// Chip enable low
-	cbi(RTC_CE_PORT, RTC_CE_PIN);
-	_delay_us(US_DELAY);
+	endTransferRTC();
 }	
 
 // Send a command and receive a byte long response from the RTC
 unsigned int receiveCommandRTC(unsigned int command)
 {
-	// Chip enable high
-	sbi(RTC_CE_PORT, RTC_CE_PIN);
-	_delay_us(US_DELAY);
+	startTransferRTC();
 	
 	sendByteRTC(command + RTC_READ);
 	unsigned int result = receiveByteRTC();
 	
-	// Chip enable low
-	cbi(RTC_CE_PORT, RTC_CE_PIN);
-	_delay_us(US_DELAY);
+	endTransferRTC();
 	
 	return result;
 }	
@@ -146,91 +164,155 @@ void initialiseRTC(void)
 	else clockStatus = CLOCK_SET;
 }
 
-// Use a write burst to set the time and date
-void setRTC(void)
-{
-	// Chip enable high
-	sbi(RTC_CE_PORT, RTC_CE_PIN);
-	_delay_us(US_DELAY);
-	
-	// Request a clock write burst
-	sendByteRTC(CLOCK_BURST + RTC_WRITE);
-
-	// Write the seconds (converting decimal to BCD)
-	sendByteRTC(((datetime.seconds/10)<<4)+(datetime.seconds%10));
-
-	// Write the minutes (converting decimal to BCD)
-	sendByteRTC(((datetime.minutes/10)<<4)+(datetime.minutes%10));
-
-	// Write the hours (converting decimal to BCD)
-	sendByteRTC(((datetime.hours/10)<<4)+(datetime.hours%10));
-
-	// Write the day/date (converting decimal to BCD)
-	sendByteRTC(((datetime.day/10)<<4)+(datetime.day%10));
+// Time and date from the last asynchronous burst read
+struct datetimeStruct rtcDatetime;
 
-	// Write the month (converting decimal to BCD)
-	sendByteRTC(((datetime.month/10)<<4)+(datetime.month%10));
+// Asynchronous transfer state
+unsigned char rtcTransferState = RTC_IDLE;
+unsigned char rtcByteNumber = 0;
+unsigned char rtcBuffer[RTC_BURSTBYTES];
 
-	// Write the day number (converting decimal to BCD)
-	sendByteRTC(((datetime.dayNo/10)<<4)+(datetime.dayNo%10));
+// Pending burst write
+unsigned char rtcWritePending = 0;
+unsigned char rtcWriteBuffer[RTC_BURSTBYTES];
 
-	// Write the year (converting decimal to BCD)
-	sendByteRTC(((datetime.year/10)<<4)+(datetime.year%10));
+// Burst read completed flag
+unsigned char rtcReadComplete = 0;
 
-	// Write the write protect (set to off)
-	sendByteRTC(0b00000000);
-
-	// Chip enable low
-	cbi(RTC_CE_PORT, RTC_CE_PIN);
-	_delay_us(US_DELAY);
+// Convert between decimal and BCD
+unsigned char toBcdRTC(unsigned int value)
+{
+	return ((value / 10) << 4) + (value % 10);
 }
 
-// Use a read burst to get the time and date
-void readRTC(void)
+unsigned int fromBcdRTC(unsigned char bcd)
 {
-	unsigned int temp;
-
-	// Chip enable high
-	sbi(RTC_CE_PORT, RTC_CE_PIN);
-	_delay_us(US_DELAY);
+	return ((bcd >> 4) * 10) + (bcd & 0x0F);
+}
 
+// Start a burst read of the time and date
+//
+// The RTC copies the time to its burst registers when the transfer starts so
+// the time read is the time of this call.  Returns 0 if the RTC is busy.
+unsigned char startReadRTC(void)
+{
+	if (rtcTransferState != RTC_IDLE || rtcWritePending) return 0;
+	
+	rtcReadComplete = 0;
+	rtcByteNumber = 0;
+	rtcTransferState = RTC_READING;
+	
+	startTransferRTC();
+	
 	// Request a clock burst (returns 8 bytes)
 	sendByteRTC(CLOCK_BURST + RTC_READ);
+	
+	return 1;
+}
 
-	// Read the seconds (in BCD and convert to decimal)
-	temp = receiveByteRTC();
-	datetime.seconds = ((temp >> 4)*10+(temp & 0x0F));
-
-	// Read the minutes (in BCD and convert to decimal)
-	temp = receiveByteRTC();
-	datetime.minutes = ((temp >> 4)*10+(temp & 0x0F));
-
-	// Read the hours  (in BCD and convert to decimal - 24hr format only)
-	temp = receiveByteRTC();
-	datetime.hours = ((temp >> 4)*10+(temp & 0x0F));
-
-	// Read the day/date (in BCD and convert to decimal)
-	temp = receiveByteRTC();
-	datetime.day = ((temp >> 4)*10+(temp & 0x0F));
+// Check if the last burst read has completed (the result is in rtcDatetime)
+unsigned char readCompleteRTC(void)
+{
+	return rtcReadComplete;
+}
 
-	// Read the month (in BCD and convert to decimal)
-	temp = receiveByteRTC();
-	datetime.month = ((temp >> 4)*10+(temp & 0x0F));
+// Request a burst write of the time and date in datetime
+//
+// The time is copied straight away and written as soon as the RTC is free.
+void writeRTC(void)
+{
+	// Seconds, minutes, hours (24hr format only), day/date, month, day number
+	// and year (converting decimal to BCD)
+	rtcWriteBuffer[0] = toBcdRTC(datetime.seconds);
+	rtcWriteBuffer[1] = toBcdRTC(datetime.minutes);
+	rtcWriteBuffer[2] = toBcdRTC(datetime.hours);
+	rtcWriteBuffer[3] = toBcdRTC(datetime.day);
+	rtcWriteBuffer[4] = toBcdRTC(datetime.month);
+	rtcWriteBuffer[5] = toBcdRTC(datetime.dayNo);
+	rtcWriteBuffer[6] = toBcdRTC(datetime.year);
+	
+	// Write protect (set to off)
+	rtcWriteBuffer[7] = 0b00000000;
+	
+	rtcWritePending = 1;
+}
 
-	// Read the day of the week number (in BCD and convert to decimal)
-	temp = receiveByteRTC();
-	datetime.dayNo = ((temp >> 4)*10+(temp & 0x0F));
+// Check if the RTC is busy with a transfer (or has a write waiting)
+unsigned char busyRTC(void)
+{
+	return (rtcTransferState != RTC_IDLE || rtcWritePending);
+}
 
-	// Read the year (in BCD and convert to decimal)
-	temp = receiveByteRTC();
-	datetime.year = ((temp >> 4)*10+(temp & 0x0F));
+// Move the current transfer on by RTC_STEPBYTES bytes (called regularly
+// from a scheduler task, each byte takes around 7 uS at 5V)
+void stepRTC(void)
+{
+	// Start a waiting write?
+	if (rtcTransferState == RTC_IDLE && rtcWritePending)
+	{
+		for (unsigned char byteNumber = 0; byteNumber < RTC_BURSTBYTES; byteNumber++)
+			rtcBuffer[byteNumber] = rtcWriteBuffer[byteNumber];
+		
+		rtcWritePending = 0;
+		rtcByteNumber = 0;
+		rtcTransferState = RTC_WRITING;
+		
+		startTransferRTC();
+		
+		// Request a clock write burst
+		sendByteRTC(CLOCK_BURST + RTC_WRITE);
+	}
+	
+	for (unsigned char stepBytes = 0; stepBytes < RTC_STEPBYTES; stepBytes++)
+	{
+		if (rtcTransferState == RTC_IDLE) return;
+		
+		if (rtcTransferState == RTC_READING) rtcBuffer[rtcByteNumber] = receiveByteRTC();
+		else sendByteRTC(rtcBuffer[rtcByteNumber]);
+		
+		rtcByteNumber++;
+		if (rtcByteNumber < RTC_BURSTBYTES) continue;
+		
+		// Transfer finished
+		endTransferRTC();
+		
+		if (rtcTransferState == RTC_READING)
+		{
+			// Update the time (in case rtcDatetime is being read from an interrupt)
+			// and discard the write protect
+			ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+			{
+				rtcDatetime.seconds = fromBcdRTC(rtcBuffer[0]);
+				rtcDatetime.minutes = fromBcdRTC(rtcBuffer[1]);
+				rtcDatetime.hours = fromBcdRTC(rtcBuffer[2]);
+				rtcDatetime.day = fromBcdRTC(rtcBuffer[3]);
+				rtcDatetime.month = fromBcdRTC(rtcBuffer[4]);
+				rtcDatetime.dayNo = fromBcdRTC(rtcBuffer[5]);
+				rtcDatetime.year = fromBcdRTC(rtcBuffer[6]);
+			}
+			
+			rtcReadComplete = 1;
+		}
+		
+		rtcTransferState = RTC_IDLE;
+	}
+}
 
-	// Read the write protect (and discard as we don't need it)
-	temp = receiveByteRTC();
+// Use a write burst to set the time and date (waits for the write to finish)
+void setRTC(void)
+{
+	writeRTC();
+	while (busyRTC()) stepRTC();
+}
 
-	// Chip Enable low
-	cbi(RTC_CE_PORT, RTC_CE_PIN);
-	_delay_us(US_DELAY);
+// Use a read burst to get the time and date into datetime (waits for the
+// read to finish)
+void readRTC(void)
+{
+	while (!startReadRTC()) stepRTC();
+	while (busyRTC()) stepRTC();
+	
+	datetime = rtcDatetime;
 }
 
 // Read the clock status
@@ -45,7 +45,44 @@
 #define RTC_READ	1
 #define RTC_WRITE	0
 
-#define US_DELAY	20
+// Supply voltage of the DS1302 for the timing profile (5 or 2 volts, use 2
+// if the clock is running from a lower supply than 5V)
+#ifndef RTC_VCC
+#define RTC_VCC		5
+#endif
+
+// DS1302 timing profile in nS (datasheet AC electrical characteristics,
+// minimums except for tCDD which is the maximum read data delay)
+#if RTC_VCC == 5
+#define RTC_TDC		50		// Data to SCLK setup
+#define RTC_TCDH	70		// SCLK to data hold
+#define RTC_TCDD	200		// SCLK to data delay (read)
+#define RTC_TCL		250		// SCLK low time
+#define RTC_TCH		250		// SCLK high time
+#define RTC_TCC		1000	// CE to SCLK setup
+#define RTC_TCCH	60		// SCLK to CE hold
+#define RTC_TCWH	1000	// CE inactive time
+#elif RTC_VCC == 2
+#define RTC_TDC		200
+#define RTC_TCDH	280
+#define RTC_TCDD	800
+#define RTC_TCL		1000
+#define RTC_TCH		1000
+#define RTC_TCC		4000
+#define RTC_TCCH	240
+#define RTC_TCWH	4000
+#else
+#error "RTC_VCC must be 5 or 2"
+#endif
+
+// Convert a time in nS to CPU cycles (rounding up so the delay is never
+// shorter than the datasheet time).  The instructions around each delay
+// only add to it.
+#define RTC_NS_TO_CYCLES(ns)	((((ns) * (F_CPU / 1000000UL)) + 999) / 1000)
+#define RTC_DELAY(ns)			__builtin_avr_delay_cycles(RTC_NS_TO_CYCLES(ns))
+
+// Longer of two times
+#define RTC_MAX(a, b)			((a) > (b) ? (a) : (b))
 
 // Hardware mapping for the DS1302 Real-time clock
 #define	RTC_SCLK_PORT	PORTD
@@ -74,6 +111,20 @@ struct datetimeStruct {
 	
 	//unsigned char wp;		// Write protect bit
 } datetime;
+
+// Time and date from the last asynchronous burst read (defined in ds1302.c)
+extern struct datetimeStruct rtcDatetime;
+
+// Asynchronous transfer states
+#define RTC_IDLE		0
+#define RTC_READING		1
+#define RTC_WRITING		2
+
+// Clock burst length (7 time and date registers and the write protect)
+#define RTC_BURSTBYTES	8
+
+// Bytes transferred per stepRTC() call
+#define RTC_STEPBYTES	2
 	
 // Definitions for EEPROM storage
 #define TIMEREAD	0
@@ -84,9 +135,18 @@ struct datetimeStruct {
 #define CLOCK_SET	1
 
 // function prototypes
+void startTransferRTC(void);
+void endTransferRTC(void);
 void sendByteRTC(unsigned int byte);
 unsigned int receiveByteRTC(void);
 void initialiseRTC(void);
+unsigned char toBcdRTC(unsigned int value);
+unsigned int fromBcdRTC(unsigned char bcd);
+unsigned char startReadRTC(void);
+unsigned char readCompleteRTC(void);
+void writeRTC(void);
+unsigned char busyRTC(void);
+void stepRTC(void);
 void setRTC(void);
 void readRTC(void);
 unsigned int readClockStatus(void);
@@ -0,0 +1,32 @@
+/************************************************************************
+	avr/interrupt.h
+
+    Host test stand-in: interrupt handlers become plain functions which
+    the tests call directly
+    Copyright (C) 2026 Simon Inns
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+	Email: simon.inns@gmail.com
+
+************************************************************************/
+
+#ifndef HOST_AVR_INTERRUPT_H_
+#define HOST_AVR_INTERRUPT_H_
+
+#define ISR(vector)	void vector(void)
+#define sei()
+#define cli()
+
+#endif /* HOST_AVR_INTERRUPT_H_ */
@@ -0,0 +1,63 @@
+/************************************************************************
+	avr/io.h
+
+    Host test stand-in for the AVR I/O registers used by the drivers
+    (see hosttests/Makefile)
+    Copyright (C) 2026 Simon Inns
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+	Email: simon.inns@gmail.com
+
+************************************************************************/
+
+#ifndef HOST_AVR_IO_H_
+#define HOST_AVR_IO_H_
+
+#include <stdint.h>
+
+// The registers are plain variables (see hostio.c)
+extern volatile uint8_t PORTB, PORTC, PORTD;
+extern volatile uint8_t DDRB, DDRC, DDRD;
+extern volatile uint8_t SPCR, SPDR, hostSPSR;
+extern volatile uint8_t TCCR1A, TCCR1B, TCCR2A, TCCR2B, TIMSK2, TCNT2;
+extern volatile uint8_t TCNT0, TIFR0;
+extern volatile uint16_t OCR1A, ICR1;
+extern volatile uint8_t hostPIND;
+
+// Hooks which let a test watch the hardware (hostio.c has defaults which
+// do nothing, a test defines its own to replace them):
+//
+// hostSfr() is called before every sbi()/cbi() on a port
+// hostReadPin() is called for every read of a PIN register
+// hostReadSpsr() is called for every access to SPSR
+volatile uint8_t *hostSfr(volatile uint8_t *sfr);
+uint8_t hostReadPin(volatile uint8_t *pin);
+volatile uint8_t *hostReadSpsr(void);
+
+#define PIND		hostReadPin(&hostPIND)
+#define SPSR		(*hostReadSpsr())
+
+#define _BV(bit)	(1 << (bit))
+#define _SFR_BYTE(sfr)	(*hostSfr(&(sfr)))
+
+// Register bits
+#define SPIE	7
+#define SPE		6
+#define MSTR	4
+#define SPIF	7
+#define SPI2X	0
+#define OCF0A	1
+
+#endif /* HOST_AVR_IO_H_ */
@@ -0,0 +1,221 @@
+/************************************************************************
+	clockmapgen.c
+
+    Generator for the clockmap.c word tables (see hosttests/Makefile)
+    Copyright (C) 2026 Simon Inns
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+	Email: simon.inns@gmail.com
+
+************************************************************************/
+
+// Builds the clockMapWords, clockMapWordIndex and clockMapHourWords tables
+// of clockmap.c from the phrases in clockphrases.c and prints them in the
+// form they take in clockmap.c.
+//
+// The minute word for minute m of the hour is the set of channels which are
+// lit at m minutes past every hour; the hour word for a minute of the day is
+// the rest of its phrase.  Hour words are numbered from 60 in the order they
+// are first used and a word used by more than one minute is stored once.
+
+// Includes
+#include <stdio.h>
+#include <string.h>
+
+#define MINUTES		1440
+#define MAXWORDS	256
+#define MAXLENGTH	32
+
+// Phrases (clockphrases.c)
+extern const unsigned char clockPhrases[];
+
+// Globals
+unsigned char phrase[MINUTES][MAXLENGTH];
+int phraseLength[MINUTES];
+
+unsigned char word[MAXWORDS][MAXLENGTH];
+int wordLength[MAXWORDS];
+int numberOfWords = 0;
+
+unsigned char hourWord[MINUTES];
+
+// Function prototypes
+int readPhrases(void);
+int phraseContains(int minuteOfDay, unsigned char channel);
+int findWord(const unsigned char *channels, int length);
+void printTables(void);
+
+// Split clockPhrases into one channel list per minute
+int readPhrases(void)
+{
+	int pointer = 0;
+	
+	for (int minuteOfDay = 0; minuteOfDay < MINUTES; minuteOfDay++)
+	{
+		unsigned char channel;
+		
+		phraseLength[minuteOfDay] = 0;
+		do
+		{
+			channel = clockPhrases[pointer++];
+			
+			if (phraseLength[minuteOfDay] == MAXLENGTH)
+			{
+				fprintf(stderr, "%02d:%02d: phrase too long\n", minuteOfDay / 60, minuteOfDay % 60);
+				return 1;
+			}
+			phrase[minuteOfDay][phraseLength[minuteOfDay]++] = channel & 0x7F;
+		} while (!(channel & 0x80));
+	}
+	
+	return 0;
+}
+
+int phraseContains(int minuteOfDay, unsigned char channel)
+{
+	for (int i = 0; i < phraseLength[minuteOfDay]; i++)
+		if (phrase[minuteOfDay][i] == channel) return 1;
+	
+	return 0;
+}
+
+// Return the number of a word with the same channels (or -1)
+int findWord(const unsigned char *channels, int length)
+{
+	for (int wordNumber = 60; wordNumber < numberOfWords; wordNumber++)
+	{
+		if (wordLength[wordNumber] == length &&
+			memcmp(word[wordNumber], channels, length) == 0) return wordNumber;
+	}
+	
+	return -1;
+}
+
+void printTables(void)
+{
+	int offset = 0;
+	
+	printf("// The look up tables *must* use the pgmspace type definitions...\n");
+	printf("const prog_uchar clockMapWords[] PROGMEM = {\n");
+	for (int wordNumber = 0; wordNumber < numberOfWords; wordNumber++)
+	{
+		if (wordNumber == 0) printf("    // minute words\n");
+		if (wordNumber == 60) printf("    // hour words\n");
+		
+		printf("    ");
+		for (int i = 0; i < wordLength[wordNumber]; i++)
+		{
+			if (i == wordLength[wordNumber] - 1) printf("CH_END(0x%x),", word[wordNumber][i]);
+			else printf("CH(0x%x), ", word[wordNumber][i]);
+		}
+		printf("\t// %d\n", wordNumber);
+	}
+	printf("};\n\n");
+	
+	printf("// Offset of each word in clockMapWords\n");
+	printf("const prog_uint16_t clockMapWordIndex[] PROGMEM = {\n");
+	for (int wordNumber = 0; wordNumber < numberOfWords; wordNumber++)
+	{
+		if (wordNumber % 8 == 0) printf("    ");
+		printf("0x%x,", offset);
+		printf((wordNumber % 8 == 7 || wordNumber == numberOfWords - 1) ? "\n" : " ");
+		offset += wordLength[wordNumber];
+	}
+	printf("};\n\n");
+	
+	printf("// Hour word to display for each minute of the day\n");
+	printf("const prog_uchar clockMapHourWords[] PROGMEM = {\n");
+	for (int minuteOfDay = 0; minuteOfDay < MINUTES; minuteOfDay++)
+	{
+		if (minuteOfDay % 60 == 0)
+			printf("    // %02d:00 - %02d:59\n", minuteOfDay / 60, minuteOfDay / 60);
+		if (minuteOfDay % 15 == 0) printf("    ");
+		printf("0x%x,", hourWord[minuteOfDay]);
+		printf((minuteOfDay % 15 == 14) ? "\n" : " ");
+	}
+	printf("};\n");
+}
+
+int main(void)
+{
+	if (readPhrases()) return 1;
+	
+	// Minute words: the channels lit at the same minute of every hour
+	for (int minute = 0; minute < 60; minute++)
+	{
+		wordLength[minute] = 0;
+		for (int i = 0; i < phraseLength[minute]; i++)
+		{
+			unsigned char channel = phrase[minute][i];
+			int everyHour = 1;
+			
+			for (int minuteOfDay = minute; minuteOfDay < MINUTES; minuteOfDay += 60)
+				if (!phraseContains(minuteOfDay, channel)) everyHour = 0;
+			
+			if (everyHour) word[minute][wordLength[minute]++] = channel;
+		}
+		
+		if (wordLength[minute] == 0)
+		{
+			fprintf(stderr, "minute %d: no channel is lit every hour\n", minute);
+			return 1;
+		}
+	}
+	numberOfWords = 60;
+	
+	// Hour words: the rest of each phrase
+	for (int minuteOfDay = 0; minuteOfDay < MINUTES; minuteOfDay++)
+	{
+		unsigned char channels[MAXLENGTH];
+		int length = 0;
+		int minute = minuteOfDay % 60;
+		int wordNumber;
+		
+		for (int i = 0; i < phraseLength[minuteOfDay]; i++)
+		{
+			unsigned char channel = phrase[minuteOfDay][i];
+			
+			if (memchr(word[minute], channel, wordLength[minute]) == NULL)
+				channels[length++] = channel;
+		}
+		
+		// A minute word is always followed by an hour word
+		if (length == 0)
+		{
+			fprintf(stderr, "%02d:%02d: empty hour word\n", minuteOfDay / 60, minute);
+			return 1;
+		}
+		
+		wordNumber = findWord(channels, length);
+		if (wordNumber < 0)
+		{
+			if (numberOfWords == MAXWORDS)
+			{
+				fprintf(stderr, "too many words\n");
+				return 1;
+			}
+			
+			wordNumber = numberOfWords++;
+			memcpy(word[wordNumber], channels, length);
+			wordLength[wordNumber] = length;
+		}
+		
+		hourWord[minuteOfDay] = wordNumber;
+	}
+	
+	printTables();
+	
+	return 0;
+}
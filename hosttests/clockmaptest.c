@@ -0,0 +1,174 @@
+/************************************************************************
+	clockmaptest.c
+
+    Host test for the clockmap.c word tables (see hosttests/Makefile)
+    Copyright (C) 2026 Simon Inns
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+	Email: simon.inns@gmail.com
+
+************************************************************************/
+
+// displayMinute() is run against the phrases in clockphrases.c (the table
+// the clockmap.c word tables are built from) with setLedBrightness()
+// replaced by a model of the LEDs.  The test checks that:
+//
+// - every minute of the day lights exactly the channels of its phrase,
+//   remapped to physical channels by channelMap();
+// - this holds when the display steps from minute to minute (only the
+//   changed channels being set), after resetDisplayFrame() and when the
+//   brightness changes;
+// - the lit channels are all at the requested brightness.
+
+// Includes
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "../hardware.h"
+#include "../tlc5940.h"
+#include "../clockmap.h"
+#include "../channelmap.h"
+
+#define CHANNELS	(16 * NUMBEROF5940)
+#define MINUTES		1440
+
+// Phrases (clockphrases.c)
+extern const unsigned char clockPhrases[];
+
+// Model of the LEDs
+int ledBrightness[CHANNELS];
+int setCount = 0;
+
+// Start of each phrase in clockPhrases
+int phraseStart[MINUTES];
+
+int errors = 0;
+
+#define ERROR(...)	do { printf("  error: "); printf(__VA_ARGS__); printf("\n"); errors++; } while (0)
+
+// Stand-in for tlc5940.c
+void setLedBrightness(int ledNumber, int brightness)
+{
+	if (ledNumber < 0 || ledNumber >= CHANNELS)
+	{
+		ERROR("setLedBrightness(%d, %d) is out of range", ledNumber, brightness);
+		return;
+	}
+	
+	ledBrightness[ledNumber] = brightness;
+	setCount++;
+}
+
+void findPhrases(void)
+{
+	int pointer = 0;
+	
+	for (int minuteOfDay = 0; minuteOfDay < MINUTES; minuteOfDay++)
+	{
+		phraseStart[minuteOfDay] = pointer;
+		while (!(clockPhrases[pointer] & 0x80)) pointer++;
+		pointer++;
+	}
+}
+
+// Check the LEDs show the phrase for a minute of the day
+void checkMinute(int minuteOfDay, int brightness)
+{
+	int expected[CHANNELS];
+	int pointer = phraseStart[minuteOfDay];
+	unsigned char channel;
+	
+	for (int ledNumber = 0; ledNumber < CHANNELS; ledNumber++) expected[ledNumber] = 0;
+	
+	do
+	{
+		channel = clockPhrases[pointer++];
+		expected[channelMap(channel & 0x7F)] = brightness;
+	} while (!(channel & 0x80));
+	
+	for (int ledNumber = 0; ledNumber < CHANNELS; ledNumber++)
+	{
+		if (ledBrightness[ledNumber] != expected[ledNumber])
+		{
+			ERROR("%02d:%02d: channel %d is at %d, expected %d", minuteOfDay / 60, minuteOfDay % 60,
+				ledNumber, ledBrightness[ledNumber], expected[ledNumber]);
+			return;
+		}
+	}
+}
+
+// Every minute from a reset display frame (all channels are set)
+void testEveryMinute(void)
+{
+	printf("Each minute of the day after resetDisplayFrame()\n");
+	
+	for (int minuteOfDay = 0; minuteOfDay < MINUTES; minuteOfDay++)
+	{
+		for (int ledNumber = 0; ledNumber < CHANNELS; ledNumber++) ledBrightness[ledNumber] = -1;
+		
+		resetDisplayFrame();
+		displayMinute(minuteOfDay, 4095);
+		checkMinute(minuteOfDay, 4095);
+	}
+}
+
+// The minutes of the day in order, and the brightness changing every so often
+void testSequence(void)
+{
+	int brightness = 4095;
+	
+	printf("The minutes of the day in order (twice), changing the brightness\n");
+	
+	for (int ledNumber = 0; ledNumber < CHANNELS; ledNumber++) ledBrightness[ledNumber] = -1;
+	resetDisplayFrame();
+	setCount = 0;
+	
+	for (int minute = 0; minute < 2 * MINUTES; minute++)
+	{
+		if (minute % 97 == 0) brightness = 256 + (minute % 3840);
+		
+		displayMinute(minute % MINUTES, brightness);
+		checkMinute(minute % MINUTES, brightness);
+	}
+	
+	printf("  %d calls to setLedBrightness()\n", setCount);
+}
+
+// Random jumps between minutes
+void testRandom(void)
+{
+	printf("Random minutes of the day\n");
+	
+	srand(1);
+	for (int step = 0; step < 10000; step++)
+	{
+		int minuteOfDay = rand() % MINUTES;
+		
+		displayMinute(minuteOfDay, 1000);
+		checkMinute(minuteOfDay, 1000);
+	}
+}
+
+int main(void)
+{
+	findPhrases();
+	
+	testEveryMinute();
+	testSequence();
+	testRandom();
+	
+	printf("%s: %d errors\n", errors ? "FAILED" : "passed", errors);
+	return errors != 0;
+}
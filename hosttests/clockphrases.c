@@ -0,0 +1,1473 @@
+/************************************************************************
+	clockphrases.c
+
+    Word Clock Firmware - Mac's clock phrases (source of clockmap.c)
+    Copyright (C) 2026 Simon Inns
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+	Email: simon.inns@gmail.com
+
+************************************************************************/
+
+// The phrase displayed for each minute of the day, as logical channel numbers
+// with the last channel of each phrase flagged by the stop bit (0x80).  This
+// is the original clockMap table from clockmap.c; clockmapgen builds the
+// clockmap.c word tables from it and clockmaptest checks them against it.
+//
+// To change the clock face edit the phrases here, then run
+// "make clockmap-tables" in hosttests and paste its output over the tables
+// in clockmap.c.
+const unsigned char clockPhrases[] = {
+    0x0, 0x97,	// 00:00
+    0x0, 0x18, 0x3a, 0x62, 0xe6,	// 00:01
+    0x0, 0x16, 0x32, 0x62, 0xe6,	// 00:02
+    0x0, 0x48, 0x4a, 0x62, 0xe6,	// 00:03
+    0x0, 0x46, 0x4a, 0x62, 0xe6,	// 00:04
+    0x0, 0x4c, 0x50, 0x62, 0xe6,	// 00:05
+    0x0, 0x47, 0x50, 0x62, 0xe6,	// 00:06
+    0x0, 0x4d, 0x50, 0x62, 0xe6,	// 00:07
+    0x0, 0x45, 0x50, 0x62, 0xe6,	// 00:08
+    0x0, 0x44, 0x50, 0x62, 0xe6,	// 00:09
+    0x0, 0x43, 0x50, 0x62, 0xe6,	// 00:10
+    0x0, 0x41, 0x42, 0x50, 0x62, 0xe6,	// 00:11
+    0x0, 0x3e, 0x40, 0x50, 0x62, 0xe6,	// 00:12
+    0x0, 0x30, 0x31, 0x3d, 0x62, 0xe6,	// 00:13
+    0x0, 0xd, 0xe, 0x3d, 0x62, 0xe6,	// 00:14
+    0x0, 0x25, 0x26, 0x62, 0xe6,	// 00:15
+    0x0, 0x1, 0x2, 0x3d, 0x62, 0xe6,	// 00:16
+    0x0, 0x27, 0x28, 0x3d, 0x62, 0xe6,	// 00:17
+    0x0, 0x6, 0x7, 0x3d, 0x62, 0xe6,	// 00:18
+    0x0, 0xb, 0xc, 0x3d, 0x62, 0xe6,	// 00:19
+    0x0, 0x4, 0x5, 0x3d, 0x62, 0xe6,	// 00:20
+    0x0, 0x4, 0x5, 0x18, 0x3a, 0x62, 0xe6,	// 00:21
+    0x0, 0x4, 0x5, 0x16, 0x32, 0x62, 0xe6,	// 00:22
+    0x0, 0x4, 0x5, 0x48, 0x4a, 0x62, 0xe6,	// 00:23
+    0x0, 0x4, 0x5, 0x46, 0x4a, 0x62, 0xe6,	// 00:24
+    0x0, 0x4, 0x5, 0x4c, 0x50, 0x62, 0xe6,	// 00:25
+    0x0, 0x4, 0x5, 0x47, 0x50, 0x62, 0xe6,	// 00:26
+    0x0, 0x4, 0x5, 0x4d, 0x50, 0x62, 0xe6,	// 00:27
+    0x0, 0x4, 0x5, 0x45, 0x50, 0x62, 0xe6,	// 00:28
+    0x0, 0x4, 0x5, 0x44, 0x50, 0x62, 0xe6,	// 00:29
+    0x0, 0x22, 0x23, 0x62, 0xe6,	// 00:30
+    0x0, 0x8, 0x12, 0x13, 0x3c, 0x3d, 0x4b, 0xe6,	// 00:31
+    0x0, 0x8, 0x12, 0x13, 0x3b, 0x3d, 0x4b, 0xe6,	// 00:32
+    0x0, 0x8, 0x12, 0x13, 0x35, 0x3d, 0x4b, 0xe6,	// 00:33
+    0x0, 0x8, 0x12, 0x13, 0x29, 0x3d, 0x4b, 0xe6,	// 00:34
+    0x0, 0x8, 0x12, 0x13, 0x34, 0x3d, 0x4b, 0xe6,	// 00:35
+    0x0, 0x8, 0x12, 0x13, 0x33, 0x3d, 0x4b, 0xe6,	// 00:36
+    0x0, 0x8, 0x12, 0x13, 0x1e, 0x3d, 0x4b, 0xe6,	// 00:37
+    0x0, 0x8, 0x12, 0x13, 0x36, 0x3d, 0x4b, 0xe6,	// 00:38
+    0x0, 0x8, 0x12, 0x13, 0x24, 0x32, 0x4b, 0xe6,	// 00:39
+    0x0, 0x8, 0x12, 0x13, 0x3d, 0x4b, 0xe6,	// 00:40
+    0x0, 0x8, 0x19, 0x1a, 0x3d, 0x4b, 0xe6,	// 00:41
+    0x0, 0x8, 0x1b, 0x1c, 0x3d, 0x4b, 0xe6,	// 00:42
+    0x0, 0x8, 0x2a, 0x2b, 0x3d, 0x4b, 0xe6,	// 00:43
+    0x0, 0x8, 0x9, 0xa, 0x3d, 0x4b, 0xe6,	// 00:44
+    0x0, 0x8, 0x2c, 0x2d, 0x4b, 0xe6,	// 00:45
+    0x0, 0x8, 0x14, 0x15, 0x3d, 0x4b, 0xe6,	// 00:46
+    0x0, 0x8, 0x37, 0x38, 0x3d, 0x4b, 0xe6,	// 00:47
+    0x0, 0x8, 0x20, 0x21, 0x3d, 0x4b, 0xe6,	// 00:48
+    0x0, 0x8, 0x10, 0x11, 0x3d, 0x4b, 0xe6,	// 00:49
+    0x0, 0x8, 0x39, 0x3d, 0x4b, 0xe6,	// 00:50
+    0x0, 0x8, 0x3c, 0x3d, 0x4b, 0xe6,	// 00:51
+    0x0, 0x8, 0x3b, 0x3d, 0x4b, 0xe6,	// 00:52
+    0x0, 0x8, 0x35, 0x3d, 0x4b, 0xe6,	// 00:53
+    0x0, 0x8, 0x29, 0x3d, 0x4b, 0xe6,	// 00:54
+    0x0, 0x8, 0x34, 0x3d, 0x4b, 0xe6,	// 00:55
+    0x0, 0x8, 0x33, 0x3d, 0x4b, 0xe6,	// 00:56
+    0x0, 0x8, 0x1e, 0x3d, 0x4b, 0xe6,	// 00:57
+    0x0, 0x8, 0x36, 0x3d, 0x4b, 0xe6,	// 00:58
+    0x0, 0x8, 0x24, 0x32, 0x4b, 0xe6,	// 00:59
+    0x0, 0x3, 0x2e, 0x4b, 0xe6,	// 01:00
+    0x0, 0x18, 0x3a, 0x64, 0xe6,	// 01:01
+    0x0, 0x16, 0x32, 0x64, 0xe6,	// 01:02
+    0x0, 0x48, 0x4a, 0x64, 0xe6,	// 01:03
+    0x0, 0x46, 0x4a, 0x64, 0xe6,	// 01:04
+    0x0, 0x4c, 0x50, 0x64, 0xe6,	// 01:05
+    0x0, 0x47, 0x50, 0x64, 0xe6,	// 01:06
+    0x0, 0x4d, 0x50, 0x64, 0xe6,	// 01:07
+    0x0, 0x45, 0x50, 0x64, 0xe6,	// 01:08
+    0x0, 0x44, 0x50, 0x64, 0xe6,	// 01:09
+    0x0, 0x43, 0x50, 0x64, 0xe6,	// 01:10
+    0x0, 0x41, 0x42, 0x50, 0x64, 0xe6,	// 01:11
+    0x0, 0x3e, 0x40, 0x50, 0x64, 0xe6,	// 01:12
+    0x0, 0x30, 0x31, 0x3d, 0x64, 0xe6,	// 01:13
+    0x0, 0xd, 0xe, 0x3d, 0x64, 0xe6,	// 01:14
+    0x0, 0x25, 0x26, 0x64, 0xe6,	// 01:15
+    0x0, 0x1, 0x2, 0x3d, 0x64, 0xe6,	// 01:16
+    0x0, 0x27, 0x28, 0x3d, 0x64, 0xe6,	// 01:17
+    0x0, 0x6, 0x7, 0x3d, 0x64, 0xe6,	// 01:18
+    0x0, 0xb, 0xc, 0x3d, 0x64, 0xe6,	// 01:19
+    0x0, 0x4, 0x5, 0x3d, 0x64, 0xe6,	// 01:20
+    0x0, 0x4, 0x5, 0x18, 0x3a, 0x64, 0xe6,	// 01:21
+    0x0, 0x4, 0x5, 0x16, 0x32, 0x64, 0xe6,	// 01:22
+    0x0, 0x4, 0x5, 0x48, 0x4a, 0x64, 0xe6,	// 01:23
+    0x0, 0x4, 0x5, 0x46, 0x4a, 0x64, 0xe6,	// 01:24
+    0x0, 0x4, 0x5, 0x4c, 0x50, 0x64, 0xe6,	// 01:25
+    0x0, 0x4, 0x5, 0x47, 0x50, 0x64, 0xe6,	// 01:26
+    0x0, 0x4, 0x5, 0x4d, 0x50, 0x64, 0xe6,	// 01:27
+    0x0, 0x4, 0x5, 0x45, 0x50, 0x64, 0xe6,	// 01:28
+    0x0, 0x4, 0x5, 0x44, 0x50, 0x64, 0xe6,	// 01:29
+    0x0, 0x22, 0x23, 0x64, 0xe6,	// 01:30
+    0x0, 0x8, 0x12, 0x13, 0x3c, 0x3d, 0x49, 0xe6,	// 01:31
+    0x0, 0x8, 0x12, 0x13, 0x3b, 0x3d, 0x49, 0xe6,	// 01:32
+    0x0, 0x8, 0x12, 0x13, 0x35, 0x3d, 0x49, 0xe6,	// 01:33
+    0x0, 0x8, 0x12, 0x13, 0x29, 0x3d, 0x49, 0xe6,	// 01:34
+    0x0, 0x8, 0x12, 0x13, 0x34, 0x3d, 0x49, 0xe6,	// 01:35
+    0x0, 0x8, 0x12, 0x13, 0x33, 0x3d, 0x49, 0xe6,	// 01:36
+    0x0, 0x8, 0x12, 0x13, 0x1e, 0x3d, 0x49, 0xe6,	// 01:37
+    0x0, 0x8, 0x12, 0x13, 0x36, 0x3d, 0x49, 0xe6,	// 01:38
+    0x0, 0x8, 0x12, 0x13, 0x24, 0x32, 0x49, 0xe6,	// 01:39
+    0x0, 0x8, 0x12, 0x13, 0x3d, 0x49, 0xe6,	// 01:40
+    0x0, 0x8, 0x19, 0x1a, 0x3d, 0x49, 0xe6,	// 01:41
+    0x0, 0x8, 0x1b, 0x1c, 0x3d, 0x49, 0xe6,	// 01:42
+    0x0, 0x8, 0x2a, 0x2b, 0x3d, 0x49, 0xe6,	// 01:43
+    0x0, 0x8, 0x9, 0xa, 0x3d, 0x49, 0xe6,	// 01:44
+    0x0, 0x8, 0x2c, 0x2d, 0x49, 0xe6,	// 01:45
+    0x0, 0x8, 0x14, 0x15, 0x3d, 0x49, 0xe6,	// 01:46
+    0x0, 0x8, 0x37, 0x38, 0x3d, 0x49, 0xe6,	// 01:47
+    0x0, 0x8, 0x20, 0x21, 0x3d, 0x49, 0xe6,	// 01:48
+    0x0, 0x8, 0x10, 0x11, 0x3d, 0x49, 0xe6,	// 01:49
+    0x0, 0x8, 0x39, 0x3d, 0x49, 0xe6,	// 01:50
+    0x0, 0x8, 0x3c, 0x3d, 0x49, 0xe6,	// 01:51
+    0x0, 0x8, 0x3b, 0x3d, 0x49, 0xe6,	// 01:52
+    0x0, 0x8, 0x35, 0x3d, 0x49, 0xe6,	// 01:53
+    0x0, 0x8, 0x29, 0x3d, 0x49, 0xe6,	// 01:54
+    0x0, 0x8, 0x34, 0x3d, 0x49, 0xe6,	// 01:55
+    0x0, 0x8, 0x33, 0x3d, 0x49, 0xe6,	// 01:56
+    0x0, 0x8, 0x1e, 0x3d, 0x49, 0xe6,	// 01:57
+    0x0, 0x8, 0x36, 0x3d, 0x49, 0xe6,	// 01:58
+    0x0, 0x8, 0x24, 0x32, 0x49, 0xe6,	// 01:59
+    0x0, 0x3, 0x49, 0x4e, 0xe6,	// 02:00
+    0x0, 0x18, 0x3a, 0x59, 0x5a, 0xe6,	// 02:01
+    0x0, 0x16, 0x32, 0x59, 0x5a, 0xe6,	// 02:02
+    0x0, 0x48, 0x4a, 0x59, 0x5a, 0xe6,	// 02:03
+    0x0, 0x46, 0x4a, 0x59, 0x5a, 0xe6,	// 02:04
+    0x0, 0x4c, 0x50, 0x59, 0x5a, 0xe6,	// 02:05
+    0x0, 0x47, 0x50, 0x59, 0x5a, 0xe6,	// 02:06
+    0x0, 0x4d, 0x50, 0x59, 0x5a, 0xe6,	// 02:07
+    0x0, 0x45, 0x50, 0x59, 0x5a, 0xe6,	// 02:08
+    0x0, 0x44, 0x50, 0x59, 0x5a, 0xe6,	// 02:09
+    0x0, 0x43, 0x50, 0x59, 0x5a, 0xe6,	// 02:10
+    0x0, 0x41, 0x42, 0x50, 0x59, 0x5a, 0xe6,	// 02:11
+    0x0, 0x3e, 0x40, 0x50, 0x59, 0x5a, 0xe6,	// 02:12
+    0x0, 0x30, 0x31, 0x3d, 0x59, 0x5a, 0xe6,	// 02:13
+    0x0, 0xd, 0xe, 0x3d, 0x59, 0x5a, 0xe6,	// 02:14
+    0x0, 0x25, 0x26, 0x59, 0x5a, 0xe6,	// 02:15
+    0x0, 0x1, 0x2, 0x3d, 0x59, 0x5a, 0xe6,	// 02:16
+    0x0, 0x27, 0x28, 0x3d, 0x59, 0x5a, 0xe6,	// 02:17
+    0x0, 0x6, 0x7, 0x3d, 0x59, 0x5a, 0xe6,	// 02:18
+    0x0, 0xb, 0xc, 0x3d, 0x59, 0x5a, 0xe6,	// 02:19
+    0x0, 0x4, 0x5, 0x3d, 0x59, 0x5a, 0xe6,	// 02:20
+    0x0, 0x4, 0x5, 0x18, 0x3a, 0x59, 0x5a, 0xe6,	// 02:21
+    0x0, 0x4, 0x5, 0x16, 0x32, 0x59, 0x5a, 0xe6,	// 02:22
+    0x0, 0x4, 0x5, 0x48, 0x4a, 0x59, 0x5a, 0xe6,	// 02:23
+    0x0, 0x4, 0x5, 0x46, 0x4a, 0x59, 0x5a, 0xe6,	// 02:24
+    0x0, 0x4, 0x5, 0x4c, 0x50, 0x59, 0x5a, 0xe6,	// 02:25
+    0x0, 0x4, 0x5, 0x47, 0x50, 0x59, 0x5a, 0xe6,	// 02:26
+    0x0, 0x4, 0x5, 0x4d, 0x50, 0x59, 0x5a, 0xe6,	// 02:27
+    0x0, 0x4, 0x5, 0x45, 0x50, 0x59, 0x5a, 0xe6,	// 02:28
+    0x0, 0x4, 0x5, 0x44, 0x50, 0x59, 0x5a, 0xe6,	// 02:29
+    0x0, 0x22, 0x23, 0x59, 0x5a, 0xe6,	// 02:30
+    0x0, 0x8, 0x12, 0x13, 0x3c, 0x3d, 0x48, 0x4e, 0xe6,	// 02:31
+    0x0, 0x8, 0x12, 0x13, 0x3b, 0x3d, 0x48, 0x4e, 0xe6,	// 02:32
+    0x0, 0x8, 0x12, 0x13, 0x35, 0x3d, 0x48, 0x4e, 0xe6,	// 02:33
+    0x0, 0x8, 0x12, 0x13, 0x29, 0x3d, 0x48, 0x4e, 0xe6,	// 02:34
+    0x0, 0x8, 0x12, 0x13, 0x34, 0x3d, 0x48, 0x4e, 0xe6,	// 02:35
+    0x0, 0x8, 0x12, 0x13, 0x33, 0x3d, 0x48, 0x4e, 0xe6,	// 02:36
+    0x0, 0x8, 0x12, 0x13, 0x1e, 0x3d, 0x48, 0x4e, 0xe6,	// 02:37
+    0x0, 0x8, 0x12, 0x13, 0x36, 0x3d, 0x48, 0x4e, 0xe6,	// 02:38
+    0x0, 0x8, 0x12, 0x13, 0x24, 0x32, 0x48, 0x4e, 0xe6,	// 02:39
+    0x0, 0x8, 0x12, 0x13, 0x3d, 0x48, 0x4e, 0xe6,	// 02:40
+    0x0, 0x8, 0x19, 0x1a, 0x3d, 0x48, 0x4e, 0xe6,	// 02:41
+    0x0, 0x8, 0x1b, 0x1c, 0x3d, 0x48, 0x4e, 0xe6,	// 02:42
+    0x0, 0x8, 0x2a, 0x2b, 0x3d, 0x48, 0x4e, 0xe6,	// 02:43
+    0x0, 0x8, 0x9, 0xa, 0x3d, 0x48, 0x4e, 0xe6,	// 02:44
+    0x0, 0x8, 0x2c, 0x2d, 0x48, 0x4e, 0xe6,	// 02:45
+    0x0, 0x8, 0x14, 0x15, 0x3d, 0x48, 0x4e, 0xe6,	// 02:46
+    0x0, 0x8, 0x37, 0x38, 0x3d, 0x48, 0x4e, 0xe6,	// 02:47
+    0x0, 0x8, 0x20, 0x21, 0x3d, 0x48, 0x4e, 0xe6,	// 02:48
+    0x0, 0x8, 0x10, 0x11, 0x3d, 0x48, 0x4e, 0xe6,	// 02:49
+    0x0, 0x8, 0x39, 0x3d, 0x48, 0x4e, 0xe6,	// 02:50
+    0x0, 0x8, 0x3c, 0x3d, 0x48, 0x4e, 0xe6,	// 02:51
+    0x0, 0x8, 0x3b, 0x3d, 0x48, 0x4e, 0xe6,	// 02:52
+    0x0, 0x8, 0x35, 0x3d, 0x48, 0x4e, 0xe6,	// 02:53
+    0x0, 0x8, 0x29, 0x3d, 0x48, 0x4e, 0xe6,	// 02:54
+    0x0, 0x8, 0x34, 0x3d, 0x48, 0x4e, 0xe6,	// 02:55
+    0x0, 0x8, 0x33, 0x3d, 0x48, 0x4e, 0xe6,	// 02:56
+    0x0, 0x8, 0x1e, 0x3d, 0x48, 0x4e, 0xe6,	// 02:57
+    0x0, 0x8, 0x36, 0x3d, 0x48, 0x4e, 0xe6,	// 02:58
+    0x0, 0x8, 0x24, 0x32, 0x48, 0x4e, 0xe6,	// 02:59
+    0x0, 0x3, 0x48, 0x4e, 0xe6,	// 03:00
+    0x0, 0x18, 0x3a, 0x56, 0x57, 0xe9,	// 03:01
+    0x0, 0x16, 0x32, 0x56, 0x57, 0xe9,	// 03:02
+    0x0, 0x48, 0x4a, 0x56, 0x57, 0xe9,	// 03:03
+    0x0, 0x46, 0x4a, 0x56, 0x57, 0xe9,	// 03:04
+    0x0, 0x4c, 0x50, 0x56, 0x57, 0xe9,	// 03:05
+    0x0, 0x47, 0x50, 0x56, 0x57, 0xe9,	// 03:06
+    0x0, 0x4d, 0x50, 0x56, 0x57, 0xe9,	// 03:07
+    0x0, 0x45, 0x50, 0x56, 0x57, 0xe9,	// 03:08
+    0x0, 0x44, 0x50, 0x56, 0x57, 0xe9,	// 03:09
+    0x0, 0x43, 0x50, 0x56, 0x57, 0xe9,	// 03:10
+    0x0, 0x41, 0x42, 0x50, 0x56, 0x57, 0xe9,	// 03:11
+    0x0, 0x3e, 0x40, 0x50, 0x56, 0x57, 0xe9,	// 03:12
+    0x0, 0x30, 0x31, 0x3d, 0x56, 0x57, 0xe9,	// 03:13
+    0x0, 0xd, 0xe, 0x3d, 0x56, 0x57, 0xe9,	// 03:14
+    0x0, 0x25, 0x26, 0x56, 0x57, 0xe9,	// 03:15
+    0x0, 0x1, 0x2, 0x3d, 0x56, 0x57, 0xe9,	// 03:16
+    0x0, 0x27, 0x28, 0x3d, 0x56, 0x57, 0xe9,	// 03:17
+    0x0, 0x6, 0x7, 0x3d, 0x56, 0x57, 0xe9,	// 03:18
+    0x0, 0xb, 0xc, 0x3d, 0x56, 0x57, 0xe9,	// 03:19
+    0x0, 0x4, 0x5, 0x3d, 0x56, 0x57, 0xe9,	// 03:20
+    0x0, 0x4, 0x5, 0x18, 0x3a, 0x56, 0x57, 0xe9,	// 03:21
+    0x0, 0x4, 0x5, 0x16, 0x32, 0x56, 0x57, 0xe9,	// 03:22
+    0x0, 0x4, 0x5, 0x48, 0x4a, 0x56, 0x57, 0xe9,	// 03:23
+    0x0, 0x4, 0x5, 0x46, 0x4a, 0x56, 0x57, 0xe9,	// 03:24
+    0x0, 0x4, 0x5, 0x4c, 0x50, 0x56, 0x57, 0xe9,	// 03:25
+    0x0, 0x4, 0x5, 0x47, 0x50, 0x56, 0x57, 0xe9,	// 03:26
+    0x0, 0x4, 0x5, 0x4d, 0x50, 0x56, 0x57, 0xe9,	// 03:27
+    0x0, 0x4, 0x5, 0x45, 0x50, 0x56, 0x57, 0xe9,	// 03:28
+    0x0, 0x4, 0x5, 0x44, 0x50, 0x56, 0x57, 0xe9,	// 03:29
+    0x0, 0x22, 0x23, 0x56, 0x57, 0xe9,	// 03:30
+    0x0, 0x8, 0x12, 0x13, 0x3c, 0x3d, 0x46, 0xe9,	// 03:31
+    0x0, 0x8, 0x12, 0x13, 0x3b, 0x3d, 0x46, 0xe9,	// 03:32
+    0x0, 0x8, 0x12, 0x13, 0x35, 0x3d, 0x46, 0xe9,	// 03:33
+    0x0, 0x8, 0x12, 0x13, 0x29, 0x3d, 0x46, 0xe9,	// 03:34
+    0x0, 0x8, 0x12, 0x13, 0x34, 0x3d, 0x46, 0xe9,	// 03:35
+    0x0, 0x8, 0x12, 0x13, 0x33, 0x3d, 0x46, 0xe9,	// 03:36
+    0x0, 0x8, 0x12, 0x13, 0x1e, 0x3d, 0x46, 0xe9,	// 03:37
+    0x0, 0x8, 0x12, 0x13, 0x36, 0x3d, 0x46, 0xe9,	// 03:38
+    0x0, 0x8, 0x12, 0x13, 0x24, 0x32, 0x46, 0xe9,	// 03:39
+    0x0, 0x8, 0x12, 0x13, 0x3d, 0x46, 0xe9,	// 03:40
+    0x0, 0x8, 0x19, 0x1a, 0x3d, 0x46, 0xe9,	// 03:41
+    0x0, 0x8, 0x1b, 0x1c, 0x3d, 0x46, 0xe9,	// 03:42
+    0x0, 0x8, 0x2a, 0x2b, 0x3d, 0x46, 0xe9,	// 03:43
+    0x0, 0x8, 0x9, 0xa, 0x3d, 0x46, 0xe9,	// 03:44
+    0x0, 0x8, 0x2c, 0x2d, 0x46, 0xe9,	// 03:45
+    0x0, 0x8, 0x14, 0x15, 0x3d, 0x46, 0xe9,	// 03:46
+    0x0, 0x8, 0x37, 0x38, 0x3d, 0x46, 0xe9,	// 03:47
+    0x0, 0x8, 0x20, 0x21, 0x3d, 0x46, 0xe9,	// 03:48
+    0x0, 0x8, 0x10, 0x11, 0x3d, 0x46, 0xe9,	// 03:49
+    0x0, 0x8, 0x39, 0x3d, 0x46, 0xe9,	// 03:50
+    0x0, 0x8, 0x3c, 0x3d, 0x46, 0xe9,	// 03:51
+    0x0, 0x8, 0x3b, 0x3d, 0x46, 0xe9,	// 03:52
+    0x0, 0x8, 0x35, 0x3d, 0x46, 0xe9,	// 03:53
+    0x0, 0x8, 0x29, 0x3d, 0x46, 0xe9,	// 03:54
+    0x0, 0x8, 0x34, 0x3d, 0x46, 0xe9,	// 03:55
+    0x0, 0x8, 0x33, 0x3d, 0x46, 0xe9,	// 03:56
+    0x0, 0x8, 0x1e, 0x3d, 0x46, 0xe9,	// 03:57
+    0x0, 0x8, 0x36, 0x3d, 0x46, 0xe9,	// 03:58
+    0x0, 0x8, 0x24, 0x32, 0x46, 0xe9,	// 03:59
+    0x0, 0x3, 0x46, 0x4e, 0xe9,	// 04:00
+    0x0, 0x18, 0x3a, 0x63, 0xe9,	// 04:01
+    0x0, 0x16, 0x32, 0x63, 0xe9,	// 04:02
+    0x0, 0x48, 0x4a, 0x63, 0xe9,	// 04:03
+    0x0, 0x46, 0x4a, 0x63, 0xe9,	// 04:04
+    0x0, 0x4c, 0x50, 0x63, 0xe9,	// 04:05
+    0x0, 0x47, 0x50, 0x63, 0xe9,	// 04:06
+    0x0, 0x4d, 0x50, 0x63, 0xe9,	// 04:07
+    0x0, 0x45, 0x50, 0x63, 0xe9,	// 04:08
+    0x0, 0x44, 0x50, 0x63, 0xe9,	// 04:09
+    0x0, 0x43, 0x50, 0x63, 0xe9,	// 04:10
+    0x0, 0x41, 0x42, 0x50, 0x63, 0xe9,	// 04:11
+    0x0, 0x3e, 0x40, 0x50, 0x63, 0xe9,	// 04:12
+    0x0, 0x30, 0x31, 0x3d, 0x63, 0xe9,	// 04:13
+    0x0, 0xd, 0xe, 0x3d, 0x63, 0xe9,	// 04:14
+    0x0, 0x25, 0x26, 0x63, 0xe9,	// 04:15
+    0x0, 0x1, 0x2, 0x3d, 0x63, 0xe9,	// 04:16
+    0x0, 0x27, 0x28, 0x3d, 0x63, 0xe9,	// 04:17
+    0x0, 0x6, 0x7, 0x3d, 0x63, 0xe9,	// 04:18
+    0x0, 0xb, 0xc, 0x3d, 0x63, 0xe9,	// 04:19
+    0x0, 0x4, 0x5, 0x3d, 0x63, 0xe9,	// 04:20
+    0x0, 0x4, 0x5, 0x18, 0x3a, 0x63, 0xe9,	// 04:21
+    0x0, 0x4, 0x5, 0x16, 0x32, 0x63, 0xe9,	// 04:22
+    0x0, 0x4, 0x5, 0x48, 0x4a, 0x63, 0xe9,	// 04:23
+    0x0, 0x4, 0x5, 0x46, 0x4a, 0x63, 0xe9,	// 04:24
+    0x0, 0x4, 0x5, 0x4c, 0x50, 0x63, 0xe9,	// 04:25
+    0x0, 0x4, 0x5, 0x47, 0x50, 0x63, 0xe9,	// 04:26
+    0x0, 0x4, 0x5, 0x4d, 0x50, 0x63, 0xe9,	// 04:27
+    0x0, 0x4, 0x5, 0x45, 0x50, 0x63, 0xe9,	// 04:28
+    0x0, 0x4, 0x5, 0x44, 0x50, 0x63, 0xe9,	// 04:29
+    0x0, 0x22, 0x23, 0x63, 0xe9,	// 04:30
+    0x0, 0x8, 0x12, 0x13, 0x3c, 0x3d, 0x4c, 0xe9,	// 04:31
+    0x0, 0x8, 0x12, 0x13, 0x3b, 0x3d, 0x4c, 0xe9,	// 04:32
+    0x0, 0x8, 0x12, 0x13, 0x35, 0x3d, 0x4c, 0xe9,	// 04:33
+    0x0, 0x8, 0x12, 0x13, 0x29, 0x3d, 0x4c, 0xe9,	// 04:34
+    0x0, 0x8, 0x12, 0x13, 0x34, 0x3d, 0x4c, 0xe9,	// 04:35
+    0x0, 0x8, 0x12, 0x13, 0x33, 0x3d, 0x4c, 0xe9,	// 04:36
+    0x0, 0x8, 0x12, 0x13, 0x1e, 0x3d, 0x4c, 0xe9,	// 04:37
+    0x0, 0x8, 0x12, 0x13, 0x36, 0x3d, 0x4c, 0xe9,	// 04:38
+    0x0, 0x8, 0x12, 0x13, 0x24, 0x32, 0x4c, 0xe9,	// 04:39
+    0x0, 0x8, 0x12, 0x13, 0x3d, 0x4c, 0xe9,	// 04:40
+    0x0, 0x8, 0x19, 0x1a, 0x3d, 0x4c, 0xe9,	// 04:41
+    0x0, 0x8, 0x1b, 0x1c, 0x3d, 0x4c, 0xe9,	// 04:42
+    0x0, 0x8, 0x2a, 0x2b, 0x3d, 0x4c, 0xe9,	// 04:43
+    0x0, 0x8, 0x9, 0xa, 0x3d, 0x4c, 0xe9,	// 04:44
+    0x0, 0x8, 0x2c, 0x2d, 0x4c, 0xe9,	// 04:45
+    0x0, 0x8, 0x14, 0x15, 0x3d, 0x4c, 0xe9,	// 04:46
+    0x0, 0x8, 0x37, 0x38, 0x3d, 0x4c, 0xe9,	// 04:47
+    0x0, 0x8, 0x20, 0x21, 0x3d, 0x4c, 0xe9,	// 04:48
+    0x0, 0x8, 0x10, 0x11, 0x3d, 0x4c, 0xe9,	// 04:49
+    0x0, 0x8, 0x39, 0x3d, 0x4c, 0xe9,	// 04:50
+    0x0, 0x8, 0x3c, 0x3d, 0x4c, 0xe9,	// 04:51
+    0x0, 0x8, 0x3b, 0x3d, 0x4c, 0xe9,	// 04:52
+    0x0, 0x8, 0x35, 0x3d, 0x4c, 0xe9,	// 04:53
+    0x0, 0x8, 0x29, 0x3d, 0x4c, 0xe9,	// 04:54
+    0x0, 0x8, 0x34, 0x3d, 0x4c, 0xe9,	// 04:55
+    0x0, 0x8, 0x33, 0x3d, 0x4c, 0xe9,	// 04:56
+    0x0, 0x8, 0x1e, 0x3d, 0x4c, 0xe9,	// 04:57
+    0x0, 0x8, 0x36, 0x3d, 0x4c, 0xe9,	// 04:58
+    0x0, 0x8, 0x24, 0x32, 0x4c, 0xe9,	// 04:59
+    0x0, 0x3, 0x4c, 0x51, 0xe9,	// 05:00
+    0x0, 0x18, 0x3a, 0x58, 0xe9,	// 05:01
+    0x0, 0x16, 0x32, 0x58, 0xe9,	// 05:02
+    0x0, 0x48, 0x4a, 0x58, 0xe9,	// 05:03
+    0x0, 0x46, 0x4a, 0x58, 0xe9,	// 05:04
+    0x0, 0x4c, 0x50, 0x58, 0xe9,	// 05:05
+    0x0, 0x47, 0x50, 0x58, 0xe9,	// 05:06
+    0x0, 0x4d, 0x50, 0x58, 0xe9,	// 05:07
+    0x0, 0x45, 0x50, 0x58, 0xe9,	// 05:08
+    0x0, 0x44, 0x50, 0x58, 0xe9,	// 05:09
+    0x0, 0x43, 0x50, 0x58, 0xe9,	// 05:10
+    0x0, 0x41, 0x42, 0x50, 0x58, 0xe9,	// 05:11
+    0x0, 0x3e, 0x40, 0x50, 0x58, 0xe9,	// 05:12
+    0x0, 0x30, 0x31, 0x3d, 0x58, 0xe9,	// 05:13
+    0x0, 0xd, 0xe, 0x3d, 0x58, 0xe9,	// 05:14
+    0x0, 0x25, 0x26, 0x58, 0xe9,	// 05:15
+    0x0, 0x1, 0x2, 0x3d, 0x58, 0xe9,	// 05:16
+    0x0, 0x27, 0x28, 0x3d, 0x58, 0xe9,	// 05:17
+    0x0, 0x6, 0x7, 0x3d, 0x58, 0xe9,	// 05:18
+    0x0, 0xb, 0xc, 0x3d, 0x58, 0xe9,	// 05:19
+    0x0, 0x4, 0x5, 0x3d, 0x58, 0xe9,	// 05:20
+    0x0, 0x4, 0x5, 0x18, 0x3a, 0x58, 0xe9,	// 05:21
+    0x0, 0x4, 0x5, 0x16, 0x32, 0x58, 0xe9,	// 05:22
+    0x0, 0x4, 0x5, 0x48, 0x4a, 0x58, 0xe9,	// 05:23
+    0x0, 0x4, 0x5, 0x46, 0x4a, 0x58, 0xe9,	// 05:24
+    0x0, 0x4, 0x5, 0x4c, 0x50, 0x58, 0xe9,	// 05:25
+    0x0, 0x4, 0x5, 0x47, 0x50, 0x58, 0xe9,	// 05:26
+    0x0, 0x4, 0x5, 0x4d, 0x50, 0x58, 0xe9,	// 05:27
+    0x0, 0x4, 0x5, 0x45, 0x50, 0x58, 0xe9,	// 05:28
+    0x0, 0x4, 0x5, 0x44, 0x50, 0x58, 0xe9,	// 05:29
+    0x0, 0x22, 0x23, 0x58, 0xe9,	// 05:30
+    0x0, 0x8, 0x12, 0x13, 0x3c, 0x3d, 0x47, 0xe9,	// 05:31
+    0x0, 0x8, 0x12, 0x13, 0x3b, 0x3d, 0x47, 0xe9,	// 05:32
+    0x0, 0x8, 0x12, 0x13, 0x35, 0x3d, 0x47, 0xe9,	// 05:33
+    0x0, 0x8, 0x12, 0x13, 0x29, 0x3d, 0x47, 0xe9,	// 05:34
+    0x0, 0x8, 0x12, 0x13, 0x34, 0x3d, 0x47, 0xe9,	// 05:35
+    0x0, 0x8, 0x12, 0x13, 0x33, 0x3d, 0x47, 0xe9,	// 05:36
+    0x0, 0x8, 0x12, 0x13, 0x1e, 0x3d, 0x47, 0xe9,	// 05:37
+    0x0, 0x8, 0x12, 0x13, 0x36, 0x3d, 0x47, 0xe9,	// 05:38
+    0x0, 0x8, 0x12, 0x13, 0x24, 0x32, 0x47, 0xe9,	// 05:39
+    0x0, 0x8, 0x12, 0x13, 0x3d, 0x47, 0xe9,	// 05:40
+    0x0, 0x8, 0x19, 0x1a, 0x3d, 0x47, 0xe9,	// 05:41
+    0x0, 0x8, 0x1b, 0x1c, 0x3d, 0x47, 0xe9,	// 05:42
+    0x0, 0x8, 0x2a, 0x2b, 0x3d, 0x47, 0xe9,	// 05:43
+    0x0, 0x8, 0x9, 0xa, 0x3d, 0x47, 0xe9,	// 05:44
+    0x0, 0x8, 0x2c, 0x2d, 0x47, 0xe9,	// 05:45
+    0x0, 0x8, 0x14, 0x15, 0x3d, 0x47, 0xe9,	// 05:46
+    0x0, 0x8, 0x37, 0x38, 0x3d, 0x47, 0xe9,	// 05:47
+    0x0, 0x8, 0x20, 0x21, 0x3d, 0x47, 0xe9,	// 05:48
+    0x0, 0x8, 0x10, 0x11, 0x3d, 0x47, 0xe9,	// 05:49
+    0x0, 0x8, 0x39, 0x3d, 0x47, 0xe9,	// 05:50
+    0x0, 0x8, 0x3c, 0x3d, 0x47, 0xe9,	// 05:51
+    0x0, 0x8, 0x3b, 0x3d, 0x47, 0xe9,	// 05:52
+    0x0, 0x8, 0x35, 0x3d, 0x47, 0xe9,	// 05:53
+    0x0, 0x8, 0x29, 0x3d, 0x47, 0xe9,	// 05:54
+    0x0, 0x8, 0x34, 0x3d, 0x47, 0xe9,	// 05:55
+    0x0, 0x8, 0x33, 0x3d, 0x47, 0xe9,	// 05:56
+    0x0, 0x8, 0x1e, 0x3d, 0x47, 0xe9,	// 05:57
+    0x0, 0x8, 0x36, 0x3d, 0x47, 0xe9,	// 05:58
+    0x0, 0x8, 0x24, 0x32, 0x47, 0xe9,	// 05:59
+    0x0, 0x3, 0x47, 0x51, 0xe9,	// 06:00
+    0x0, 0x18, 0x3a, 0x5b, 0x5c, 0xe9,	// 06:01
+    0x0, 0x16, 0x32, 0x5b, 0x5c, 0xe9,	// 06:02
+    0x0, 0x48, 0x4a, 0x5b, 0x5c, 0xe9,	// 06:03
+    0x0, 0x46, 0x4a, 0x5b, 0x5c, 0xe9,	// 06:04
+    0x0, 0x4c, 0x50, 0x5b, 0x5c, 0xe9,	// 06:05
+    0x0, 0x47, 0x50, 0x5b, 0x5c, 0xe9,	// 06:06
+    0x0, 0x4d, 0x50, 0x5b, 0x5c, 0xe9,	// 06:07
+    0x0, 0x45, 0x50, 0x5b, 0x5c, 0xe9,	// 06:08
+    0x0, 0x44, 0x50, 0x5b, 0x5c, 0xe9,	// 06:09
+    0x0, 0x43, 0x50, 0x5b, 0x5c, 0xe9,	// 06:10
+    0x0, 0x41, 0x42, 0x50, 0x5b, 0x5c, 0xe9,	// 06:11
+    0x0, 0x3e, 0x40, 0x50, 0x5b, 0x5c, 0xe9,	// 06:12
+    0x0, 0x30, 0x31, 0x3d, 0x5b, 0x5c, 0xe9,	// 06:13
+    0x0, 0xd, 0xe, 0x3d, 0x5b, 0x5c, 0xe9,	// 06:14
+    0x0, 0x25, 0x26, 0x5b, 0x5c, 0xe9,	// 06:15
+    0x0, 0x1, 0x2, 0x3d, 0x5b, 0x5c, 0xe9,	// 06:16
+    0x0, 0x27, 0x28, 0x3d, 0x5b, 0x5c, 0xe9,	// 06:17
+    0x0, 0x6, 0x7, 0x3d, 0x5b, 0x5c, 0xe9,	// 06:18
+    0x0, 0xb, 0xc, 0x3d, 0x5b, 0x5c, 0xe9,	// 06:19
+    0x0, 0x4, 0x5, 0x3d, 0x5b, 0x5c, 0xe9,	// 06:20
+    0x0, 0x4, 0x5, 0x18, 0x3a, 0x5b, 0x5c, 0xe9,	// 06:21
+    0x0, 0x4, 0x5, 0x16, 0x32, 0x5b, 0x5c, 0xe9,	// 06:22
+    0x0, 0x4, 0x5, 0x48, 0x4a, 0x5b, 0x5c, 0xe9,	// 06:23
+    0x0, 0x4, 0x5, 0x46, 0x4a, 0x5b, 0x5c, 0xe9,	// 06:24
+    0x0, 0x4, 0x5, 0x4c, 0x50, 0x5b, 0x5c, 0xe9,	// 06:25
+    0x0, 0x4, 0x5, 0x47, 0x50, 0x5b, 0x5c, 0xe9,	// 06:26
+    0x0, 0x4, 0x5, 0x4d, 0x50, 0x5b, 0x5c, 0xe9,	// 06:27
+    0x0, 0x4, 0x5, 0x45, 0x50, 0x5b, 0x5c, 0xe9,	// 06:28
+    0x0, 0x4, 0x5, 0x44, 0x50, 0x5b, 0x5c, 0xe9,	// 06:29
+    0x0, 0x22, 0x23, 0x5b, 0x5c, 0xe9,	// 06:30
+    0x0, 0x8, 0x12, 0x13, 0x3c, 0x3d, 0x4d, 0xe9,	// 06:31
+    0x0, 0x8, 0x12, 0x13, 0x3b, 0x3d, 0x4d, 0xe9,	// 06:32
+    0x0, 0x8, 0x12, 0x13, 0x35, 0x3d, 0x4d, 0xe9,	// 06:33
+    0x0, 0x8, 0x12, 0x13, 0x29, 0x3d, 0x4d, 0xe9,	// 06:34
+    0x0, 0x8, 0x12, 0x13, 0x34, 0x3d, 0x4d, 0xe9,	// 06:35
+    0x0, 0x8, 0x12, 0x13, 0x33, 0x3d, 0x4d, 0xe9,	// 06:36
+    0x0, 0x8, 0x12, 0x13, 0x1e, 0x3d, 0x4d, 0xe9,	// 06:37
+    0x0, 0x8, 0x12, 0x13, 0x36, 0x3d, 0x4d, 0xe9,	// 06:38
+    0x0, 0x8, 0x12, 0x13, 0x24, 0x32, 0x4d, 0xe9,	// 06:39
+    0x0, 0x8, 0x12, 0x13, 0x3d, 0x4d, 0xe9,	// 06:40
+    0x0, 0x8, 0x19, 0x1a, 0x3d, 0x4d, 0xe9,	// 06:41
+    0x0, 0x8, 0x1b, 0x1c, 0x3d, 0x4d, 0xe9,	// 06:42
+    0x0, 0x8, 0x2a, 0x2b, 0x3d, 0x4d, 0xe9,	// 06:43
+    0x0, 0x8, 0x9, 0xa, 0x3d, 0x4d, 0xe9,	// 06:44
+    0x0, 0x8, 0x2c, 0x2d, 0x4d, 0xe9,	// 06:45
+    0x0, 0x8, 0x14, 0x15, 0x3d, 0x4d, 0xe9,	// 06:46
+    0x0, 0x8, 0x37, 0x38, 0x3d, 0x4d, 0xe9,	// 06:47
+    0x0, 0x8, 0x20, 0x21, 0x3d, 0x4d, 0xe9,	// 06:48
+    0x0, 0x8, 0x10, 0x11, 0x3d, 0x4d, 0xe9,	// 06:49
+    0x0, 0x8, 0x39, 0x3d, 0x4d, 0xe9,	// 06:50
+    0x0, 0x8, 0x3c, 0x3d, 0x4d, 0xe9,	// 06:51
+    0x0, 0x8, 0x3b, 0x3d, 0x4d, 0xe9,	// 06:52
+    0x0, 0x8, 0x35, 0x3d, 0x4d, 0xe9,	// 06:53
+    0x0, 0x8, 0x29, 0x3d, 0x4d, 0xe9,	// 06:54
+    0x0, 0x8, 0x34, 0x3d, 0x4d, 0xe9,	// 06:55
+    0x0, 0x8, 0x33, 0x3d, 0x4d, 0xe9,	// 06:56
+    0x0, 0x8, 0x1e, 0x3d, 0x4d, 0xe9,	// 06:57
+    0x0, 0x8, 0x36, 0x3d, 0x4d, 0xe9,	// 06:58
+    0x0, 0x8, 0x24, 0x32, 0x4d, 0xe9,	// 06:59
+    0x0, 0x3, 0x4d, 0x51, 0xe9,	// 07:00
+    0x0, 0x18, 0x3a, 0x5d, 0x5e, 0xe9,	// 07:01
+    0x0, 0x16, 0x32, 0x5d, 0x5e, 0xe9,	// 07:02
+    0x0, 0x48, 0x4a, 0x5d, 0x5e, 0xe9,	// 07:03
+    0x0, 0x46, 0x4a, 0x5d, 0x5e, 0xe9,	// 07:04
+    0x0, 0x4c, 0x50, 0x5d, 0x5e, 0xe9,	// 07:05
+    0x0, 0x47, 0x50, 0x5d, 0x5e, 0xe9,	// 07:06
+    0x0, 0x4d, 0x50, 0x5d, 0x5e, 0xe9,	// 07:07
+    0x0, 0x45, 0x50, 0x5d, 0x5e, 0xe9,	// 07:08
+    0x0, 0x44, 0x50, 0x5d, 0x5e, 0xe9,	// 07:09
+    0x0, 0x43, 0x50, 0x5d, 0x5e, 0xe9,	// 07:10
+    0x0, 0x41, 0x42, 0x50, 0x5d, 0x5e, 0xe9,	// 07:11
+    0x0, 0x3e, 0x40, 0x50, 0x5d, 0x5e, 0xe9,	// 07:12
+    0x0, 0x30, 0x31, 0x3d, 0x5d, 0x5e, 0xe9,	// 07:13
+    0x0, 0xd, 0xe, 0x3d, 0x5d, 0x5e, 0xe9,	// 07:14
+    0x0, 0x25, 0x26, 0x5d, 0x5e, 0xe9,	// 07:15
+    0x0, 0x1, 0x2, 0x3d, 0x5d, 0x5e, 0xe9,	// 07:16
+    0x0, 0x27, 0x28, 0x3d, 0x5d, 0x5e, 0xe9,	// 07:17
+    0x0, 0x6, 0x7, 0x3d, 0x5d, 0x5e, 0xe9,	// 07:18
+    0x0, 0xb, 0xc, 0x3d, 0x5d, 0x5e, 0xe9,	// 07:19
+    0x0, 0x4, 0x5, 0x3d, 0x5d, 0x5e, 0xe9,	// 07:20
+    0x0, 0x4, 0x5, 0x18, 0x3a, 0x5d, 0x5e, 0xe9,	// 07:21
+    0x0, 0x4, 0x5, 0x16, 0x32, 0x5d, 0x5e, 0xe9,	// 07:22
+    0x0, 0x4, 0x5, 0x48, 0x4a, 0x5d, 0x5e, 0xe9,	// 07:23
+    0x0, 0x4, 0x5, 0x46, 0x4a, 0x5d, 0x5e, 0xe9,	// 07:24
+    0x0, 0x4, 0x5, 0x4c, 0x50, 0x5d, 0x5e, 0xe9,	// 07:25
+    0x0, 0x4, 0x5, 0x47, 0x50, 0x5d, 0x5e, 0xe9,	// 07:26
+    0x0, 0x4, 0x5, 0x4d, 0x50, 0x5d, 0x5e, 0xe9,	// 07:27
+    0x0, 0x4, 0x5, 0x45, 0x50, 0x5d, 0x5e, 0xe9,	// 07:28
+    0x0, 0x4, 0x5, 0x44, 0x50, 0x5d, 0x5e, 0xe9,	// 07:29
+    0x0, 0x22, 0x23, 0x5d, 0x5e, 0xe9,	// 07:30
+    0x0, 0x8, 0x12, 0x13, 0x3c, 0x3d, 0x45, 0xe9,	// 07:31
+    0x0, 0x8, 0x12, 0x13, 0x3b, 0x3d, 0x45, 0xe9,	// 07:32
+    0x0, 0x8, 0x12, 0x13, 0x35, 0x3d, 0x45, 0xe9,	// 07:33
+    0x0, 0x8, 0x12, 0x13, 0x29, 0x3d, 0x45, 0xe9,	// 07:34
+    0x0, 0x8, 0x12, 0x13, 0x34, 0x3d, 0x45, 0xe9,	// 07:35
+    0x0, 0x8, 0x12, 0x13, 0x33, 0x3d, 0x45, 0xe9,	// 07:36
+    0x0, 0x8, 0x12, 0x13, 0x1e, 0x3d, 0x45, 0xe9,	// 07:37
+    0x0, 0x8, 0x12, 0x13, 0x36, 0x3d, 0x45, 0xe9,	// 07:38
+    0x0, 0x8, 0x12, 0x13, 0x24, 0x32, 0x45, 0xe9,	// 07:39
+    0x0, 0x8, 0x12, 0x13, 0x3d, 0x45, 0xe9,	// 07:40
+    0x0, 0x8, 0x19, 0x1a, 0x3d, 0x45, 0xe9,	// 07:41
+    0x0, 0x8, 0x1b, 0x1c, 0x3d, 0x45, 0xe9,	// 07:42
+    0x0, 0x8, 0x2a, 0x2b, 0x3d, 0x45, 0xe9,	// 07:43
+    0x0, 0x8, 0x9, 0xa, 0x3d, 0x45, 0xe9,	// 07:44
+    0x0, 0x8, 0x2c, 0x2d, 0x45, 0xe9,	// 07:45
+    0x0, 0x8, 0x14, 0x15, 0x3d, 0x45, 0xe9,	// 07:46
+    0x0, 0x8, 0x37, 0x38, 0x3d, 0x45, 0xe9,	// 07:47
+    0x0, 0x8, 0x20, 0x21, 0x3d, 0x45, 0xe9,	// 07:48
+    0x0, 0x8, 0x10, 0x11, 0x3d, 0x45, 0xe9,	// 07:49
+    0x0, 0x8, 0x39, 0x3d, 0x45, 0xe9,	// 07:50
+    0x0, 0x8, 0x3c, 0x3d, 0x45, 0xe9,	// 07:51
+    0x0, 0x8, 0x3b, 0x3d, 0x45, 0xe9,	// 07:52
+    0x0, 0x8, 0x35, 0x3d, 0x45, 0xe9,	// 07:53
+    0x0, 0x8, 0x29, 0x3d, 0x45, 0xe9,	// 07:54
+    0x0, 0x8, 0x34, 0x3d, 0x45, 0xe9,	// 07:55
+    0x0, 0x8, 0x33, 0x3d, 0x45, 0xe9,	// 07:56
+    0x0, 0x8, 0x1e, 0x3d, 0x45, 0xe9,	// 07:57
+    0x0, 0x8, 0x36, 0x3d, 0x45, 0xe9,	// 07:58
+    0x0, 0x8, 0x24, 0x32, 0x45, 0xe9,	// 07:59
+    0x0, 0x3, 0x45, 0x51, 0xe9,	// 08:00
+    0x0, 0x18, 0x3a, 0x67, 0x68, 0xe9,	// 08:01
+    0x0, 0x16, 0x32, 0x67, 0x68, 0xe9,	// 08:02
+    0x0, 0x48, 0x4a, 0x67, 0x68, 0xe9,	// 08:03
+    0x0, 0x46, 0x4a, 0x67, 0x68, 0xe9,	// 08:04
+    0x0, 0x4c, 0x50, 0x67, 0x68, 0xe9,	// 08:05
+    0x0, 0x47, 0x50, 0x67, 0x68, 0xe9,	// 08:06
+    0x0, 0x4d, 0x50, 0x67, 0x68, 0xe9,	// 08:07
+    0x0, 0x45, 0x50, 0x67, 0x68, 0xe9,	// 08:08
+    0x0, 0x44, 0x50, 0x67, 0x68, 0xe9,	// 08:09
+    0x0, 0x43, 0x50, 0x67, 0x68, 0xe9,	// 08:10
+    0x0, 0x41, 0x42, 0x50, 0x67, 0x68, 0xe9,	// 08:11
+    0x0, 0x3e, 0x40, 0x50, 0x67, 0x68, 0xe9,	// 08:12
+    0x0, 0x30, 0x31, 0x3d, 0x67, 0x68, 0xe9,	// 08:13
+    0x0, 0xd, 0xe, 0x3d, 0x67, 0x68, 0xe9,	// 08:14
+    0x0, 0x25, 0x26, 0x67, 0x68, 0xe9,	// 08:15
+    0x0, 0x1, 0x2, 0x3d, 0x67, 0x68, 0xe9,	// 08:16
+    0x0, 0x27, 0x28, 0x3d, 0x67, 0x68, 0xe9,	// 08:17
+    0x0, 0x6, 0x7, 0x3d, 0x67, 0x68, 0xe9,	// 08:18
+    0x0, 0xb, 0xc, 0x3d, 0x67, 0x68, 0xe9,	// 08:19
+    0x0, 0x4, 0x5, 0x3d, 0x67, 0x68, 0xe9,	// 08:20
+    0x0, 0x4, 0x5, 0x18, 0x3a, 0x67, 0x68, 0xe9,	// 08:21
+    0x0, 0x4, 0x5, 0x16, 0x32, 0x67, 0x68, 0xe9,	// 08:22
+    0x0, 0x4, 0x5, 0x48, 0x4a, 0x67, 0x68, 0xe9,	// 08:23
+    0x0, 0x4, 0x5, 0x46, 0x4a, 0x67, 0x68, 0xe9,	// 08:24
+    0x0, 0x4, 0x5, 0x4c, 0x50, 0x67, 0x68, 0xe9,	// 08:25
+    0x0, 0x4, 0x5, 0x47, 0x50, 0x67, 0x68, 0xe9,	// 08:26
+    0x0, 0x4, 0x5, 0x4d, 0x50, 0x67, 0x68, 0xe9,	// 08:27
+    0x0, 0x4, 0x5, 0x45, 0x50, 0x67, 0x68, 0xe9,	// 08:28
+    0x0, 0x4, 0x5, 0x44, 0x50, 0x67, 0x68, 0xe9,	// 08:29
+    0x0, 0x22, 0x23, 0x67, 0x68, 0xe9,	// 08:30
+    0x0, 0x8, 0x12, 0x13, 0x3c, 0x3d, 0x44, 0xe9,	// 08:31
+    0x0, 0x8, 0x12, 0x13, 0x3b, 0x3d, 0x44, 0xe9,	// 08:32
+    0x0, 0x8, 0x12, 0x13, 0x35, 0x3d, 0x44, 0xe9,	// 08:33
+    0x0, 0x8, 0x12, 0x13, 0x29, 0x3d, 0x44, 0xe9,	// 08:34
+    0x0, 0x8, 0x12, 0x13, 0x34, 0x3d, 0x44, 0xe9,	// 08:35
+    0x0, 0x8, 0x12, 0x13, 0x33, 0x3d, 0x44, 0xe9,	// 08:36
+    0x0, 0x8, 0x12, 0x13, 0x1e, 0x3d, 0x44, 0xe9,	// 08:37
+    0x0, 0x8, 0x12, 0x13, 0x36, 0x3d, 0x44, 0xe9,	// 08:38
+    0x0, 0x8, 0x12, 0x13, 0x24, 0x32, 0x44, 0xe9,	// 08:39
+    0x0, 0x8, 0x12, 0x13, 0x3d, 0x44, 0xe9,	// 08:40
+    0x0, 0x8, 0x19, 0x1a, 0x3d, 0x44, 0xe9,	// 08:41
+    0x0, 0x8, 0x1b, 0x1c, 0x3d, 0x44, 0xe9,	// 08:42
+    0x0, 0x8, 0x2a, 0x2b, 0x3d, 0x44, 0xe9,	// 08:43
+    0x0, 0x8, 0x9, 0xa, 0x3d, 0x44, 0xe9,	// 08:44
+    0x0, 0x8, 0x2c, 0x2d, 0x44, 0xe9,	// 08:45
+    0x0, 0x8, 0x14, 0x15, 0x3d, 0x44, 0xe9,	// 08:46
+    0x0, 0x8, 0x37, 0x38, 0x3d, 0x44, 0xe9,	// 08:47
+    0x0, 0x8, 0x20, 0x21, 0x3d, 0x44, 0xe9,	// 08:48
+    0x0, 0x8, 0x10, 0x11, 0x3d, 0x44, 0xe9,	// 08:49
+    0x0, 0x8, 0x39, 0x3d, 0x44, 0xe9,	// 08:50
+    0x0, 0x8, 0x3c, 0x3d, 0x44, 0xe9,	// 08:51
+    0x0, 0x8, 0x3b, 0x3d, 0x44, 0xe9,	// 08:52
+    0x0, 0x8, 0x35, 0x3d, 0x44, 0xe9,	// 08:53
+    0x0, 0x8, 0x29, 0x3d, 0x44, 0xe9,	// 08:54
+    0x0, 0x8, 0x34, 0x3d, 0x44, 0xe9,	// 08:55
+    0x0, 0x8, 0x33, 0x3d, 0x44, 0xe9,	// 08:56
+    0x0, 0x8, 0x1e, 0x3d, 0x44, 0xe9,	// 08:57
+    0x0, 0x8, 0x36, 0x3d, 0x44, 0xe9,	// 08:58
+    0x0, 0x8, 0x24, 0x32, 0x44, 0xe9,	// 08:59
+    0x0, 0x3, 0x44, 0x51, 0xe9,	// 09:00
+    0x0, 0x18, 0x3a, 0x60, 0x61, 0xe9,	// 09:01
+    0x0, 0x16, 0x32, 0x60, 0x61, 0xe9,	// 09:02
+    0x0, 0x48, 0x4a, 0x60, 0x61, 0xe9,	// 09:03
+    0x0, 0x46, 0x4a, 0x60, 0x61, 0xe9,	// 09:04
+    0x0, 0x4c, 0x50, 0x60, 0x61, 0xe9,	// 09:05
+    0x0, 0x47, 0x50, 0x60, 0x61, 0xe9,	// 09:06
+    0x0, 0x4d, 0x50, 0x60, 0x61, 0xe9,	// 09:07
+    0x0, 0x45, 0x50, 0x60, 0x61, 0xe9,	// 09:08
+    0x0, 0x44, 0x50, 0x60, 0x61, 0xe9,	// 09:09
+    0x0, 0x43, 0x50, 0x60, 0x61, 0xe9,	// 09:10
+    0x0, 0x41, 0x42, 0x50, 0x60, 0x61, 0xe9,	// 09:11
+    0x0, 0x3e, 0x40, 0x50, 0x60, 0x61, 0xe9,	// 09:12
+    0x0, 0x30, 0x31, 0x3d, 0x60, 0x61, 0xe9,	// 09:13
+    0x0, 0xd, 0xe, 0x3d, 0x60, 0x61, 0xe9,	// 09:14
+    0x0, 0x25, 0x26, 0x60, 0x61, 0xe9,	// 09:15
+    0x0, 0x1, 0x2, 0x3d, 0x60, 0x61, 0xe9,	// 09:16
+    0x0, 0x27, 0x28, 0x3d, 0x60, 0x61, 0xe9,	// 09:17
+    0x0, 0x6, 0x7, 0x3d, 0x60, 0x61, 0xe9,	// 09:18
+    0x0, 0xb, 0xc, 0x3d, 0x60, 0x61, 0xe9,	// 09:19
+    0x0, 0x4, 0x5, 0x3d, 0x60, 0x61, 0xe9,	// 09:20
+    0x0, 0x4, 0x5, 0x18, 0x3a, 0x60, 0x61, 0xe9,	// 09:21
+    0x0, 0x4, 0x5, 0x16, 0x32, 0x60, 0x61, 0xe9,	// 09:22
+    0x0, 0x4, 0x5, 0x48, 0x4a, 0x60, 0x61, 0xe9,	// 09:23
+    0x0, 0x4, 0x5, 0x46, 0x4a, 0x60, 0x61, 0xe9,	// 09:24
+    0x0, 0x4, 0x5, 0x4c, 0x50, 0x60, 0x61, 0xe9,	// 09:25
+    0x0, 0x4, 0x5, 0x47, 0x50, 0x60, 0x61, 0xe9,	// 09:26
+    0x0, 0x4, 0x5, 0x4d, 0x50, 0x60, 0x61, 0xe9,	// 09:27
+    0x0, 0x4, 0x5, 0x45, 0x50, 0x60, 0x61, 0xe9,	// 09:28
+    0x0, 0x4, 0x5, 0x44, 0x50, 0x60, 0x61, 0xe9,	// 09:29
+    0x0, 0x22, 0x23, 0x60, 0x61, 0xe9,	// 09:30
+    0x0, 0x8, 0x12, 0x13, 0x3c, 0x3d, 0x43, 0xe9,	// 09:31
+    0x0, 0x8, 0x12, 0x13, 0x3b, 0x3d, 0x43, 0xe9,	// 09:32
+    0x0, 0x8, 0x12, 0x13, 0x35, 0x3d, 0x43, 0xe9,	// 09:33
+    0x0, 0x8, 0x12, 0x13, 0x29, 0x3d, 0x43, 0xe9,	// 09:34
+    0x0, 0x8, 0x12, 0x13, 0x34, 0x3d, 0x43, 0xe9,	// 09:35
+    0x0, 0x8, 0x12, 0x13, 0x33, 0x3d, 0x43, 0xe9,	// 09:36
+    0x0, 0x8, 0x12, 0x13, 0x1e, 0x3d, 0x43, 0xe9,	// 09:37
+    0x0, 0x8, 0x12, 0x13, 0x36, 0x3d, 0x43, 0xe9,	// 09:38
+    0x0, 0x8, 0x12, 0x13, 0x24, 0x32, 0x43, 0xe9,	// 09:39
+    0x0, 0x8, 0x12, 0x13, 0x3d, 0x43, 0xe9,	// 09:40
+    0x0, 0x8, 0x19, 0x1a, 0x3d, 0x43, 0xe9,	// 09:41
+    0x0, 0x8, 0x1b, 0x1c, 0x3d, 0x43, 0xe9,	// 09:42
+    0x0, 0x8, 0x2a, 0x2b, 0x3d, 0x43, 0xe9,	// 09:43
+    0x0, 0x8, 0x9, 0xa, 0x3d, 0x43, 0xe9,	// 09:44
+    0x0, 0x8, 0x2c, 0x2d, 0x43, 0xe9,	// 09:45
+    0x0, 0x8, 0x14, 0x15, 0x3d, 0x43, 0xe9,	// 09:46
+    0x0, 0x8, 0x37, 0x38, 0x3d, 0x43, 0xe9,	// 09:47
+    0x0, 0x8, 0x20, 0x21, 0x3d, 0x43, 0xe9,	// 09:48
+    0x0, 0x8, 0x10, 0x11, 0x3d, 0x43, 0xe9,	// 09:49
+    0x0, 0x8, 0x39, 0x3d, 0x43, 0xe9,	// 09:50
+    0x0, 0x8, 0x3c, 0x3d, 0x43, 0xe9,	// 09:51
+    0x0, 0x8, 0x3b, 0x3d, 0x43, 0xe9,	// 09:52
+    0x0, 0x8, 0x35, 0x3d, 0x43, 0xe9,	// 09:53
+    0x0, 0x8, 0x29, 0x3d, 0x43, 0xe9,	// 09:54
+    0x0, 0x8, 0x34, 0x3d, 0x43, 0xe9,	// 09:55
+    0x0, 0x8, 0x33, 0x3d, 0x43, 0xe9,	// 09:56
+    0x0, 0x8, 0x1e, 0x3d, 0x43, 0xe9,	// 09:57
+    0x0, 0x8, 0x36, 0x3d, 0x43, 0xe9,	// 09:58
+    0x0, 0x8, 0x24, 0x32, 0x43, 0xe9,	// 09:59
+    0x0, 0x3, 0x43, 0x51, 0xe9,	// 10:00
+    0x0, 0x18, 0x3a, 0x54, 0x55, 0xe9,	// 10:01
+    0x0, 0x16, 0x32, 0x54, 0x55, 0xe9,	// 10:02
+    0x0, 0x48, 0x4a, 0x54, 0x55, 0xe9,	// 10:03
+    0x0, 0x46, 0x4a, 0x54, 0x55, 0xe9,	// 10:04
+    0x0, 0x4c, 0x50, 0x54, 0x55, 0xe9,	// 10:05
+    0x0, 0x47, 0x50, 0x54, 0x55, 0xe9,	// 10:06
+    0x0, 0x4d, 0x50, 0x54, 0x55, 0xe9,	// 10:07
+    0x0, 0x45, 0x50, 0x54, 0x55, 0xe9,	// 10:08
+    0x0, 0x44, 0x50, 0x54, 0x55, 0xe9,	// 10:09
+    0x0, 0x43, 0x50, 0x54, 0x55, 0xe9,	// 10:10
+    0x0, 0x41, 0x42, 0x50, 0x54, 0x55, 0xe9,	// 10:11
+    0x0, 0x3e, 0x40, 0x50, 0x54, 0x55, 0xe9,	// 10:12
+    0x0, 0x30, 0x31, 0x3d, 0x54, 0x55, 0xe9,	// 10:13
+    0x0, 0xd, 0xe, 0x3d, 0x54, 0x55, 0xe9,	// 10:14
+    0x0, 0x25, 0x26, 0x54, 0x55, 0xe9,	// 10:15
+    0x0, 0x1, 0x2, 0x3d, 0x54, 0x55, 0xe9,	// 10:16
+    0x0, 0x27, 0x28, 0x3d, 0x54, 0x55, 0xe9,	// 10:17
+    0x0, 0x6, 0x7, 0x3d, 0x54, 0x55, 0xe9,	// 10:18
+    0x0, 0xb, 0xc, 0x3d, 0x54, 0x55, 0xe9,	// 10:19
+    0x0, 0x4, 0x5, 0x3d, 0x54, 0x55, 0xe9,	// 10:20
+    0x0, 0x4, 0x5, 0x18, 0x3a, 0x54, 0x55, 0xe9,	// 10:21
+    0x0, 0x4, 0x5, 0x16, 0x32, 0x54, 0x55, 0xe9,	// 10:22
+    0x0, 0x4, 0x5, 0x48, 0x4a, 0x54, 0x55, 0xe9,	// 10:23
+    0x0, 0x4, 0x5, 0x46, 0x4a, 0x54, 0x55, 0xe9,	// 10:24
+    0x0, 0x4, 0x5, 0x4c, 0x50, 0x54, 0x55, 0xe9,	// 10:25
+    0x0, 0x4, 0x5, 0x47, 0x50, 0x54, 0x55, 0xe9,	// 10:26
+    0x0, 0x4, 0x5, 0x4d, 0x50, 0x54, 0x55, 0xe9,	// 10:27
+    0x0, 0x4, 0x5, 0x45, 0x50, 0x54, 0x55, 0xe9,	// 10:28
+    0x0, 0x4, 0x5, 0x44, 0x50, 0x54, 0x55, 0xe9,	// 10:29
+    0x0, 0x22, 0x23, 0x54, 0x55, 0xe9,	// 10:30
+    0x0, 0x8, 0x12, 0x13, 0x3c, 0x3d, 0x41, 0x42, 0xe9,	// 10:31
+    0x0, 0x8, 0x12, 0x13, 0x3b, 0x3d, 0x41, 0x42, 0xe9,	// 10:32
+    0x0, 0x8, 0x12, 0x13, 0x35, 0x3d, 0x41, 0x42, 0xe9,	// 10:33
+    0x0, 0x8, 0x12, 0x13, 0x29, 0x3d, 0x41, 0x42, 0xe9,	// 10:34
+    0x0, 0x8, 0x12, 0x13, 0x34, 0x3d, 0x41, 0x42, 0xe9,	// 10:35
+    0x0, 0x8, 0x12, 0x13, 0x33, 0x3d, 0x41, 0x42, 0xe9,	// 10:36
+    0x0, 0x8, 0x12, 0x13, 0x1e, 0x3d, 0x41, 0x42, 0xe9,	// 10:37
+    0x0, 0x8, 0x12, 0x13, 0x36, 0x3d, 0x41, 0x42, 0xe9,	// 10:38
+    0x0, 0x8, 0x12, 0x13, 0x24, 0x32, 0x41, 0x42, 0xe9,	// 10:39
+    0x0, 0x8, 0x12, 0x13, 0x3d, 0x41, 0x42, 0xe9,	// 10:40
+    0x0, 0x8, 0x19, 0x1a, 0x3d, 0x41, 0x42, 0xe9,	// 10:41
+    0x0, 0x8, 0x1b, 0x1c, 0x3d, 0x41, 0x42, 0xe9,	// 10:42
+    0x0, 0x8, 0x2a, 0x2b, 0x3d, 0x41, 0x42, 0xe9,	// 10:43
+    0x0, 0x8, 0x9, 0xa, 0x3d, 0x41, 0x42, 0xe9,	// 10:44
+    0x0, 0x8, 0x2c, 0x2d, 0x41, 0x42, 0xe9,	// 10:45
+    0x0, 0x8, 0x14, 0x15, 0x3d, 0x41, 0x42, 0xe9,	// 10:46
+    0x0, 0x8, 0x37, 0x38, 0x3d, 0x41, 0x42, 0xe9,	// 10:47
+    0x0, 0x8, 0x20, 0x21, 0x3d, 0x41, 0x42, 0xe9,	// 10:48
+    0x0, 0x8, 0x10, 0x11, 0x3d, 0x41, 0x42, 0xe9,	// 10:49
+    0x0, 0x8, 0x39, 0x3d, 0x41, 0x42, 0xe9,	// 10:50
+    0x0, 0x8, 0x3c, 0x3d, 0x41, 0x42, 0xe9,	// 10:51
+    0x0, 0x8, 0x3b, 0x3d, 0x41, 0x42, 0xe9,	// 10:52
+    0x0, 0x8, 0x35, 0x3d, 0x41, 0x42, 0xe9,	// 10:53
+    0x0, 0x8, 0x29, 0x3d, 0x41, 0x42, 0xe9,	// 10:54
+    0x0, 0x8, 0x34, 0x3d, 0x41, 0x42, 0xe9,	// 10:55
+    0x0, 0x8, 0x33, 0x3d, 0x41, 0x42, 0xe9,	// 10:56
+    0x0, 0x8, 0x1e, 0x3d, 0x41, 0x42, 0xe9,	// 10:57
+    0x0, 0x8, 0x36, 0x3d, 0x41, 0x42, 0xe9,	// 10:58
+    0x0, 0x8, 0x24, 0x32, 0x41, 0x42, 0xe9,	// 10:59
+    0x0, 0x3, 0x41, 0x42, 0x51, 0xe9,	// 11:00
+    0x0, 0x18, 0x3a, 0x52, 0x53, 0xe9,	// 11:01
+    0x0, 0x16, 0x32, 0x52, 0x53, 0xe9,	// 11:02
+    0x0, 0x48, 0x4a, 0x52, 0x53, 0xe9,	// 11:03
+    0x0, 0x46, 0x4a, 0x52, 0x53, 0xe9,	// 11:04
+    0x0, 0x4c, 0x50, 0x52, 0x53, 0xe9,	// 11:05
+    0x0, 0x47, 0x50, 0x52, 0x53, 0xe9,	// 11:06
+    0x0, 0x4d, 0x50, 0x52, 0x53, 0xe9,	// 11:07
+    0x0, 0x45, 0x50, 0x52, 0x53, 0xe9,	// 11:08
+    0x0, 0x44, 0x50, 0x52, 0x53, 0xe9,	// 11:09
+    0x0, 0x43, 0x50, 0x52, 0x53, 0xe9,	// 11:10
+    0x0, 0x41, 0x42, 0x50, 0x52, 0x53, 0xe9,	// 11:11
+    0x0, 0x3e, 0x40, 0x50, 0x52, 0x53, 0xe9,	// 11:12
+    0x0, 0x30, 0x31, 0x3d, 0x52, 0x53, 0xe9,	// 11:13
+    0x0, 0xd, 0xe, 0x3d, 0x52, 0x53, 0xe9,	// 11:14
+    0x0, 0x25, 0x26, 0x52, 0x53, 0xe9,	// 11:15
+    0x0, 0x1, 0x2, 0x3d, 0x52, 0x53, 0xe9,	// 11:16
+    0x0, 0x27, 0x28, 0x3d, 0x52, 0x53, 0xe9,	// 11:17
+    0x0, 0x6, 0x7, 0x3d, 0x52, 0x53, 0xe9,	// 11:18
+    0x0, 0xb, 0xc, 0x3d, 0x52, 0x53, 0xe9,	// 11:19
+    0x0, 0x4, 0x5, 0x3d, 0x52, 0x53, 0xe9,	// 11:20
+    0x0, 0x4, 0x5, 0x18, 0x3a, 0x52, 0x53, 0xe9,	// 11:21
+    0x0, 0x4, 0x5, 0x16, 0x32, 0x52, 0x53, 0xe9,	// 11:22
+    0x0, 0x4, 0x5, 0x48, 0x4a, 0x52, 0x53, 0xe9,	// 11:23
+    0x0, 0x4, 0x5, 0x46, 0x4a, 0x52, 0x53, 0xe9,	// 11:24
+    0x0, 0x4, 0x5, 0x4c, 0x50, 0x52, 0x53, 0xe9,	// 11:25
+    0x0, 0x4, 0x5, 0x47, 0x50, 0x52, 0x53, 0xe9,	// 11:26
+    0x0, 0x4, 0x5, 0x4d, 0x50, 0x52, 0x53, 0xe9,	// 11:27
+    0x0, 0x4, 0x5, 0x45, 0x50, 0x52, 0x53, 0xe9,	// 11:28
+    0x0, 0x4, 0x5, 0x44, 0x50, 0x52, 0x53, 0xe9,	// 11:29
+    0x0, 0x22, 0x23, 0x52, 0x53, 0xe5,	// 11:30
+    0x0, 0x8, 0x12, 0x13, 0x3c, 0x3d, 0x3e, 0x40, 0xe5,	// 11:31
+    0x0, 0x8, 0x12, 0x13, 0x3b, 0x3d, 0x3e, 0x40, 0xe5,	// 11:32
+    0x0, 0x8, 0x12, 0x13, 0x35, 0x3d, 0x3e, 0x40, 0xe5,	// 11:33
+    0x0, 0x8, 0x12, 0x13, 0x29, 0x3d, 0x3e, 0x40, 0xe5,	// 11:34
+    0x0, 0x8, 0x12, 0x13, 0x34, 0x3d, 0x3e, 0x40, 0xe5,	// 11:35
+    0x0, 0x8, 0x12, 0x13, 0x33, 0x3d, 0x3e, 0x40, 0xe5,	// 11:36
+    0x0, 0x8, 0x12, 0x13, 0x1e, 0x3d, 0x3e, 0x40, 0xe5,	// 11:37
+    0x0, 0x8, 0x12, 0x13, 0x36, 0x3d, 0x3e, 0x40, 0xe5,	// 11:38
+    0x0, 0x8, 0x12, 0x13, 0x24, 0x32, 0x3e, 0x40, 0xe5,	// 11:39
+    0x0, 0x8, 0x12, 0x13, 0x3d, 0x3e, 0x40, 0xe5,	// 11:40
+    0x0, 0x8, 0x19, 0x1a, 0x3d, 0x3e, 0x40, 0xe5,	// 11:41
+    0x0, 0x8, 0x1b, 0x1c, 0x3d, 0x3e, 0x40, 0xe5,	// 11:42
+    0x0, 0x8, 0x2a, 0x2b, 0x3d, 0x3e, 0x40, 0xe5,	// 11:43
+    0x0, 0x8, 0x9, 0xa, 0x3d, 0x3e, 0x40, 0xe5,	// 11:44
+    0x0, 0x8, 0x2c, 0x2d, 0x3e, 0x40, 0xe5,	// 11:45
+    0x0, 0x8, 0x14, 0x15, 0x3d, 0x3e, 0x40, 0xe5,	// 11:46
+    0x0, 0x8, 0x37, 0x38, 0x3d, 0x3e, 0x40, 0xe5,	// 11:47
+    0x0, 0x8, 0x20, 0x21, 0x3d, 0x3e, 0x40, 0xe5,	// 11:48
+    0x0, 0x8, 0x10, 0x11, 0x3d, 0x3e, 0x40, 0xe5,	// 11:49
+    0x0, 0x8, 0x39, 0x3d, 0x3e, 0x40, 0xe5,	// 11:50
+    0x0, 0x8, 0x3c, 0x3d, 0x3e, 0x40, 0xe5,	// 11:51
+    0x0, 0x8, 0x3b, 0x3d, 0x3e, 0x40, 0xe5,	// 11:52
+    0x0, 0x8, 0x35, 0x3d, 0x3e, 0x40, 0xe5,	// 11:53
+    0x0, 0x8, 0x29, 0x3d, 0x3e, 0x40, 0xe5,	// 11:54
+    0x0, 0x8, 0x34, 0x3d, 0x3e, 0x40, 0xe5,	// 11:55
+    0x0, 0x8, 0x33, 0x3d, 0x3e, 0x40, 0xe5,	// 11:56
+    0x0, 0x8, 0x1e, 0x3d, 0x3e, 0x40, 0xe5,	// 11:57
+    0x0, 0x8, 0x36, 0x3d, 0x3e, 0x40, 0xe5,	// 11:58
+    0x0, 0x8, 0x24, 0x32, 0x3e, 0x40, 0xe5,	// 11:59
+    0x0, 0x9d,	// 12:00
+    0x0, 0x18, 0x3a, 0x62, 0xe5,	// 12:01
+    0x0, 0x16, 0x32, 0x62, 0xe5,	// 12:02
+    0x0, 0x48, 0x4a, 0x62, 0xe5,	// 12:03
+    0x0, 0x46, 0x4a, 0x62, 0xe5,	// 12:04
+    0x0, 0x4c, 0x50, 0x62, 0xe5,	// 12:05
+    0x0, 0x47, 0x50, 0x62, 0xe5,	// 12:06
+    0x0, 0x4d, 0x50, 0x62, 0xe5,	// 12:07
+    0x0, 0x45, 0x50, 0x62, 0xe5,	// 12:08
+    0x0, 0x44, 0x50, 0x62, 0xe5,	// 12:09
+    0x0, 0x43, 0x50, 0x62, 0xe5,	// 12:10
+    0x0, 0x41, 0x42, 0x50, 0x62, 0xe5,	// 12:11
+    0x0, 0x3e, 0x40, 0x50, 0x62, 0xe5,	// 12:12
+    0x0, 0x30, 0x31, 0x3d, 0x62, 0xe5,	// 12:13
+    0x0, 0xd, 0xe, 0x3d, 0x62, 0xe5,	// 12:14
+    0x0, 0x25, 0x26, 0x62, 0xe5,	// 12:15
+    0x0, 0x1, 0x2, 0x3d, 0x62, 0xe5,	// 12:16
+    0x0, 0x27, 0x28, 0x3d, 0x62, 0xe5,	// 12:17
+    0x0, 0x6, 0x7, 0x3d, 0x62, 0xe5,	// 12:18
+    0x0, 0xb, 0xc, 0x3d, 0x62, 0xe5,	// 12:19
+    0x0, 0x4, 0x5, 0x3d, 0x62, 0xe5,	// 12:20
+    0x0, 0x4, 0x5, 0x18, 0x3a, 0x62, 0xe5,	// 12:21
+    0x0, 0x4, 0x5, 0x16, 0x32, 0x62, 0xe5,	// 12:22
+    0x0, 0x4, 0x5, 0x48, 0x4a, 0x62, 0xe5,	// 12:23
+    0x0, 0x4, 0x5, 0x46, 0x4a, 0x62, 0xe5,	// 12:24
+    0x0, 0x4, 0x5, 0x4c, 0x50, 0x62, 0xe5,	// 12:25
+    0x0, 0x4, 0x5, 0x47, 0x50, 0x62, 0xe5,	// 12:26
+    0x0, 0x4, 0x5, 0x4d, 0x50, 0x62, 0xe5,	// 12:27
+    0x0, 0x4, 0x5, 0x45, 0x50, 0x62, 0xe5,	// 12:28
+    0x0, 0x4, 0x5, 0x44, 0x50, 0x62, 0xe5,	// 12:29
+    0x0, 0x22, 0x23, 0x62, 0xe5,	// 12:30
+    0x0, 0x8, 0x12, 0x13, 0x3c, 0x3d, 0x4b, 0xe5,	// 12:31
+    0x0, 0x8, 0x12, 0x13, 0x3b, 0x3d, 0x4b, 0xe5,	// 12:32
+    0x0, 0x8, 0x12, 0x13, 0x35, 0x3d, 0x4b, 0xe5,	// 12:33
+    0x0, 0x8, 0x12, 0x13, 0x29, 0x3d, 0x4b, 0xe5,	// 12:34
+    0x0, 0x8, 0x12, 0x13, 0x34, 0x3d, 0x4b, 0xe5,	// 12:35
+    0x0, 0x8, 0x12, 0x13, 0x33, 0x3d, 0x4b, 0xe5,	// 12:36
+    0x0, 0x8, 0x12, 0x13, 0x1e, 0x3d, 0x4b, 0xe5,	// 12:37
+    0x0, 0x8, 0x12, 0x13, 0x36, 0x3d, 0x4b, 0xe5,	// 12:38
+    0x0, 0x8, 0x12, 0x13, 0x24, 0x32, 0x4b, 0xe5,	// 12:39
+    0x0, 0x8, 0x12, 0x13, 0x3d, 0x4b, 0xe5,	// 12:40
+    0x0, 0x8, 0x19, 0x1a, 0x3d, 0x4b, 0xe5,	// 12:41
+    0x0, 0x8, 0x1b, 0x1c, 0x3d, 0x4b, 0xe5,	// 12:42
+    0x0, 0x8, 0x2a, 0x2b, 0x3d, 0x4b, 0xe5,	// 12:43
+    0x0, 0x8, 0x9, 0xa, 0x3d, 0x4b, 0xe5,	// 12:44
+    0x0, 0x8, 0x2c, 0x2d, 0x4b, 0xe5,	// 12:45
+    0x0, 0x8, 0x14, 0x15, 0x3d, 0x4b, 0xe5,	// 12:46
+    0x0, 0x8, 0x37, 0x38, 0x3d, 0x4b, 0xe5,	// 12:47
+    0x0, 0x8, 0x20, 0x21, 0x3d, 0x4b, 0xe5,	// 12:48
+    0x0, 0x8, 0x10, 0x11, 0x3d, 0x4b, 0xe5,	// 12:49
+    0x0, 0x8, 0x39, 0x3d, 0x4b, 0xe5,	// 12:50
+    0x0, 0x8, 0x3c, 0x3d, 0x4b, 0xe5,	// 12:51
+    0x0, 0x8, 0x3b, 0x3d, 0x4b, 0xe5,	// 12:52
+    0x0, 0x8, 0x35, 0x3d, 0x4b, 0xe5,	// 12:53
+    0x0, 0x8, 0x29, 0x3d, 0x4b, 0xe5,	// 12:54
+    0x0, 0x8, 0x34, 0x3d, 0x4b, 0xe5,	// 12:55
+    0x0, 0x8, 0x33, 0x3d, 0x4b, 0xe5,	// 12:56
+    0x0, 0x8, 0x1e, 0x3d, 0x4b, 0xe5,	// 12:57
+    0x0, 0x8, 0x36, 0x3d, 0x4b, 0xe5,	// 12:58
+    0x0, 0x8, 0x24, 0x32, 0x4b, 0xe5,	// 12:59
+    0x0, 0x3, 0x2e, 0x4b, 0xe5,	// 13:00
+    0x0, 0x18, 0x3a, 0x64, 0xe5,	// 13:01
+    0x0, 0x16, 0x32, 0x64, 0xe5,	// 13:02
+    0x0, 0x48, 0x4a, 0x64, 0xe5,	// 13:03
+    0x0, 0x46, 0x4a, 0x64, 0xe5,	// 13:04
+    0x0, 0x4c, 0x50, 0x64, 0xe5,	// 13:05
+    0x0, 0x47, 0x50, 0x64, 0xe5,	// 13:06
+    0x0, 0x4d, 0x50, 0x64, 0xe5,	// 13:07
+    0x0, 0x45, 0x50, 0x64, 0xe5,	// 13:08
+    0x0, 0x44, 0x50, 0x64, 0xe5,	// 13:09
+    0x0, 0x43, 0x50, 0x64, 0xe5,	// 13:10
+    0x0, 0x41, 0x42, 0x50, 0x64, 0xe5,	// 13:11
+    0x0, 0x3e, 0x40, 0x50, 0x64, 0xe5,	// 13:12
+    0x0, 0x30, 0x31, 0x3d, 0x64, 0xe5,	// 13:13
+    0x0, 0xd, 0xe, 0x3d, 0x64, 0xe5,	// 13:14
+    0x0, 0x25, 0x26, 0x64, 0xe5,	// 13:15
+    0x0, 0x1, 0x2, 0x3d, 0x64, 0xe5,	// 13:16
+    0x0, 0x27, 0x28, 0x3d, 0x64, 0xe5,	// 13:17
+    0x0, 0x6, 0x7, 0x3d, 0x64, 0xe5,	// 13:18
+    0x0, 0xb, 0xc, 0x3d, 0x64, 0xe5,	// 13:19
+    0x0, 0x4, 0x5, 0x3d, 0x64, 0xe5,	// 13:20
+    0x0, 0x4, 0x5, 0x18, 0x3a, 0x64, 0xe5,	// 13:21
+    0x0, 0x4, 0x5, 0x16, 0x32, 0x64, 0xe5,	// 13:22
+    0x0, 0x4, 0x5, 0x48, 0x4a, 0x64, 0xe5,	// 13:23
+    0x0, 0x4, 0x5, 0x46, 0x4a, 0x64, 0xe5,	// 13:24
+    0x0, 0x4, 0x5, 0x4c, 0x50, 0x64, 0xe5,	// 13:25
+    0x0, 0x4, 0x5, 0x47, 0x50, 0x64, 0xe5,	// 13:26
+    0x0, 0x4, 0x5, 0x4d, 0x50, 0x64, 0xe5,	// 13:27
+    0x0, 0x4, 0x5, 0x45, 0x50, 0x64, 0xe5,	// 13:28
+    0x0, 0x4, 0x5, 0x44, 0x50, 0x64, 0xe5,	// 13:29
+    0x0, 0x22, 0x23, 0x64, 0xe5,	// 13:30
+    0x0, 0x8, 0x12, 0x13, 0x3c, 0x3d, 0x49, 0x4e, 0xe5,	// 13:31
+    0x0, 0x8, 0x12, 0x13, 0x3b, 0x3d, 0x49, 0x4e, 0xe5,	// 13:32
+    0x0, 0x8, 0x12, 0x13, 0x35, 0x3d, 0x49, 0x4e, 0xe5,	// 13:33
+    0x0, 0x8, 0x12, 0x13, 0x29, 0x3d, 0x49, 0x4e, 0xe5,	// 13:34
+    0x0, 0x8, 0x12, 0x13, 0x34, 0x3d, 0x49, 0x4e, 0xe5,	// 13:35
+    0x0, 0x8, 0x12, 0x13, 0x33, 0x3d, 0x49, 0x4e, 0xe5,	// 13:36
+    0x0, 0x8, 0x12, 0x13, 0x1e, 0x3d, 0x49, 0x4e, 0xe5,	// 13:37
+    0x0, 0x8, 0x12, 0x13, 0x36, 0x3d, 0x49, 0x4e, 0xe5,	// 13:38
+    0x0, 0x8, 0x12, 0x13, 0x24, 0x32, 0x49, 0x4e, 0xe5,	// 13:39
+    0x0, 0x8, 0x12, 0x13, 0x3d, 0x49, 0x4e, 0xe5,	// 13:40
+    0x0, 0x8, 0x19, 0x1a, 0x3d, 0x49, 0x4e, 0xe5,	// 13:41
+    0x0, 0x8, 0x1b, 0x1c, 0x3d, 0x49, 0x4e, 0xe5,	// 13:42
+    0x0, 0x8, 0x2a, 0x2b, 0x3d, 0x49, 0x4e, 0xe5,	// 13:43
+    0x0, 0x8, 0x9, 0xa, 0x3d, 0x49, 0x4e, 0xe5,	// 13:44
+    0x0, 0x8, 0x2c, 0x2d, 0x49, 0x4e, 0xe5,	// 13:45
+    0x0, 0x8, 0x14, 0x15, 0x3d, 0x49, 0x4e, 0xe5,	// 13:46
+    0x0, 0x8, 0x37, 0x38, 0x3d, 0x49, 0x4e, 0xe5,	// 13:47
+    0x0, 0x8, 0x20, 0x21, 0x3d, 0x49, 0x4e, 0xe5,	// 13:48
+    0x0, 0x8, 0x10, 0x11, 0x3d, 0x49, 0x4e, 0xe5,	// 13:49
+    0x0, 0x8, 0x39, 0x3d, 0x49, 0x4e, 0xe5,	// 13:50
+    0x0, 0x8, 0x3c, 0x3d, 0x49, 0x4e, 0xe5,	// 13:51
+    0x0, 0x8, 0x3b, 0x3d, 0x49, 0x4e, 0xe5,	// 13:52
+    0x0, 0x8, 0x35, 0x3d, 0x49, 0x4e, 0xe5,	// 13:53
+    0x0, 0x8, 0x29, 0x3d, 0x49, 0x4e, 0xe5,	// 13:54
+    0x0, 0x8, 0x34, 0x3d, 0x49, 0x4e, 0xe5,	// 13:55
+    0x0, 0x8, 0x33, 0x3d, 0x49, 0x4e, 0xe5,	// 13:56
+    0x0, 0x8, 0x1e, 0x3d, 0x49, 0x4e, 0xe5,	// 13:57
+    0x0, 0x8, 0x36, 0x3d, 0x49, 0x4e, 0xe5,	// 13:58
+    0x0, 0x8, 0x24, 0x32, 0x49, 0x4e, 0xe5,	// 13:59
+    0x0, 0x3, 0x49, 0x4e, 0xe5,	// 14:00
+    0x0, 0x18, 0x3a, 0x59, 0x5a, 0xe5,	// 14:01
+    0x0, 0x16, 0x32, 0x59, 0x5a, 0xe5,	// 14:02
+    0x0, 0x48, 0x4a, 0x59, 0x5a, 0xe5,	// 14:03
+    0x0, 0x46, 0x4a, 0x59, 0x5a, 0xe5,	// 14:04
+    0x0, 0x4c, 0x50, 0x59, 0x5a, 0xe5,	// 14:05
+    0x0, 0x47, 0x50, 0x59, 0x5a, 0xe5,	// 14:06
+    0x0, 0x4d, 0x50, 0x59, 0x5a, 0xe5,	// 14:07
+    0x0, 0x45, 0x50, 0x59, 0x5a, 0xe5,	// 14:08
+    0x0, 0x44, 0x50, 0x59, 0x5a, 0xe5,	// 14:09
+    0x0, 0x43, 0x50, 0x59, 0x5a, 0xe5,	// 14:10
+    0x0, 0x41, 0x42, 0x50, 0x59, 0x5a, 0xe5,	// 14:11
+    0x0, 0x3e, 0x40, 0x50, 0x59, 0x5a, 0xe5,	// 14:12
+    0x0, 0x30, 0x31, 0x3d, 0x59, 0x5a, 0xe5,	// 14:13
+    0x0, 0xd, 0xe, 0x3d, 0x59, 0x5a, 0xe5,	// 14:14
+    0x0, 0x25, 0x26, 0x59, 0x5a, 0xe5,	// 14:15
+    0x0, 0x1, 0x2, 0x3d, 0x59, 0x5a, 0xe5,	// 14:16
+    0x0, 0x27, 0x28, 0x3d, 0x59, 0x5a, 0xe5,	// 14:17
+    0x0, 0x6, 0x7, 0x3d, 0x59, 0x5a, 0xe5,	// 14:18
+    0x0, 0xb, 0xc, 0x3d, 0x59, 0x5a, 0xe5,	// 14:19
+    0x0, 0x4, 0x5, 0x3d, 0x59, 0x5a, 0xe5,	// 14:20
+    0x0, 0x4, 0x5, 0x18, 0x3a, 0x59, 0x5a, 0xe5,	// 14:21
+    0x0, 0x4, 0x5, 0x16, 0x32, 0x59, 0x5a, 0xe5,	// 14:22
+    0x0, 0x4, 0x5, 0x48, 0x4a, 0x59, 0x5a, 0xe5,	// 14:23
+    0x0, 0x4, 0x5, 0x46, 0x4a, 0x59, 0x5a, 0xe5,	// 14:24
+    0x0, 0x4, 0x5, 0x4c, 0x50, 0x59, 0x5a, 0xe5,	// 14:25
+    0x0, 0x4, 0x5, 0x47, 0x50, 0x59, 0x5a, 0xe5,	// 14:26
+    0x0, 0x4, 0x5, 0x4d, 0x50, 0x59, 0x5a, 0xe5,	// 14:27
+    0x0, 0x4, 0x5, 0x45, 0x50, 0x59, 0x5a, 0xe5,	// 14:28
+    0x0, 0x4, 0x5, 0x44, 0x50, 0x59, 0x5a, 0xe5,	// 14:29
+    0x0, 0x22, 0x23, 0x59, 0x5a, 0xe5,	// 14:30
+    0x0, 0x8, 0x12, 0x13, 0x3c, 0x3d, 0x48, 0x4e, 0xe5,	// 14:31
+    0x0, 0x8, 0x12, 0x13, 0x3b, 0x3d, 0x48, 0x4e, 0xe5,	// 14:32
+    0x0, 0x8, 0x12, 0x13, 0x35, 0x3d, 0x48, 0x4e, 0xe5,	// 14:33
+    0x0, 0x8, 0x12, 0x13, 0x29, 0x3d, 0x48, 0x4e, 0xe5,	// 14:34
+    0x0, 0x8, 0x12, 0x13, 0x34, 0x3d, 0x48, 0x4e, 0xe5,	// 14:35
+    0x0, 0x8, 0x12, 0x13, 0x33, 0x3d, 0x48, 0x4e, 0xe5,	// 14:36
+    0x0, 0x8, 0x12, 0x13, 0x1e, 0x3d, 0x48, 0x4e, 0xe5,	// 14:37
+    0x0, 0x8, 0x12, 0x13, 0x36, 0x3d, 0x48, 0x4e, 0xe5,	// 14:38
+    0x0, 0x8, 0x12, 0x13, 0x24, 0x32, 0x48, 0x4e, 0xe5,	// 14:39
+    0x0, 0x8, 0x12, 0x13, 0x3d, 0x48, 0x4e, 0xe5,	// 14:40
+    0x0, 0x8, 0x19, 0x1a, 0x3d, 0x48, 0x4e, 0xe5,	// 14:41
+    0x0, 0x8, 0x1b, 0x1c, 0x3d, 0x48, 0x4e, 0xe5,	// 14:42
+    0x0, 0x8, 0x2a, 0x2b, 0x3d, 0x48, 0x4e, 0xe5,	// 14:43
+    0x0, 0x8, 0x9, 0xa, 0x3d, 0x48, 0x4e, 0xe5,	// 14:44
+    0x0, 0x8, 0x2c, 0x2d, 0x48, 0x4e, 0xe5,	// 14:45
+    0x0, 0x8, 0x14, 0x15, 0x3d, 0x48, 0x4e, 0xe5,	// 14:46
+    0x0, 0x8, 0x37, 0x38, 0x3d, 0x48, 0x4e, 0xe5,	// 14:47
+    0x0, 0x8, 0x20, 0x21, 0x3d, 0x48, 0x4e, 0xe5,	// 14:48
+    0x0, 0x8, 0x10, 0x11, 0x3d, 0x48, 0x4e, 0xe5,	// 14:49
+    0x0, 0x8, 0x39, 0x3d, 0x48, 0x4e, 0xe5,	// 14:50
+    0x0, 0x8, 0x3c, 0x3d, 0x48, 0x4e, 0xe5,	// 14:51
+    0x0, 0x8, 0x3b, 0x3d, 0x48, 0x4e, 0xe5,	// 14:52
+    0x0, 0x8, 0x35, 0x3d, 0x48, 0x4e, 0xe5,	// 14:53
+    0x0, 0x8, 0x29, 0x3d, 0x48, 0x4e, 0xe5,	// 14:54
+    0x0, 0x8, 0x34, 0x3d, 0x48, 0x4e, 0xe5,	// 14:55
+    0x0, 0x8, 0x33, 0x3d, 0x48, 0x4e, 0xe5,	// 14:56
+    0x0, 0x8, 0x1e, 0x3d, 0x48, 0x4e, 0xe5,	// 14:57
+    0x0, 0x8, 0x36, 0x3d, 0x48, 0x4e, 0xe5,	// 14:58
+    0x0, 0x8, 0x24, 0x32, 0x48, 0x4e, 0xe5,	// 14:59
+    0x0, 0x3, 0x48, 0x4e, 0xe5,	// 15:00
+    0x0, 0x18, 0x3a, 0x56, 0x57, 0xe5,	// 15:01
+    0x0, 0x16, 0x32, 0x56, 0x57, 0xe5,	// 15:02
+    0x0, 0x48, 0x4a, 0x56, 0x57, 0xe5,	// 15:03
+    0x0, 0x46, 0x4a, 0x56, 0x57, 0xe5,	// 15:04
+    0x0, 0x4c, 0x50, 0x56, 0x57, 0xe5,	// 15:05
+    0x0, 0x47, 0x50, 0x56, 0x57, 0xe5,	// 15:06
+    0x0, 0x4d, 0x50, 0x56, 0x57, 0xe5,	// 15:07
+    0x0, 0x45, 0x50, 0x56, 0x57, 0xe5,	// 15:08
+    0x0, 0x44, 0x50, 0x56, 0x57, 0xe5,	// 15:09
+    0x0, 0x43, 0x50, 0x56, 0x57, 0xe5,	// 15:10
+    0x0, 0x41, 0x42, 0x50, 0x56, 0x57, 0xe5,	// 15:11
+    0x0, 0x3e, 0x40, 0x50, 0x56, 0x57, 0xe5,	// 15:12
+    0x0, 0x30, 0x31, 0x3d, 0x56, 0x57, 0xe5,	// 15:13
+    0x0, 0xd, 0xe, 0x3d, 0x56, 0x57, 0xe5,	// 15:14
+    0x0, 0x25, 0x26, 0x56, 0x57, 0xe5,	// 15:15
+    0x0, 0x1, 0x2, 0x3d, 0x56, 0x57, 0xe5,	// 15:16
+    0x0, 0x27, 0x28, 0x3d, 0x56, 0x57, 0xe5,	// 15:17
+    0x0, 0x6, 0x7, 0x3d, 0x56, 0x57, 0xe5,	// 15:18
+    0x0, 0xb, 0xc, 0x3d, 0x56, 0x57, 0xe5,	// 15:19
+    0x0, 0x4, 0x5, 0x3d, 0x56, 0x57, 0xe5,	// 15:20
+    0x0, 0x4, 0x5, 0x18, 0x3a, 0x56, 0x57, 0xe5,	// 15:21
+    0x0, 0x4, 0x5, 0x16, 0x32, 0x56, 0x57, 0xe5,	// 15:22
+    0x0, 0x4, 0x5, 0x48, 0x4a, 0x56, 0x57, 0xe5,	// 15:23
+    0x0, 0x4, 0x5, 0x46, 0x4a, 0x56, 0x57, 0xe5,	// 15:24
+    0x0, 0x4, 0x5, 0x4c, 0x50, 0x56, 0x57, 0xe5,	// 15:25
+    0x0, 0x4, 0x5, 0x47, 0x50, 0x56, 0x57, 0xe5,	// 15:26
+    0x0, 0x4, 0x5, 0x4d, 0x50, 0x56, 0x57, 0xe5,	// 15:27
+    0x0, 0x4, 0x5, 0x45, 0x50, 0x56, 0x57, 0xe5,	// 15:28
+    0x0, 0x4, 0x5, 0x44, 0x50, 0x56, 0x57, 0xe5,	// 15:29
+    0x0, 0x22, 0x23, 0x56, 0x57, 0xe5,	// 15:30
+    0x0, 0x8, 0x12, 0x13, 0x3c, 0x3d, 0x46, 0x4e, 0xe5,	// 15:31
+    0x0, 0x8, 0x12, 0x13, 0x3b, 0x3d, 0x46, 0x4e, 0xe5,	// 15:32
+    0x0, 0x8, 0x12, 0x13, 0x35, 0x3d, 0x46, 0x4e, 0xe5,	// 15:33
+    0x0, 0x8, 0x12, 0x13, 0x29, 0x3d, 0x46, 0x4e, 0xe5,	// 15:34
+    0x0, 0x8, 0x12, 0x13, 0x34, 0x3d, 0x46, 0x4e, 0xe5,	// 15:35
+    0x0, 0x8, 0x12, 0x13, 0x33, 0x3d, 0x46, 0x4e, 0xe5,	// 15:36
+    0x0, 0x8, 0x12, 0x13, 0x1e, 0x3d, 0x46, 0x4e, 0xe5,	// 15:37
+    0x0, 0x8, 0x12, 0x13, 0x36, 0x3d, 0x46, 0x4e, 0xe5,	// 15:38
+    0x0, 0x8, 0x12, 0x13, 0x24, 0x32, 0x46, 0x4e, 0xe5,	// 15:39
+    0x0, 0x8, 0x12, 0x13, 0x3d, 0x46, 0x4e, 0xe5,	// 15:40
+    0x0, 0x8, 0x19, 0x1a, 0x3d, 0x46, 0x4e, 0xe5,	// 15:41
+    0x0, 0x8, 0x1b, 0x1c, 0x3d, 0x46, 0x4e, 0xe5,	// 15:42
+    0x0, 0x8, 0x2a, 0x2b, 0x3d, 0x46, 0x4e, 0xe5,	// 15:43
+    0x0, 0x8, 0x9, 0xa, 0x3d, 0x46, 0x4e, 0xe5,	// 15:44
+    0x0, 0x8, 0x2c, 0x2d, 0x46, 0x4e, 0xe5,	// 15:45
+    0x0, 0x8, 0x14, 0x15, 0x3d, 0x46, 0x4e, 0xe5,	// 15:46
+    0x0, 0x8, 0x37, 0x38, 0x3d, 0x46, 0x4e, 0xe5,	// 15:47
+    0x0, 0x8, 0x20, 0x21, 0x3d, 0x46, 0x4e, 0xe5,	// 15:48
+    0x0, 0x8, 0x10, 0x11, 0x3d, 0x46, 0x4e, 0xe5,	// 15:49
+    0x0, 0x8, 0x39, 0x3d, 0x46, 0x4e, 0xe5,	// 15:50
+    0x0, 0x8, 0x3c, 0x3d, 0x46, 0x4e, 0xe5,	// 15:51
+    0x0, 0x8, 0x3b, 0x3d, 0x46, 0x4e, 0xe5,	// 15:52
+    0x0, 0x8, 0x35, 0x3d, 0x46, 0x4e, 0xe5,	// 15:53
+    0x0, 0x8, 0x29, 0x3d, 0x46, 0x4e, 0xe5,	// 15:54
+    0x0, 0x8, 0x34, 0x3d, 0x46, 0x4e, 0xe5,	// 15:55
+    0x0, 0x8, 0x33, 0x3d, 0x46, 0x4e, 0xe5,	// 15:56
+    0x0, 0x8, 0x1e, 0x3d, 0x46, 0x4e, 0xe5,	// 15:57
+    0x0, 0x8, 0x36, 0x3d, 0x46, 0x4e, 0xe5,	// 15:58
+    0x0, 0x8, 0x24, 0x32, 0x46, 0x4e, 0xe5,	// 15:59
+    0x0, 0x3, 0x46, 0x4e, 0xe5,	// 16:00
+    0x0, 0x18, 0x3a, 0x63, 0xe5,	// 16:01
+    0x0, 0x16, 0x32, 0x63, 0xe5,	// 16:02
+    0x0, 0x48, 0x4a, 0x63, 0xe5,	// 16:03
+    0x0, 0x46, 0x4a, 0x63, 0xe5,	// 16:04
+    0x0, 0x4c, 0x50, 0x63, 0xe5,	// 16:05
+    0x0, 0x47, 0x50, 0x63, 0xe5,	// 16:06
+    0x0, 0x4d, 0x50, 0x63, 0xe5,	// 16:07
+    0x0, 0x45, 0x50, 0x63, 0xe5,	// 16:08
+    0x0, 0x44, 0x50, 0x63, 0xe5,	// 16:09
+    0x0, 0x43, 0x50, 0x63, 0xe5,	// 16:10
+    0x0, 0x41, 0x42, 0x50, 0x63, 0xe5,	// 16:11
+    0x0, 0x3e, 0x40, 0x50, 0x63, 0xe5,	// 16:12
+    0x0, 0x30, 0x31, 0x3d, 0x63, 0xe5,	// 16:13
+    0x0, 0xd, 0xe, 0x3d, 0x63, 0xe5,	// 16:14
+    0x0, 0x25, 0x26, 0x63, 0xe5,	// 16:15
+    0x0, 0x1, 0x2, 0x3d, 0x63, 0xe5,	// 16:16
+    0x0, 0x27, 0x28, 0x3d, 0x63, 0xe5,	// 16:17
+    0x0, 0x6, 0x7, 0x3d, 0x63, 0xe5,	// 16:18
+    0x0, 0xb, 0xc, 0x3d, 0x63, 0xe5,	// 16:19
+    0x0, 0x4, 0x5, 0x3d, 0x63, 0xe5,	// 16:20
+    0x0, 0x4, 0x5, 0x18, 0x3a, 0x63, 0xe5,	// 16:21
+    0x0, 0x4, 0x5, 0x16, 0x32, 0x63, 0xe5,	// 16:22
+    0x0, 0x4, 0x5, 0x48, 0x4a, 0x63, 0xe5,	// 16:23
+    0x0, 0x4, 0x5, 0x46, 0x4a, 0x63, 0xe5,	// 16:24
+    0x0, 0x4, 0x5, 0x4c, 0x50, 0x63, 0xe5,	// 16:25
+    0x0, 0x4, 0x5, 0x47, 0x50, 0x63, 0xe5,	// 16:26
+    0x0, 0x4, 0x5, 0x4d, 0x50, 0x63, 0xe5,	// 16:27
+    0x0, 0x4, 0x5, 0x45, 0x50, 0x63, 0xe5,	// 16:28
+    0x0, 0x4, 0x5, 0x44, 0x50, 0x63, 0xe5,	// 16:29
+    0x0, 0x22, 0x23, 0x63, 0xe5,	// 16:30
+    0x0, 0x8, 0x12, 0x13, 0x3c, 0x3d, 0x4c, 0xe5,	// 16:31
+    0x0, 0x8, 0x12, 0x13, 0x3b, 0x3d, 0x4c, 0xe5,	// 16:32
+    0x0, 0x8, 0x12, 0x13, 0x35, 0x3d, 0x4c, 0xe5,	// 16:33
+    0x0, 0x8, 0x12, 0x13, 0x29, 0x3d, 0x4c, 0xe5,	// 16:34
+    0x0, 0x8, 0x12, 0x13, 0x34, 0x3d, 0x4c, 0xe5,	// 16:35
+    0x0, 0x8, 0x12, 0x13, 0x33, 0x3d, 0x4c, 0xe5,	// 16:36
+    0x0, 0x8, 0x12, 0x13, 0x1e, 0x3d, 0x4c, 0xe5,	// 16:37
+    0x0, 0x8, 0x12, 0x13, 0x36, 0x3d, 0x4c, 0xe5,	// 16:38
+    0x0, 0x8, 0x12, 0x13, 0x24, 0x32, 0x4c, 0xe5,	// 16:39
+    0x0, 0x8, 0x12, 0x13, 0x3d, 0x4c, 0xe5,	// 16:40
+    0x0, 0x8, 0x19, 0x1a, 0x3d, 0x4c, 0xe5,	// 16:41
+    0x0, 0x8, 0x1b, 0x1c, 0x3d, 0x4c, 0xe5,	// 16:42
+    0x0, 0x8, 0x2a, 0x2b, 0x3d, 0x4c, 0xe5,	// 16:43
+    0x0, 0x8, 0x9, 0xa, 0x3d, 0x4c, 0xe5,	// 16:44
+    0x0, 0x8, 0x2c, 0x2d, 0x4c, 0xe5,	// 16:45
+    0x0, 0x8, 0x14, 0x15, 0x3d, 0x4c, 0xe5,	// 16:46
+    0x0, 0x8, 0x37, 0x38, 0x3d, 0x4c, 0xe5,	// 16:47
+    0x0, 0x8, 0x20, 0x21, 0x3d, 0x4c, 0xe5,	// 16:48
+    0x0, 0x8, 0x10, 0x11, 0x3d, 0x4c, 0xe5,	// 16:49
+    0x0, 0x8, 0x39, 0x3d, 0x4c, 0xe5,	// 16:50
+    0x0, 0x8, 0x3c, 0x3d, 0x4c, 0xe5,	// 16:51
+    0x0, 0x8, 0x3b, 0x3d, 0x4c, 0xe5,	// 16:52
+    0x0, 0x8, 0x35, 0x3d, 0x4c, 0xe5,	// 16:53
+    0x0, 0x8, 0x29, 0x3d, 0x4c, 0xe5,	// 16:54
+    0x0, 0x8, 0x34, 0x3d, 0x4c, 0xe5,	// 16:55
+    0x0, 0x8, 0x33, 0x3d, 0x4c, 0xe5,	// 16:56
+    0x0, 0x8, 0x1e, 0x3d, 0x4c, 0xe5,	// 16:57
+    0x0, 0x8, 0x36, 0x3d, 0x4c, 0xe5,	// 16:58
+    0x0, 0x8, 0x24, 0x32, 0x4c, 0xe5,	// 16:59
+    0x0, 0x3, 0x4c, 0x51, 0xe5,	// 17:00
+    0x0, 0x18, 0x3a, 0x58, 0xea,	// 17:01
+    0x0, 0x16, 0x32, 0x58, 0xea,	// 17:02
+    0x0, 0x48, 0x4a, 0x58, 0xea,	// 17:03
+    0x0, 0x46, 0x4a, 0x58, 0xea,	// 17:04
+    0x0, 0x4c, 0x50, 0x58, 0xea,	// 17:05
+    0x0, 0x47, 0x50, 0x58, 0xea,	// 17:06
+    0x0, 0x4d, 0x50, 0x58, 0xea,	// 17:07
+    0x0, 0x45, 0x50, 0x58, 0xea,	// 17:08
+    0x0, 0x44, 0x50, 0x58, 0xea,	// 17:09
+    0x0, 0x43, 0x50, 0x58, 0xea,	// 17:10
+    0x0, 0x41, 0x42, 0x50, 0x58, 0xea,	// 17:11
+    0x0, 0x3e, 0x40, 0x50, 0x58, 0xea,	// 17:12
+    0x0, 0x30, 0x31, 0x3d, 0x58, 0xea,	// 17:13
+    0x0, 0xd, 0xe, 0x3d, 0x58, 0xea,	// 17:14
+    0x0, 0x25, 0x26, 0x58, 0xea,	// 17:15
+    0x0, 0x1, 0x2, 0x3d, 0x58, 0xea,	// 17:16
+    0x0, 0x27, 0x28, 0x3d, 0x58, 0xea,	// 17:17
+    0x0, 0x6, 0x7, 0x3d, 0x58, 0xea,	// 17:18
+    0x0, 0xb, 0xc, 0x3d, 0x58, 0xea,	// 17:19
+    0x0, 0x4, 0x5, 0x3d, 0x58, 0xea,	// 17:20
+    0x0, 0x4, 0x5, 0x18, 0x3a, 0x58, 0xea,	// 17:21
+    0x0, 0x4, 0x5, 0x16, 0x32, 0x58, 0xea,	// 17:22
+    0x0, 0x4, 0x5, 0x48, 0x4a, 0x58, 0xea,	// 17:23
+    0x0, 0x4, 0x5, 0x46, 0x4a, 0x58, 0xea,	// 17:24
+    0x0, 0x4, 0x5, 0x4c, 0x50, 0x58, 0xea,	// 17:25
+    0x0, 0x4, 0x5, 0x47, 0x50, 0x58, 0xea,	// 17:26
+    0x0, 0x4, 0x5, 0x4d, 0x50, 0x58, 0xea,	// 17:27
+    0x0, 0x4, 0x5, 0x45, 0x50, 0x58, 0xea,	// 17:28
+    0x0, 0x4, 0x5, 0x44, 0x50, 0x58, 0xea,	// 17:29
+    0x0, 0x22, 0x23, 0x58, 0xea,	// 17:30
+    0x0, 0x8, 0x12, 0x13, 0x3c, 0x3d, 0x47, 0xea,	// 17:31
+    0x0, 0x8, 0x12, 0x13, 0x3b, 0x3d, 0x47, 0xea,	// 17:32
+    0x0, 0x8, 0x12, 0x13, 0x35, 0x3d, 0x47, 0xea,	// 17:33
+    0x0, 0x8, 0x12, 0x13, 0x29, 0x3d, 0x47, 0xea,	// 17:34
+    0x0, 0x8, 0x12, 0x13, 0x34, 0x3d, 0x47, 0xea,	// 17:35
+    0x0, 0x8, 0x12, 0x13, 0x33, 0x3d, 0x47, 0xea,	// 17:36
+    0x0, 0x8, 0x12, 0x13, 0x1e, 0x3d, 0x47, 0xea,	// 17:37
+    0x0, 0x8, 0x12, 0x13, 0x36, 0x3d, 0x47, 0xea,	// 17:38
+    0x0, 0x8, 0x12, 0x13, 0x24, 0x32, 0x47, 0xea,	// 17:39
+    0x0, 0x8, 0x12, 0x13, 0x3d, 0x47, 0xea,	// 17:40
+    0x0, 0x8, 0x19, 0x1a, 0x3d, 0x47, 0xea,	// 17:41
+    0x0, 0x8, 0x1b, 0x1c, 0x3d, 0x47, 0xea,	// 17:42
+    0x0, 0x8, 0x2a, 0x2b, 0x3d, 0x47, 0xea,	// 17:43
+    0x0, 0x8, 0x9, 0xa, 0x3d, 0x47, 0xea,	// 17:44
+    0x0, 0x8, 0x2c, 0x2d, 0x47, 0xea,	// 17:45
+    0x0, 0x8, 0x14, 0x15, 0x3d, 0x47, 0xea,	// 17:46
+    0x0, 0x8, 0x37, 0x38, 0x3d, 0x47, 0xea,	// 17:47
+    0x0, 0x8, 0x20, 0x21, 0x3d, 0x47, 0xea,	// 17:48
+    0x0, 0x8, 0x10, 0x11, 0x3d, 0x47, 0xea,	// 17:49
+    0x0, 0x8, 0x39, 0x3d, 0x47, 0xea,	// 17:50
+    0x0, 0x8, 0x3c, 0x3d, 0x47, 0xea,	// 17:51
+    0x0, 0x8, 0x3b, 0x3d, 0x47, 0xea,	// 17:52
+    0x0, 0x8, 0x35, 0x3d, 0x47, 0xea,	// 17:53
+    0x0, 0x8, 0x29, 0x3d, 0x47, 0xea,	// 17:54
+    0x0, 0x8, 0x34, 0x3d, 0x47, 0xea,	// 17:55
+    0x0, 0x8, 0x33, 0x3d, 0x47, 0xea,	// 17:56
+    0x0, 0x8, 0x1e, 0x3d, 0x47, 0xea,	// 17:57
+    0x0, 0x8, 0x36, 0x3d, 0x47, 0xea,	// 17:58
+    0x0, 0x8, 0x24, 0x32, 0x47, 0xea,	// 17:59
+    0x0, 0x3, 0x47, 0x51, 0xea,	// 18:00
+    0x0, 0x18, 0x3a, 0x5b, 0x5c, 0xea,	// 18:01
+    0x0, 0x16, 0x32, 0x5b, 0x5c, 0xea,	// 18:02
+    0x0, 0x48, 0x4a, 0x5b, 0x5c, 0xea,	// 18:03
+    0x0, 0x46, 0x4a, 0x5b, 0x5c, 0xea,	// 18:04
+    0x0, 0x4c, 0x50, 0x5b, 0x5c, 0xea,	// 18:05
+    0x0, 0x47, 0x50, 0x5b, 0x5c, 0xea,	// 18:06
+    0x0, 0x4d, 0x50, 0x5b, 0x5c, 0xea,	// 18:07
+    0x0, 0x45, 0x50, 0x5b, 0x5c, 0xea,	// 18:08
+    0x0, 0x44, 0x50, 0x5b, 0x5c, 0xea,	// 18:09
+    0x0, 0x43, 0x50, 0x5b, 0x5c, 0xea,	// 18:10
+    0x0, 0x41, 0x42, 0x50, 0x5b, 0x5c, 0xea,	// 18:11
+    0x0, 0x3e, 0x40, 0x50, 0x5b, 0x5c, 0xea,	// 18:12
+    0x0, 0x30, 0x31, 0x3d, 0x5b, 0x5c, 0xea,	// 18:13
+    0x0, 0xd, 0xe, 0x3d, 0x5b, 0x5c, 0xea,	// 18:14
+    0x0, 0x25, 0x26, 0x5b, 0x5c, 0xea,	// 18:15
+    0x0, 0x1, 0x2, 0x3d, 0x5b, 0x5c, 0xea,	// 18:16
+    0x0, 0x27, 0x28, 0x3d, 0x5b, 0x5c, 0xea,	// 18:17
+    0x0, 0x6, 0x7, 0x3d, 0x5b, 0x5c, 0xea,	// 18:18
+    0x0, 0xb, 0xc, 0x3d, 0x5b, 0x5c, 0xea,	// 18:19
+    0x0, 0x4, 0x5, 0x3d, 0x5b, 0x5c, 0xea,	// 18:20
+    0x0, 0x4, 0x5, 0x18, 0x3a, 0x5b, 0x5c, 0xea,	// 18:21
+    0x0, 0x4, 0x5, 0x16, 0x32, 0x5b, 0x5c, 0xea,	// 18:22
+    0x0, 0x4, 0x5, 0x48, 0x4a, 0x5b, 0x5c, 0xea,	// 18:23
+    0x0, 0x4, 0x5, 0x46, 0x4a, 0x5b, 0x5c, 0xea,	// 18:24
+    0x0, 0x4, 0x5, 0x4c, 0x50, 0x5b, 0x5c, 0xea,	// 18:25
+    0x0, 0x4, 0x5, 0x47, 0x50, 0x5b, 0x5c, 0xea,	// 18:26
+    0x0, 0x4, 0x5, 0x4d, 0x50, 0x5b, 0x5c, 0xea,	// 18:27
+    0x0, 0x4, 0x5, 0x45, 0x50, 0x5b, 0x5c, 0xea,	// 18:28
+    0x0, 0x4, 0x5, 0x44, 0x50, 0x5b, 0x5c, 0xea,	// 18:29
+    0x0, 0x22, 0x23, 0x5b, 0x5c, 0xea,	// 18:30
+    0x0, 0x8, 0x12, 0x13, 0x3c, 0x3d, 0x4d, 0xea,	// 18:31
+    0x0, 0x8, 0x12, 0x13, 0x3b, 0x3d, 0x4d, 0xea,	// 18:32
+    0x0, 0x8, 0x12, 0x13, 0x35, 0x3d, 0x4d, 0xea,	// 18:33
+    0x0, 0x8, 0x12, 0x13, 0x29, 0x3d, 0x4d, 0xea,	// 18:34
+    0x0, 0x8, 0x12, 0x13, 0x34, 0x3d, 0x4d, 0xea,	// 18:35
+    0x0, 0x8, 0x12, 0x13, 0x33, 0x3d, 0x4d, 0xea,	// 18:36
+    0x0, 0x8, 0x12, 0x13, 0x1e, 0x3d, 0x4d, 0xea,	// 18:37
+    0x0, 0x8, 0x12, 0x13, 0x36, 0x3d, 0x4d, 0xea,	// 18:38
+    0x0, 0x8, 0x12, 0x13, 0x24, 0x32, 0x4d, 0xea,	// 18:39
+    0x0, 0x8, 0x12, 0x13, 0x3d, 0x4d, 0xea,	// 18:40
+    0x0, 0x8, 0x19, 0x1a, 0x3d, 0x4d, 0xea,	// 18:41
+    0x0, 0x8, 0x1b, 0x1c, 0x3d, 0x4d, 0xea,	// 18:42
+    0x0, 0x8, 0x2a, 0x2b, 0x3d, 0x4d, 0xea,	// 18:43
+    0x0, 0x8, 0x9, 0xa, 0x3d, 0x4d, 0xea,	// 18:44
+    0x0, 0x8, 0x2c, 0x2d, 0x4d, 0xea,	// 18:45
+    0x0, 0x8, 0x14, 0x15, 0x3d, 0x4d, 0xea,	// 18:46
+    0x0, 0x8, 0x37, 0x38, 0x3d, 0x4d, 0xea,	// 18:47
+    0x0, 0x8, 0x20, 0x21, 0x3d, 0x4d, 0xea,	// 18:48
+    0x0, 0x8, 0x10, 0x11, 0x3d, 0x4d, 0xea,	// 18:49
+    0x0, 0x8, 0x39, 0x3d, 0x4d, 0xea,	// 18:50
+    0x0, 0x8, 0x3c, 0x3d, 0x4d, 0xea,	// 18:51
+    0x0, 0x8, 0x3b, 0x3d, 0x4d, 0xea,	// 18:52
+    0x0, 0x8, 0x35, 0x3d, 0x4d, 0xea,	// 18:53
+    0x0, 0x8, 0x29, 0x3d, 0x4d, 0xea,	// 18:54
+    0x0, 0x8, 0x34, 0x3d, 0x4d, 0xea,	// 18:55
+    0x0, 0x8, 0x33, 0x3d, 0x4d, 0xea,	// 18:56
+    0x0, 0x8, 0x1e, 0x3d, 0x4d, 0xea,	// 18:57
+    0x0, 0x8, 0x36, 0x3d, 0x4d, 0xea,	// 18:58
+    0x0, 0x8, 0x24, 0x32, 0x4d, 0xea,	// 18:59
+    0x0, 0x3, 0x4d, 0x51, 0xea,	// 19:00
+    0x0, 0x18, 0x3a, 0x5d, 0x5e, 0xea,	// 19:01
+    0x0, 0x16, 0x32, 0x5d, 0x5e, 0xea,	// 19:02
+    0x0, 0x48, 0x4a, 0x5d, 0x5e, 0xea,	// 19:03
+    0x0, 0x46, 0x4a, 0x5d, 0x5e, 0xea,	// 19:04
+    0x0, 0x4c, 0x50, 0x5d, 0x5e, 0xea,	// 19:05
+    0x0, 0x47, 0x50, 0x5d, 0x5e, 0xea,	// 19:06
+    0x0, 0x4d, 0x50, 0x5d, 0x5e, 0xea,	// 19:07
+    0x0, 0x45, 0x50, 0x5d, 0x5e, 0xea,	// 19:08
+    0x0, 0x44, 0x50, 0x5d, 0x5e, 0xea,	// 19:09
+    0x0, 0x43, 0x50, 0x5d, 0x5e, 0xea,	// 19:10
+    0x0, 0x41, 0x42, 0x50, 0x5d, 0x5e, 0xea,	// 19:11
+    0x0, 0x3e, 0x40, 0x50, 0x5d, 0x5e, 0xea,	// 19:12
+    0x0, 0x30, 0x31, 0x3d, 0x5d, 0x5e, 0xea,	// 19:13
+    0x0, 0xd, 0xe, 0x3d, 0x5d, 0x5e, 0xea,	// 19:14
+    0x0, 0x25, 0x26, 0x5d, 0x5e, 0xea,	// 19:15
+    0x0, 0x1, 0x2, 0x3d, 0x5d, 0x5e, 0xea,	// 19:16
+    0x0, 0x27, 0x28, 0x3d, 0x5d, 0x5e, 0xea,	// 19:17
+    0x0, 0x6, 0x7, 0x3d, 0x5d, 0x5e, 0xea,	// 19:18
+    0x0, 0xb, 0xc, 0x3d, 0x5d, 0x5e, 0xea,	// 19:19
+    0x0, 0x4, 0x5, 0x3d, 0x5d, 0x5e, 0xea,	// 19:20
+    0x0, 0x4, 0x5, 0x18, 0x3a, 0x5d, 0x5e, 0xea,	// 19:21
+    0x0, 0x4, 0x5, 0x16, 0x32, 0x5d, 0x5e, 0xea,	// 19:22
+    0x0, 0x4, 0x5, 0x48, 0x4a, 0x5d, 0x5e, 0xea,	// 19:23
+    0x0, 0x4, 0x5, 0x46, 0x4a, 0x5d, 0x5e, 0xea,	// 19:24
+    0x0, 0x4, 0x5, 0x4c, 0x50, 0x5d, 0x5e, 0xea,	// 19:25
+    0x0, 0x4, 0x5, 0x47, 0x50, 0x5d, 0x5e, 0xea,	// 19:26
+    0x0, 0x4, 0x5, 0x4d, 0x50, 0x5d, 0x5e, 0xea,	// 19:27
+    0x0, 0x4, 0x5, 0x45, 0x50, 0x5d, 0x5e, 0xea,	// 19:28
+    0x0, 0x4, 0x5, 0x44, 0x50, 0x5d, 0x5e, 0xea,	// 19:29
+    0x0, 0x22, 0x23, 0x5d, 0x5e, 0xea,	// 19:30
+    0x0, 0x8, 0x12, 0x13, 0x3c, 0x3d, 0x45, 0xea,	// 19:31
+    0x0, 0x8, 0x12, 0x13, 0x3b, 0x3d, 0x45, 0xea,	// 19:32
+    0x0, 0x8, 0x12, 0x13, 0x35, 0x3d, 0x45, 0xea,	// 19:33
+    0x0, 0x8, 0x12, 0x13, 0x29, 0x3d, 0x45, 0xea,	// 19:34
+    0x0, 0x8, 0x12, 0x13, 0x34, 0x3d, 0x45, 0xea,	// 19:35
+    0x0, 0x8, 0x12, 0x13, 0x33, 0x3d, 0x45, 0xea,	// 19:36
+    0x0, 0x8, 0x12, 0x13, 0x1e, 0x3d, 0x45, 0xea,	// 19:37
+    0x0, 0x8, 0x12, 0x13, 0x36, 0x3d, 0x45, 0xea,	// 19:38
+    0x0, 0x8, 0x12, 0x13, 0x24, 0x32, 0x45, 0xea,	// 19:39
+    0x0, 0x8, 0x12, 0x13, 0x3d, 0x45, 0xea,	// 19:40
+    0x0, 0x8, 0x19, 0x1a, 0x3d, 0x45, 0xea,	// 19:41
+    0x0, 0x8, 0x1b, 0x1c, 0x3d, 0x45, 0xea,	// 19:42
+    0x0, 0x8, 0x2a, 0x2b, 0x3d, 0x45, 0xea,	// 19:43
+    0x0, 0x8, 0x9, 0xa, 0x3d, 0x45, 0xea,	// 19:44
+    0x0, 0x8, 0x2c, 0x2d, 0x45, 0xea,	// 19:45
+    0x0, 0x8, 0x14, 0x15, 0x3d, 0x45, 0xea,	// 19:46
+    0x0, 0x8, 0x37, 0x38, 0x3d, 0x45, 0xea,	// 19:47
+    0x0, 0x8, 0x20, 0x21, 0x3d, 0x45, 0xea,	// 19:48
+    0x0, 0x8, 0x10, 0x11, 0x3d, 0x45, 0xea,	// 19:49
+    0x0, 0x8, 0x39, 0x3d, 0x45, 0xea,	// 19:50
+    0x0, 0x8, 0x3c, 0x3d, 0x45, 0xea,	// 19:51
+    0x0, 0x8, 0x3b, 0x3d, 0x45, 0xea,	// 19:52
+    0x0, 0x8, 0x35, 0x3d, 0x45, 0xea,	// 19:53
+    0x0, 0x8, 0x29, 0x3d, 0x45, 0xea,	// 19:54
+    0x0, 0x8, 0x34, 0x3d, 0x45, 0xea,	// 19:55
+    0x0, 0x8, 0x33, 0x3d, 0x45, 0xea,	// 19:56
+    0x0, 0x8, 0x1e, 0x3d, 0x45, 0xea,	// 19:57
+    0x0, 0x8, 0x36, 0x3d, 0x45, 0xea,	// 19:58
+    0x0, 0x8, 0x24, 0x32, 0x45, 0xea,	// 19:59
+    0x0, 0x3, 0x45, 0x51, 0xea,	// 20:00
+    0x0, 0x18, 0x3a, 0x67, 0x68, 0xea,	// 20:01
+    0x0, 0x16, 0x32, 0x67, 0x68, 0xea,	// 20:02
+    0x0, 0x48, 0x4a, 0x67, 0x68, 0xea,	// 20:03
+    0x0, 0x46, 0x4a, 0x67, 0x68, 0xea,	// 20:04
+    0x0, 0x4c, 0x50, 0x67, 0x68, 0xea,	// 20:05
+    0x0, 0x47, 0x50, 0x67, 0x68, 0xea,	// 20:06
+    0x0, 0x4d, 0x50, 0x67, 0x68, 0xea,	// 20:07
+    0x0, 0x45, 0x50, 0x67, 0x68, 0xea,	// 20:08
+    0x0, 0x44, 0x50, 0x67, 0x68, 0xea,	// 20:09
+    0x0, 0x43, 0x50, 0x67, 0x68, 0xea,	// 20:10
+    0x0, 0x41, 0x42, 0x50, 0x67, 0x68, 0xea,	// 20:11
+    0x0, 0x3e, 0x40, 0x50, 0x67, 0x68, 0xea,	// 20:12
+    0x0, 0x30, 0x31, 0x3d, 0x67, 0x68, 0xea,	// 20:13
+    0x0, 0xd, 0xe, 0x3d, 0x67, 0x68, 0xea,	// 20:14
+    0x0, 0x25, 0x26, 0x67, 0x68, 0xea,	// 20:15
+    0x0, 0x1, 0x2, 0x3d, 0x67, 0x68, 0xea,	// 20:16
+    0x0, 0x27, 0x28, 0x3d, 0x67, 0x68, 0xea,	// 20:17
+    0x0, 0x6, 0x7, 0x3d, 0x67, 0x68, 0xea,	// 20:18
+    0x0, 0xb, 0xc, 0x3d, 0x67, 0x68, 0xea,	// 20:19
+    0x0, 0x4, 0x5, 0x3d, 0x67, 0x68, 0xea,	// 20:20
+    0x0, 0x4, 0x5, 0x18, 0x3a, 0x67, 0x68, 0xea,	// 20:21
+    0x0, 0x4, 0x5, 0x16, 0x32, 0x67, 0x68, 0xea,	// 20:22
+    0x0, 0x4, 0x5, 0x48, 0x4a, 0x67, 0x68, 0xea,	// 20:23
+    0x0, 0x4, 0x5, 0x46, 0x4a, 0x67, 0x68, 0xea,	// 20:24
+    0x0, 0x4, 0x5, 0x4c, 0x50, 0x67, 0x68, 0xea,	// 20:25
+    0x0, 0x4, 0x5, 0x47, 0x50, 0x67, 0x68, 0xea,	// 20:26
+    0x0, 0x4, 0x5, 0x4d, 0x50, 0x67, 0x68, 0xea,	// 20:27
+    0x0, 0x4, 0x5, 0x45, 0x50, 0x67, 0x68, 0xea,	// 20:28
+    0x0, 0x4, 0x5, 0x44, 0x50, 0x67, 0x68, 0xea,	// 20:29
+    0x0, 0x22, 0x23, 0x67, 0x68, 0xea,	// 20:30
+    0x0, 0x8, 0x12, 0x13, 0x3c, 0x3d, 0x44, 0xea,	// 20:31
+    0x0, 0x8, 0x12, 0x13, 0x3b, 0x3d, 0x44, 0xea,	// 20:32
+    0x0, 0x8, 0x12, 0x13, 0x35, 0x3d, 0x44, 0xea,	// 20:33
+    0x0, 0x8, 0x12, 0x13, 0x29, 0x3d, 0x44, 0xea,	// 20:34
+    0x0, 0x8, 0x12, 0x13, 0x34, 0x3d, 0x44, 0xea,	// 20:35
+    0x0, 0x8, 0x12, 0x13, 0x33, 0x3d, 0x44, 0xea,	// 20:36
+    0x0, 0x8, 0x12, 0x13, 0x1e, 0x3d, 0x44, 0xea,	// 20:37
+    0x0, 0x8, 0x12, 0x13, 0x36, 0x3d, 0x44, 0xea,	// 20:38
+    0x0, 0x8, 0x12, 0x13, 0x24, 0x32, 0x44, 0xea,	// 20:39
+    0x0, 0x8, 0x12, 0x13, 0x3d, 0x44, 0xea,	// 20:40
+    0x0, 0x8, 0x19, 0x1a, 0x3d, 0x44, 0xea,	// 20:41
+    0x0, 0x8, 0x1b, 0x1c, 0x3d, 0x44, 0xea,	// 20:42
+    0x0, 0x8, 0x2a, 0x2b, 0x3d, 0x44, 0xea,	// 20:43
+    0x0, 0x8, 0x9, 0xa, 0x3d, 0x44, 0xea,	// 20:44
+    0x0, 0x8, 0x2c, 0x2d, 0x44, 0xea,	// 20:45
+    0x0, 0x8, 0x14, 0x15, 0x3d, 0x44, 0xea,	// 20:46
+    0x0, 0x8, 0x37, 0x38, 0x3d, 0x44, 0xea,	// 20:47
+    0x0, 0x8, 0x20, 0x21, 0x3d, 0x44, 0xea,	// 20:48
+    0x0, 0x8, 0x10, 0x11, 0x3d, 0x44, 0xea,	// 20:49
+    0x0, 0x8, 0x39, 0x3d, 0x44, 0xea,	// 20:50
+    0x0, 0x8, 0x3c, 0x3d, 0x44, 0xea,	// 20:51
+    0x0, 0x8, 0x3b, 0x3d, 0x44, 0xea,	// 20:52
+    0x0, 0x8, 0x35, 0x3d, 0x44, 0xea,	// 20:53
+    0x0, 0x8, 0x29, 0x3d, 0x44, 0xea,	// 20:54
+    0x0, 0x8, 0x34, 0x3d, 0x44, 0xea,	// 20:55
+    0x0, 0x8, 0x33, 0x3d, 0x44, 0xea,	// 20:56
+    0x0, 0x8, 0x1e, 0x3d, 0x44, 0xea,	// 20:57
+    0x0, 0x8, 0x36, 0x3d, 0x44, 0xea,	// 20:58
+    0x0, 0x8, 0x24, 0x32, 0x44, 0xea,	// 20:59
+    0x0, 0x3, 0x44, 0x51, 0xea,	// 21:00
+    0x0, 0x18, 0x3a, 0x60, 0x61, 0xea,	// 21:01
+    0x0, 0x16, 0x32, 0x60, 0x61, 0xea,	// 21:02
+    0x0, 0x48, 0x4a, 0x60, 0x61, 0xea,	// 21:03
+    0x0, 0x46, 0x4a, 0x60, 0x61, 0xea,	// 21:04
+    0x0, 0x4c, 0x50, 0x60, 0x61, 0xea,	// 21:05
+    0x0, 0x47, 0x50, 0x60, 0x61, 0xea,	// 21:06
+    0x0, 0x4d, 0x50, 0x60, 0x61, 0xea,	// 21:07
+    0x0, 0x45, 0x50, 0x60, 0x61, 0xea,	// 21:08
+    0x0, 0x44, 0x50, 0x60, 0x61, 0xea,	// 21:09
+    0x0, 0x43, 0x50, 0x60, 0x61, 0xea,	// 21:10
+    0x0, 0x41, 0x42, 0x50, 0x60, 0x61, 0xea,	// 21:11
+    0x0, 0x3e, 0x40, 0x50, 0x60, 0x61, 0xea,	// 21:12
+    0x0, 0x30, 0x31, 0x3d, 0x60, 0x61, 0xea,	// 21:13
+    0x0, 0xd, 0xe, 0x3d, 0x60, 0x61, 0xea,	// 21:14
+    0x0, 0x25, 0x26, 0x60, 0x61, 0xea,	// 21:15
+    0x0, 0x1, 0x2, 0x3d, 0x60, 0x61, 0xea,	// 21:16
+    0x0, 0x27, 0x28, 0x3d, 0x60, 0x61, 0xea,	// 21:17
+    0x0, 0x6, 0x7, 0x3d, 0x60, 0x61, 0xea,	// 21:18
+    0x0, 0xb, 0xc, 0x3d, 0x60, 0x61, 0xea,	// 21:19
+    0x0, 0x4, 0x5, 0x3d, 0x60, 0x61, 0xea,	// 21:20
+    0x0, 0x4, 0x5, 0x18, 0x3a, 0x60, 0x61, 0xea,	// 21:21
+    0x0, 0x4, 0x5, 0x16, 0x32, 0x60, 0x61, 0xea,	// 21:22
+    0x0, 0x4, 0x5, 0x48, 0x4a, 0x60, 0x61, 0xea,	// 21:23
+    0x0, 0x4, 0x5, 0x46, 0x4a, 0x60, 0x61, 0xea,	// 21:24
+    0x0, 0x4, 0x5, 0x4c, 0x50, 0x60, 0x61, 0xea,	// 21:25
+    0x0, 0x4, 0x5, 0x47, 0x50, 0x60, 0x61, 0xea,	// 21:26
+    0x0, 0x4, 0x5, 0x4d, 0x50, 0x60, 0x61, 0xea,	// 21:27
+    0x0, 0x4, 0x5, 0x45, 0x50, 0x60, 0x61, 0xea,	// 21:28
+    0x0, 0x4, 0x5, 0x44, 0x50, 0x60, 0x61, 0xea,	// 21:29
+    0x0, 0x22, 0x23, 0x60, 0x61, 0xea,	// 21:30
+    0x0, 0x8, 0x12, 0x13, 0x3c, 0x3d, 0x43, 0xea,	// 21:31
+    0x0, 0x8, 0x12, 0x13, 0x3b, 0x3d, 0x43, 0xea,	// 21:32
+    0x0, 0x8, 0x12, 0x13, 0x35, 0x3d, 0x43, 0xea,	// 21:33
+    0x0, 0x8, 0x12, 0x13, 0x29, 0x3d, 0x43, 0xea,	// 21:34
+    0x0, 0x8, 0x12, 0x13, 0x34, 0x3d, 0x43, 0xea,	// 21:35
+    0x0, 0x8, 0x12, 0x13, 0x33, 0x3d, 0x43, 0xea,	// 21:36
+    0x0, 0x8, 0x12, 0x13, 0x1e, 0x3d, 0x43, 0xea,	// 21:37
+    0x0, 0x8, 0x12, 0x13, 0x36, 0x3d, 0x43, 0xea,	// 21:38
+    0x0, 0x8, 0x12, 0x13, 0x24, 0x32, 0x43, 0xea,	// 21:39
+    0x0, 0x8, 0x12, 0x13, 0x3d, 0x43, 0xea,	// 21:40
+    0x0, 0x8, 0x19, 0x1a, 0x3d, 0x43, 0xea,	// 21:41
+    0x0, 0x8, 0x1b, 0x1c, 0x3d, 0x43, 0xea,	// 21:42
+    0x0, 0x8, 0x2a, 0x2b, 0x3d, 0x43, 0xea,	// 21:43
+    0x0, 0x8, 0x9, 0xa, 0x3d, 0x43, 0xea,	// 21:44
+    0x0, 0x8, 0x2c, 0x2d, 0x43, 0xea,	// 21:45
+    0x0, 0x8, 0x14, 0x15, 0x3d, 0x43, 0xea,	// 21:46
+    0x0, 0x8, 0x37, 0x38, 0x3d, 0x43, 0xea,	// 21:47
+    0x0, 0x8, 0x20, 0x21, 0x3d, 0x43, 0xea,	// 21:48
+    0x0, 0x8, 0x10, 0x11, 0x3d, 0x43, 0xea,	// 21:49
+    0x0, 0x8, 0x39, 0x3d, 0x43, 0xea,	// 21:50
+    0x0, 0x8, 0x3c, 0x3d, 0x43, 0xea,	// 21:51
+    0x0, 0x8, 0x3b, 0x3d, 0x43, 0xea,	// 21:52
+    0x0, 0x8, 0x35, 0x3d, 0x43, 0xea,	// 21:53
+    0x0, 0x8, 0x29, 0x3d, 0x43, 0xea,	// 21:54
+    0x0, 0x8, 0x34, 0x3d, 0x43, 0xea,	// 21:55
+    0x0, 0x8, 0x33, 0x3d, 0x43, 0xea,	// 21:56
+    0x0, 0x8, 0x1e, 0x3d, 0x43, 0xea,	// 21:57
+    0x0, 0x8, 0x36, 0x3d, 0x43, 0xea,	// 21:58
+    0x0, 0x8, 0x24, 0x32, 0x43, 0xea,	// 21:59
+    0x0, 0x3, 0x43, 0x51, 0xea,	// 22:00
+    0x0, 0x18, 0x3a, 0x54, 0x55, 0xea,	// 22:01
+    0x0, 0x16, 0x32, 0x54, 0x55, 0xea,	// 22:02
+    0x0, 0x48, 0x4a, 0x54, 0x55, 0xea,	// 22:03
+    0x0, 0x46, 0x4a, 0x54, 0x55, 0xea,	// 22:04
+    0x0, 0x4c, 0x50, 0x54, 0x55, 0xea,	// 22:05
+    0x0, 0x47, 0x50, 0x54, 0x55, 0xea,	// 22:06
+    0x0, 0x4d, 0x50, 0x54, 0x55, 0xea,	// 22:07
+    0x0, 0x45, 0x50, 0x54, 0x55, 0xea,	// 22:08
+    0x0, 0x44, 0x50, 0x54, 0x55, 0xea,	// 22:09
+    0x0, 0x43, 0x50, 0x54, 0x55, 0xea,	// 22:10
+    0x0, 0x41, 0x42, 0x50, 0x54, 0x55, 0xea,	// 22:11
+    0x0, 0x3e, 0x40, 0x50, 0x54, 0x55, 0xea,	// 22:12
+    0x0, 0x30, 0x31, 0x3d, 0x54, 0x55, 0xea,	// 22:13
+    0x0, 0xd, 0xe, 0x3d, 0x54, 0x55, 0xea,	// 22:14
+    0x0, 0x25, 0x26, 0x54, 0x55, 0xea,	// 22:15
+    0x0, 0x1, 0x2, 0x3d, 0x54, 0x55, 0xea,	// 22:16
+    0x0, 0x27, 0x28, 0x3d, 0x54, 0x55, 0xea,	// 22:17
+    0x0, 0x6, 0x7, 0x3d, 0x54, 0x55, 0xea,	// 22:18
+    0x0, 0xb, 0xc, 0x3d, 0x54, 0x55, 0xea,	// 22:19
+    0x0, 0x4, 0x5, 0x3d, 0x54, 0x55, 0xea,	// 22:20
+    0x0, 0x4, 0x5, 0x18, 0x3a, 0x54, 0x55, 0xea,	// 22:21
+    0x0, 0x4, 0x5, 0x16, 0x32, 0x54, 0x55, 0xea,	// 22:22
+    0x0, 0x4, 0x5, 0x48, 0x4a, 0x54, 0x55, 0xea,	// 22:23
+    0x0, 0x4, 0x5, 0x46, 0x4a, 0x54, 0x55, 0xea,	// 22:24
+    0x0, 0x4, 0x5, 0x4c, 0x50, 0x54, 0x55, 0xea,	// 22:25
+    0x0, 0x4, 0x5, 0x47, 0x50, 0x54, 0x55, 0xea,	// 22:26
+    0x0, 0x4, 0x5, 0x4d, 0x50, 0x54, 0x55, 0xea,	// 22:27
+    0x0, 0x4, 0x5, 0x45, 0x50, 0x54, 0x55, 0xea,	// 22:28
+    0x0, 0x4, 0x5, 0x44, 0x50, 0x54, 0x55, 0xea,	// 22:29
+    0x0, 0x22, 0x23, 0x54, 0x55, 0xea,	// 22:30
+    0x0, 0x8, 0x12, 0x13, 0x3c, 0x3d, 0x41, 0x42, 0xea,	// 22:31
+    0x0, 0x8, 0x12, 0x13, 0x3b, 0x3d, 0x41, 0x42, 0xea,	// 22:32
+    0x0, 0x8, 0x12, 0x13, 0x35, 0x3d, 0x41, 0x42, 0xea,	// 22:33
+    0x0, 0x8, 0x12, 0x13, 0x29, 0x3d, 0x41, 0x42, 0xea,	// 22:34
+    0x0, 0x8, 0x12, 0x13, 0x34, 0x3d, 0x41, 0x42, 0xea,	// 22:35
+    0x0, 0x8, 0x12, 0x13, 0x33, 0x3d, 0x41, 0x42, 0xea,	// 22:36
+    0x0, 0x8, 0x12, 0x13, 0x1e, 0x3d, 0x41, 0x42, 0xea,	// 22:37
+    0x0, 0x8, 0x12, 0x13, 0x36, 0x3d, 0x41, 0x42, 0xea,	// 22:38
+    0x0, 0x8, 0x12, 0x13, 0x24, 0x32, 0x41, 0x42, 0xea,	// 22:39
+    0x0, 0x8, 0x12, 0x13, 0x3d, 0x41, 0x42, 0xea,	// 22:40
+    0x0, 0x8, 0x19, 0x1a, 0x3d, 0x41, 0x42, 0xea,	// 22:41
+    0x0, 0x8, 0x1b, 0x1c, 0x3d, 0x41, 0x42, 0xea,	// 22:42
+    0x0, 0x8, 0x2a, 0x2b, 0x3d, 0x41, 0x42, 0xea,	// 22:43
+    0x0, 0x8, 0x9, 0xa, 0x3d, 0x41, 0x42, 0xea,	// 22:44
+    0x0, 0x8, 0x2c, 0x2d, 0x41, 0x42, 0xea,	// 22:45
+    0x0, 0x8, 0x14, 0x15, 0x3d, 0x41, 0x42, 0xea,	// 22:46
+    0x0, 0x8, 0x37, 0x38, 0x3d, 0x41, 0x42, 0xea,	// 22:47
+    0x0, 0x8, 0x20, 0x21, 0x3d, 0x41, 0x42, 0xea,	// 22:48
+    0x0, 0x8, 0x10, 0x11, 0x3d, 0x41, 0x42, 0xea,	// 22:49
+    0x0, 0x8, 0x39, 0x3d, 0x41, 0x42, 0xea,	// 22:50
+    0x0, 0x8, 0x3c, 0x3d, 0x41, 0x42, 0xea,	// 22:51
+    0x0, 0x8, 0x3b, 0x3d, 0x41, 0x42, 0xea,	// 22:52
+    0x0, 0x8, 0x35, 0x3d, 0x41, 0x42, 0xea,	// 22:53
+    0x0, 0x8, 0x29, 0x3d, 0x41, 0x42, 0xea,	// 22:54
+    0x0, 0x8, 0x34, 0x3d, 0x41, 0x42, 0xea,	// 22:55
+    0x0, 0x8, 0x33, 0x3d, 0x41, 0x42, 0xea,	// 22:56
+    0x0, 0x8, 0x1e, 0x3d, 0x41, 0x42, 0xea,	// 22:57
+    0x0, 0x8, 0x36, 0x3d, 0x41, 0x42, 0xea,	// 22:58
+    0x0, 0x8, 0x24, 0x32, 0x41, 0x42, 0xea,	// 22:59
+    0x0, 0x3, 0x41, 0x42, 0x51, 0xea,	// 23:00
+    0x0, 0x18, 0x3a, 0x52, 0x53, 0xe6,	// 23:01
+    0x0, 0x16, 0x32, 0x52, 0x53, 0xe6,	// 23:02
+    0x0, 0x48, 0x4a, 0x52, 0x53, 0xe6,	// 23:03
+    0x0, 0x46, 0x4a, 0x52, 0x53, 0xe6,	// 23:04
+    0x0, 0x4c, 0x50, 0x52, 0x53, 0xe6,	// 23:05
+    0x0, 0x47, 0x50, 0x52, 0x53, 0xe6,	// 23:06
+    0x0, 0x4d, 0x50, 0x52, 0x53, 0xe6,	// 23:07
+    0x0, 0x45, 0x50, 0x52, 0x53, 0xe6,	// 23:08
+    0x0, 0x44, 0x50, 0x52, 0x53, 0xe6,	// 23:09
+    0x0, 0x43, 0x50, 0x52, 0x53, 0xe6,	// 23:10
+    0x0, 0x41, 0x42, 0x50, 0x52, 0x53, 0xe6,	// 23:11
+    0x0, 0x3e, 0x40, 0x50, 0x52, 0x53, 0xe6,	// 23:12
+    0x0, 0x30, 0x31, 0x3d, 0x52, 0x53, 0xe6,	// 23:13
+    0x0, 0xd, 0xe, 0x3d, 0x52, 0x53, 0xe6,	// 23:14
+    0x0, 0x25, 0x26, 0x52, 0x53, 0xe6,	// 23:15
+    0x0, 0x1, 0x2, 0x3d, 0x52, 0x53, 0xe6,	// 23:16
+    0x0, 0x27, 0x28, 0x3d, 0x52, 0x53, 0xe6,	// 23:17
+    0x0, 0x6, 0x7, 0x3d, 0x52, 0x53, 0xe6,	// 23:18
+    0x0, 0xb, 0xc, 0x3d, 0x52, 0x53, 0xe6,	// 23:19
+    0x0, 0x4, 0x5, 0x3d, 0x52, 0x53, 0xe6,	// 23:20
+    0x0, 0x4, 0x5, 0x18, 0x3a, 0x52, 0x53, 0xe6,	// 23:21
+    0x0, 0x4, 0x5, 0x16, 0x32, 0x52, 0x53, 0xe6,	// 23:22
+    0x0, 0x4, 0x5, 0x48, 0x4a, 0x52, 0x53, 0xe6,	// 23:23
+    0x0, 0x4, 0x5, 0x46, 0x4a, 0x52, 0x53, 0xe6,	// 23:24
+    0x0, 0x4, 0x5, 0x4c, 0x50, 0x52, 0x53, 0xe6,	// 23:25
+    0x0, 0x4, 0x5, 0x47, 0x50, 0x52, 0x53, 0xe6,	// 23:26
+    0x0, 0x4, 0x5, 0x4d, 0x50, 0x52, 0x53, 0xe6,	// 23:27
+    0x0, 0x4, 0x5, 0x45, 0x50, 0x52, 0x53, 0xe6,	// 23:28
+    0x0, 0x4, 0x5, 0x44, 0x50, 0x52, 0x53, 0xe6,	// 23:29
+    0x0, 0x22, 0x23, 0x52, 0x53, 0xe6,	// 23:30
+    0x0, 0x8, 0x12, 0x13, 0x3c, 0x3d, 0x3e, 0x40, 0xe6,	// 23:31
+    0x0, 0x8, 0x12, 0x13, 0x3b, 0x3d, 0x3e, 0x40, 0xe6,	// 23:32
+    0x0, 0x8, 0x12, 0x13, 0x35, 0x3d, 0x3e, 0x40, 0xe6,	// 23:33
+    0x0, 0x8, 0x12, 0x13, 0x29, 0x3d, 0x3e, 0x40, 0xe6,	// 23:34
+    0x0, 0x8, 0x12, 0x13, 0x34, 0x3d, 0x3e, 0x40, 0xe6,	// 23:35
+    0x0, 0x8, 0x12, 0x13, 0x33, 0x3d, 0x3e, 0x40, 0xe6,	// 23:36
+    0x0, 0x8, 0x12, 0x13, 0x1e, 0x3d, 0x3e, 0x40, 0xe6,	// 23:37
+    0x0, 0x8, 0x12, 0x13, 0x36, 0x3d, 0x3e, 0x40, 0xe6,	// 23:38
+    0x0, 0x8, 0x12, 0x13, 0x24, 0x32, 0x3e, 0x40, 0xe6,	// 23:39
+    0x0, 0x8, 0x12, 0x13, 0x3d, 0x3e, 0x40, 0xe6,	// 23:40
+    0x0, 0x8, 0x19, 0x1a, 0x3d, 0x3e, 0x40, 0xe6,	// 23:41
+    0x0, 0x8, 0x1b, 0x1c, 0x3d, 0x3e, 0x40, 0xe6,	// 23:42
+    0x0, 0x8, 0x2a, 0x2b, 0x3d, 0x3e, 0x40, 0xe6,	// 23:43
+    0x0, 0x8, 0x9, 0xa, 0x3d, 0x3e, 0x40, 0xe6,	// 23:44
+    0x0, 0x8, 0x2c, 0x2d, 0x3e, 0x40, 0xe6,	// 23:45
+    0x0, 0x8, 0x14, 0x15, 0x3d, 0x3e, 0x40, 0xe6,	// 23:46
+    0x0, 0x8, 0x37, 0x38, 0x3d, 0x3e, 0x40, 0xe6,	// 23:47
+    0x0, 0x8, 0x20, 0x21, 0x3d, 0x3e, 0x40, 0xe6,	// 23:48
+    0x0, 0x8, 0x10, 0x11, 0x3d, 0x3e, 0x40, 0xe6,	// 23:49
+    0x0, 0x8, 0x39, 0x3d, 0x3e, 0x40, 0xe6,	// 23:50
+    0x0, 0x8, 0x3c, 0x3d, 0x3e, 0x40, 0xe6,	// 23:51
+    0x0, 0x8, 0x3b, 0x3d, 0x3e, 0x40, 0xe6,	// 23:52
+    0x0, 0x8, 0x35, 0x3d, 0x3e, 0x40, 0xe6,	// 23:53
+    0x0, 0x8, 0x29, 0x3d, 0x3e, 0x40, 0xe6,	// 23:54
+    0x0, 0x8, 0x34, 0x3d, 0x3e, 0x40, 0xe6,	// 23:55
+    0x0, 0x8, 0x33, 0x3d, 0x3e, 0x40, 0xe6,	// 23:56
+    0x0, 0x8, 0x1e, 0x3d, 0x3e, 0x40, 0xe6,	// 23:57
+    0x0, 0x8, 0x36, 0x3d, 0x3e, 0x40, 0xe6,	// 23:58
+    0x0, 0x8, 0x24, 0x32, 0x3e, 0x40, 0xe6,	// 23:59
+};
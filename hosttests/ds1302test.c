@@ -0,0 +1,385 @@
+/************************************************************************
+	ds1302test.c
+
+    Host test for the DS1302 serial protocol and timing
+    Copyright (C) 2026 Simon Inns
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+	Email: simon.inns@gmail.com
+
+************************************************************************/
+
+// ds1302.c is run against a model of the DS1302.  Every port write, pin
+// read and delay advances a CPU cycle count, so each SCLK, CE and IO edge
+// has a time.  The model shifts commands and data in and out as the chip
+// would, and checks every edge against the datasheet AC characteristics
+// for MODEL_VCC (the supply of the modelled chip, which is kept separate
+// from the RTC_VCC profile in ds1302.h so a wrong profile is caught):
+//
+// - tCC, tCCH and tCWH around CE, and CE only rising with SCLK low;
+// - tCL and tCH for every SCLK pulse;
+// - tDC and tCDH for data written to the chip;
+// - tCDD for data read from the chip (allowing for the pin synchroniser);
+// - the IO pin is never driven by both sides.
+//
+// It also checks that the synchronous and asynchronous reads and writes
+// move the right data, and reports the time taken.
+
+// Includes
+#include <stdio.h>
+#include <string.h>
+#include <avr/io.h>
+#include "../hardware.h"
+#include "../ds1302.h"
+
+#ifndef MODEL_VCC
+#define MODEL_VCC	5
+#endif
+
+// Clock registers (the 7 time and date registers and the write protect)
+#define REGISTERS	8
+
+// DS1302 AC characteristics in nS (minimums, except tCDD which is the
+// maximum read data delay)
+#if MODEL_VCC == 5
+#define MODEL_TDC	50
+#define MODEL_TCDH	70
+#define MODEL_TCDD	200
+#define MODEL_TCL	250
+#define MODEL_TCH	250
+#define MODEL_TCC	1000
+#define MODEL_TCCH	60
+#define MODEL_TCWH	1000
+#elif MODEL_VCC == 2
+#define MODEL_TDC	200
+#define MODEL_TCDH	280
+#define MODEL_TCDD	800
+#define MODEL_TCL	1000
+#define MODEL_TCH	1000
+#define MODEL_TCC	4000
+#define MODEL_TCCH	240
+#define MODEL_TCWH	4000
+#else
+#error "MODEL_VCC must be 5 or 2"
+#endif
+
+// Cycles to nS
+#define NS(cycles)	((cycles) * 1000.0 / (F_CPU / 1000000UL))
+
+// A port access (sbi/cbi) takes 2 cycles and a pin read 1.  A pin is
+// sampled by the synchroniser up to 2 cycles before it is read.
+#define PORTCYCLES		2
+#define PINCYCLES		1
+#define SYNCCYCLES		2
+
+// Time in cycles and the time of the last port write (which is seen at the
+// next access, as the hook is called before the write)
+unsigned long cycles = 0;
+unsigned long writeCycles = 0;
+
+// Pin states at the last edge and the times of the edges in nS
+unsigned char lastPort = 0;
+unsigned char lastDir = 0;
+double ceRise = -1e9, ceFall = -1e9, sclkRise = -1e9, sclkFall = -1e9, ioChange = -1e9;
+double dataValid = 0;
+
+// Chip state
+unsigned char registers[REGISTERS];
+unsigned int bitCount = 0;
+unsigned char command = 0;
+unsigned char writeData = 0;
+unsigned char reading = 0;
+unsigned char driving = 0;
+unsigned int outputBit = 0;
+
+int errors = 0;
+
+#define ERROR(...)	do { printf("  error at %.0f nS: ", NS(cycles)); printf(__VA_ARGS__); printf("\n"); errors++; } while (0)
+
+#define SCLK(port)	(((port) >> RTC_SCLK_PIN) & 1)
+#define IO(port)	(((port) >> RTC_IO_PIN) & 1)
+#define CE(port)	(((port) >> RTC_CE_PIN) & 1)
+
+// Register index for a command (byte number in a clock burst)
+unsigned char registerIndex(unsigned char command)
+{
+	return ((command & 0x3E) >> 1) & (REGISTERS - 1);
+}
+
+// Store a byte written to the chip (writes are ignored while write
+// protected, except to the write protect register)
+void storeByte(unsigned int byteNumber, unsigned char data)
+{
+	unsigned char index;
+	
+	if ((command & 0xFE) == CLOCK_BURST)
+	{
+		if (byteNumber >= REGISTERS) return;
+		index = byteNumber;
+	}
+	else
+	{
+		if (byteNumber != 0) return;
+		index = registerIndex(command);
+	}
+	
+	if ((registers[7] & 0x80) && index != 7) return;
+	registers[index] = data;
+}
+
+// Check the pins after a port write at time t
+void portEdge(double t, unsigned char port, unsigned char dir)
+{
+	// CE rising
+	if (CE(port) && !CE(lastPort))
+	{
+		if (SCLK(port)) ERROR("CE rising with SCLK high");
+		if (t - ceFall < MODEL_TCWH) ERROR("tCWH %.0f nS", t - ceFall);
+		ceRise = t;
+		bitCount = 0;
+		reading = 0;
+		driving = 0;
+	}
+	
+	// CE falling (the chip stops driving IO)
+	if (!CE(port) && CE(lastPort))
+	{
+		double lastClock = sclkRise > sclkFall ? sclkRise : sclkFall;
+		if (t - lastClock < MODEL_TCCH) ERROR("tCCH %.0f nS", t - lastClock);
+		ceFall = t;
+		driving = 0;
+	}
+	
+	// IO driven by the CPU
+	if (dir & (1 << RTC_IO_DIR_PIN))
+	{
+		if (driving) ERROR("IO driven by the CPU and the RTC");
+		
+		if (!(lastDir & (1 << RTC_IO_DIR_PIN)) || IO(port) != IO(lastPort))
+		{
+			if (CE(port) && t - sclkRise < MODEL_TCDH) ERROR("tCDH %.0f nS", t - sclkRise);
+			ioChange = t;
+		}
+	}
+	
+	// SCLK rising (the chip reads IO)
+	if (SCLK(port) && !SCLK(lastPort))
+	{
+		if (CE(port))
+		{
+			if (t - ceRise < MODEL_TCC) ERROR("tCC %.0f nS", t - ceRise);
+			if (t - sclkFall < MODEL_TCL) ERROR("tCL %.0f nS", t - sclkFall);
+			
+			if (!reading)
+			{
+				unsigned char bit = IO(port);
+				
+				if (!(dir & (1 << RTC_IO_DIR_PIN))) ERROR("bit written with IO as an input");
+				if (t - ioChange < MODEL_TDC) ERROR("tDC %.0f nS", t - ioChange);
+				
+				if (bitCount < 8)
+				{
+					if (bitCount == 0) command = 0;
+					command |= bit << bitCount;
+					if (bitCount == 7 && (command & RTC_READ))
+					{
+						reading = 1;
+						outputBit = 0;
+					}
+				}
+				else
+				{
+					unsigned int dataBit = (bitCount - 8) % 8;
+					if (dataBit == 0) writeData = 0;
+					writeData |= bit << dataBit;
+					if (dataBit == 7) storeByte((bitCount - 8) / 8, writeData);
+				}
+				bitCount++;
+			}
+		}
+		sclkRise = t;
+	}
+	
+	// SCLK falling (the chip outputs the next bit when reading)
+	if (!SCLK(port) && SCLK(lastPort))
+	{
+		if (CE(port))
+		{
+			if (t - sclkRise < MODEL_TCH) ERROR("tCH %.0f nS", t - sclkRise);
+			if (reading)
+			{
+				driving = 1;
+				dataValid = t + MODEL_TCDD;
+				outputBit++;
+			}
+		}
+		sclkFall = t;
+	}
+	
+	lastPort = port;
+	lastDir = dir;
+}
+
+// Handle the last port write before time moves on
+void syncPort(void)
+{
+	if (PORTD != lastPort || DDRD != lastDir) portEdge(NS(writeCycles), PORTD, DDRD);
+}
+
+// Port hook: the write follows the call
+volatile uint8_t *hostSfr(volatile uint8_t *sfr)
+{
+	syncPort();
+	cycles += PORTCYCLES;
+	writeCycles = cycles;
+	return sfr;
+}
+
+void hostDelayCycles(unsigned long delay)
+{
+	syncPort();
+	cycles += delay;
+}
+
+// Pin hook: the bit the chip is driving on IO
+uint8_t hostReadPin(volatile uint8_t *pin)
+{
+	syncPort();
+	cycles += PINCYCLES;
+	
+	if (!driving) return 0;
+	
+	double sampled = NS(cycles - SYNCCYCLES);
+	if (sampled < dataValid) ERROR("tCDD: IO sampled %.0f nS after SCLK fell", sampled - (dataValid - MODEL_TCDD));
+	
+	unsigned int byteNumber = (outputBit - 1) / 8;
+	unsigned int bitNumber = (outputBit - 1) % 8;
+	unsigned char data;
+	
+	if ((command & 0xFE) == CLOCK_BURST) data = registers[byteNumber % REGISTERS];
+	else data = registers[registerIndex(command)];
+	
+	return ((data >> bitNumber) & 1) << RTC_IO_PIN;
+}
+
+// Set the chip to 12:34:59 17/10/26, day 6, write protected
+void resetChip(unsigned char seconds)
+{
+	unsigned char time[REGISTERS] = {seconds, 0x34, 0x12, 0x17, 0x10, 0x06, 0x26, 0x80};
+	memcpy(registers, time, sizeof(registers));
+}
+
+// Check the time and date read
+void checkDatetime(const char *name, struct datetimeStruct *read,
+	unsigned int hours, unsigned int minutes, unsigned int seconds)
+{
+	if (read->hours != hours || read->minutes != minutes || read->seconds != seconds ||
+		read->day != 17 || read->month != 10 || read->year != 26 || read->dayNo != 6)
+	{
+		ERROR("%s read %02u:%02u:%02u %02u/%02u/%02u day %u", name, read->hours, read->minutes,
+			read->seconds, read->day, read->month, read->year, read->dayNo);
+	}
+}
+
+// Start up with the clock halted and running
+void testInitialise(void)
+{
+	printf("Initialise\n");
+	
+	resetChip(0x80 | 0x59);
+	initialiseRTC();
+	if (readClockStatus() != CLOCK_UNSET) ERROR("halted clock reported as set");
+	if (registers[0] != 0x00) ERROR("halted clock not started (seconds %02x)", registers[0]);
+	if (registers[7] != 0x00) ERROR("write protect not cleared");
+	
+	resetChip(0x59);
+	initialiseRTC();
+	if (readClockStatus() != CLOCK_SET) ERROR("running clock reported as unset");
+	if (registers[0] != 0x59) ERROR("running clock changed (seconds %02x)", registers[0]);
+}
+
+// Synchronous read and write
+void testReadWrite(void)
+{
+	unsigned long start;
+	
+	printf("Read and write\n");
+	
+	resetChip(0x59);
+	registers[7] = 0x00;
+	start = cycles;
+	readRTC();
+	printf("  readRTC() %.1f uS\n", NS(cycles - start) / 1000);
+	checkDatetime("readRTC()", &datetime, 12, 34, 59);
+	
+	datetime.hours = 23;
+	datetime.minutes = 45;
+	datetime.seconds = 7;
+	start = cycles;
+	setRTC();
+	printf("  setRTC() %.1f uS\n", NS(cycles - start) / 1000);
+	if (registers[0] != 0x07 || registers[1] != 0x45 || registers[2] != 0x23)
+		ERROR("setRTC() wrote %02x:%02x:%02x", registers[2], registers[1], registers[0]);
+	
+	datetime.hours = 0;
+	readRTC();
+	checkDatetime("read back", &datetime, 23, 45, 7);
+}
+
+// A write requested during an asynchronous read waits for the read
+void testAsynchronous(void)
+{
+	unsigned long start, longest = 0;
+	int steps = 0;
+	
+	printf("Write during an asynchronous read\n");
+	
+	resetChip(0x59);
+	registers[7] = 0x00;
+	
+	if (!startReadRTC()) ERROR("read not started");
+	stepRTC();
+	
+	datetime = rtcDatetime;
+	datetime.hours = 5;
+	datetime.minutes = 6;
+	writeRTC();
+	if (startReadRTC()) ERROR("read started while busy");
+	
+	while (busyRTC())
+	{
+		start = cycles;
+		stepRTC();
+		if (cycles - start > longest) longest = cycles - start;
+		steps++;
+	}
+	printf("  %d more steps, longest %.1f uS\n", steps, NS(longest) / 1000);
+	
+	if (!readCompleteRTC()) ERROR("read not completed");
+	checkDatetime("asynchronous read", &rtcDatetime, 12, 34, 59);
+	if (registers[2] != 0x05 || registers[1] != 0x06) ERROR("write after the read wrote %02x:%02x", registers[2], registers[1]);
+}
+
+int main(void)
+{
+	printf("DS1302 at %dV with the %dV timing profile\n", MODEL_VCC, RTC_VCC);
+	
+	testInitialise();
+	testReadWrite();
+	testAsynchronous();
+	
+	printf("%s: %d errors\n", errors ? "FAILED" : "passed", errors);
+	return errors != 0;
+}
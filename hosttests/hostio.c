@@ -0,0 +1,57 @@
+/************************************************************************
+	hostio.c
+
+    Host test stand-in for the AVR I/O registers (see hosttests/Makefile)
+    Copyright (C) 2026 Simon Inns
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+	Email: simon.inns@gmail.com
+
+************************************************************************/
+
+// Includes
+#include <avr/io.h>
+
+// Registers
+volatile uint8_t PORTB, PORTC, PORTD;
+volatile uint8_t DDRB, DDRC, DDRD;
+volatile uint8_t SPCR, SPDR, hostSPSR;
+volatile uint8_t TCCR1A, TCCR1B, TCCR2A, TCCR2B, TIMSK2, TCNT2;
+volatile uint8_t TCNT0, TIFR0;
+volatile uint16_t OCR1A, ICR1;
+volatile uint8_t hostPIND;
+
+// Default hooks (a test defines its own to watch the hardware)
+__attribute__((weak)) volatile uint8_t *hostSfr(volatile uint8_t *sfr)
+{
+	return sfr;
+}
+
+__attribute__((weak)) uint8_t hostReadPin(volatile uint8_t *pin)
+{
+	return *pin;
+}
+
+// SPI transfers complete straight away
+__attribute__((weak)) volatile uint8_t *hostReadSpsr(void)
+{
+	hostSPSR |= (1 << SPIF);
+	return &hostSPSR;
+}
+
+__attribute__((weak)) void hostDelayCycles(unsigned long cycles)
+{
+	(void)cycles;
+}
@@ -0,0 +1,375 @@
+/************************************************************************
+	tlc5940test.c
+
+    Host test for the TLC5940 frame commit and latch handshake
+    Copyright (C) 2026 Simon Inns
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+	Email: simon.inns@gmail.com
+
+************************************************************************/
+
+// The TIMER2 and SPI interrupts of tlc5940.c are run against a model of
+// the TLC5940 chain: every byte is logged as it finishes shifting out and
+// an XLAT pulse latches the last 24 * NUMBEROF5940 bytes.  The test checks
+// that:
+//
+// - every latched gray-scale frame is a frame committed by the fade pass
+//   (the back buffer after a TIMER2 interrupt), in commit order, so no
+//   frame is torn by a swap during a transfer;
+// - LEDs fading together move in lock-step (all equal in every frame);
+// - with a fast SPI every committed frame is latched, one per PWM period;
+// - the last frame latched is the target brightness once the fades end;
+// - dot correction values are packed as the bit stream the TLC5940 expects;
+// - a dot correction update is latched as sent and the gray-scale frame
+//   is sent again after it.
+
+// Includes
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <avr/io.h>
+#include "../hardware.h"
+#include "../tlc5940.h"
+
+#define CHANNELS		(16 * NUMBEROF5940)
+#define FRAMEBYTES		(24 * NUMBEROF5940)
+#define DCBYTES			(12 * NUMBEROF5940)
+#define MAXFRAMES		4096
+
+// tlc5940.c internals used by the test
+extern unsigned char * volatile backBuffer;
+extern unsigned char packedDotCorrection[];
+void TIMER2_OVF_vect(void);
+void SPI_STC_vect(void);
+
+// Scheduler state used by SCHEDULER_WAKE() (scheduler.c isn't linked, and
+// the CPU never sleeps here)
+volatile unsigned int schedulerTicks;
+volatile unsigned char schedulerSleeping;
+volatile unsigned int schedulerWakeTicks;
+volatile unsigned char schedulerWakeCounts;
+
+// Model of the TLC5940 chain
+unsigned char shiftRegister[FRAMEBYTES];	// The last bytes shifted in
+unsigned char latchedDotCorrection[DCBYTES];
+unsigned char lastPortD = 0;
+int dotCorrectionLatches = 0;
+
+// Frames committed by the fade pass and latched by the chain
+int committed[MAXFRAMES][CHANNELS];
+int committedCount = 0;
+int latched[MAXFRAMES][CHANNELS];
+int latchedCount = 0;
+
+int errors = 0;
+
+#define ERROR(...)	do { printf("  error: "); printf(__VA_ARGS__); printf("\n"); errors++; } while (0)
+
+// Shift one byte into the chain
+void shiftByte(unsigned char byte)
+{
+	memmove(shiftRegister, shiftRegister + 1, FRAMEBYTES - 1);
+	shiftRegister[FRAMEBYTES - 1] = byte;
+}
+
+// Read the 12 bit values from a packed frame (channel 0 is shifted out
+// last, so it is at the end of the buffer)
+void unpackFrame(unsigned char *buffer, int *frame)
+{
+	for (int channel = 0; channel < CHANNELS; channel++)
+	{
+		int eightBitIndex = (CHANNELS - 1) - channel;
+		unsigned char *twelveBitIndex = buffer + ((eightBitIndex * 3) >> 1);
+		
+		if (eightBitIndex & 1) frame[channel] = ((twelveBitIndex[0] & 0x0F) << 8) | twelveBitIndex[1];
+		else frame[channel] = (twelveBitIndex[0] << 4) | (twelveBitIndex[1] >> 4);
+	}
+}
+
+// Port hook: XLAT is pulsed with sbi() then cbi(), so it is seen high at the
+// next port access
+volatile uint8_t *hostSfr(volatile uint8_t *sfr)
+{
+	unsigned char xlatHigh = PORTD & (1 << TLC5940_XLAT_PIN);
+	
+	if (xlatHigh && !(lastPortD & (1 << TLC5940_XLAT_PIN)))
+	{
+		if (PORTD & (1 << TLC5940_VPRG_PIN))
+		{
+			// Dot correction is the last 96 bits per chip shifted in
+			memcpy(latchedDotCorrection, shiftRegister + FRAMEBYTES - DCBYTES, DCBYTES);
+			dotCorrectionLatches++;
+		}
+		else if (latchedCount < MAXFRAMES)
+		{
+			unpackFrame(shiftRegister, latched[latchedCount++]);
+		}
+	}
+	
+	lastPortD = PORTD;
+	return sfr;
+}
+
+// SPSR is polled after each byte of a burst is written, so the byte in SPDR
+// has been sent
+volatile uint8_t *hostReadSpsr(void)
+{
+	shiftByte(SPDR);
+	hostSPSR |= (1 << SPIF);
+	return &hostSPSR;
+}
+
+// Run the TLC5940 for a number of PWM periods, running up to spiInterrupts
+// SPI transfer complete interrupts in each one
+void runFrames(int frames, int spiInterrupts)
+{
+	int frame[CHANNELS];
+	
+	for (int frameNumber = 0; frameNumber < frames; frameNumber++)
+	{
+		TIMER2_OVF_vect();
+		
+		// A frame is committed whenever the back buffer changes
+		unpackFrame(backBuffer, frame);
+		if (committedCount == 0 || memcmp(frame, committed[committedCount - 1], sizeof(frame)) != 0)
+		{
+			if (committedCount < MAXFRAMES)
+				memcpy(committed[committedCount++], frame, sizeof(frame));
+		}
+		
+		// The byte in SPDR finishes shifting and raises the interrupt
+		for (int interrupt = 0; interrupt < spiInterrupts && (SPCR & (1 << SPIE)); interrupt++)
+		{
+			shiftByte(SPDR);
+			SPI_STC_vect();
+		}
+	}
+}
+
+// Most PWM periods a frame can take to send (each SPI interrupt sends at
+// least one byte)
+int framePeriods(int spiInterrupts)
+{
+	return (FRAMEBYTES + spiInterrupts - 1) / spiInterrupts;
+}
+
+// Reset the chain model and the fade engine
+void resetTest(void)
+{
+	memset(shiftRegister, 0, sizeof(shiftRegister));
+	lastPortD = 0;
+	PORTD = 0;
+	
+	initialiseTlc5940();
+	initialiseFadingLeds();
+	
+	// Forget the frame latched by initialiseTlc5940()
+	committedCount = 0;
+	latchedCount = 0;
+	dotCorrectionLatches = 0;
+	
+	// The cleared frame is the first committed frame
+	runFrames(0, 0);
+	unpackFrame(backBuffer, committed[committedCount++]);
+}
+
+// Check that every latched frame is a committed frame, in commit order
+void checkLatchedFrames(void)
+{
+	int commitNumber = 0;
+	
+	for (int latchNumber = 0; latchNumber < latchedCount; latchNumber++)
+	{
+		while (commitNumber < committedCount &&
+			memcmp(latched[latchNumber], committed[commitNumber], sizeof(latched[0])) != 0)
+			commitNumber++;
+		
+		if (commitNumber == committedCount)
+		{
+			ERROR("latched frame %d was never committed (or is out of order)", latchNumber);
+			return;
+		}
+	}
+}
+
+// Check that the given channels hold the same value in every frame
+void checkLockStep(int frames[][CHANNELS], int count, const char *name)
+{
+	for (int frameNumber = 0; frameNumber < count; frameNumber++)
+	{
+		for (int channel = 1; channel < CHANNELS; channel++)
+		{
+			if (frames[frameNumber][channel] != frames[frameNumber][0])
+			{
+				ERROR("%s frame %d: channel %d is %d, channel 0 is %d", name, frameNumber,
+					channel, frames[frameNumber][channel], frames[frameNumber][0]);
+				return;
+			}
+		}
+	}
+}
+
+// Fade all the LEDs together
+void testLockStep(int spiInterrupts)
+{
+	printf("Fade all %d LEDs 0 -> 4095 at 30 per period, %d SPI interrupts per period\n", CHANNELS, spiInterrupts);
+	
+	resetTest();
+	setLedFadeSpeed(30, 30);
+	for (int channel = 0; channel < CHANNELS; channel++) setLedBrightness(channel, 4095);
+	runFrames(200 + 2 * framePeriods(spiInterrupts), spiInterrupts);
+	
+	printf("  %d frames committed, %d latched\n", committedCount, latchedCount);
+	
+	checkLatchedFrames();
+	checkLockStep(committed, committedCount, "committed");
+	checkLockStep(latched, latchedCount, "latched");
+	
+	// 0, then 137 steps of 30 up to 4095
+	if (committedCount != 1 + (4095 + 29) / 30)
+		ERROR("%d frames committed, expected %d", committedCount, 1 + (4095 + 29) / 30);
+	
+	// Each step is 30 (the last one may be shorter)
+	for (int frameNumber = 1; frameNumber < committedCount; frameNumber++)
+	{
+		int step = committed[frameNumber][0] - committed[frameNumber - 1][0];
+		if (step != 30 && committed[frameNumber][0] != 4095)
+			ERROR("committed frame %d stepped by %d", frameNumber, step);
+	}
+	
+	// With a fast SPI every committed frame after the first is latched
+	if (spiInterrupts >= FRAMEBYTES && latchedCount != committedCount - 1)
+		ERROR("%d frames latched, expected %d", latchedCount, committedCount - 1);
+	
+	if (latchedCount == 0 || latched[latchedCount - 1][0] != 4095)
+		ERROR("the last frame latched is not at the target brightness");
+}
+
+// Random brightness changes and fade speeds
+void testRandom(int spiInterrupts, unsigned int seed)
+{
+	int target[CHANNELS] = {0};
+	
+	printf("Random fades, %d SPI interrupts per period\n", spiInterrupts);
+	
+	srand(seed);
+	resetTest();
+	
+	for (int step = 0; step < 300; step++)
+	{
+		if ((rand() % 8) == 0) setLedFadeSpeed(1 + rand() % 4095, 1 + rand() % 4095);
+		
+		for (int changes = rand() % 10; changes > 0; changes--)
+		{
+			int channel = rand() % CHANNELS;
+			target[channel] = rand() % 4096;
+			setLedBrightness(channel, target[channel]);
+		}
+		
+		runFrames(1 + rand() % 3, spiInterrupts);
+	}
+	
+	// Let the fades finish and the last frame go out
+	setLedFadeSpeed(4095, 4095);
+	runFrames(20 + 2 * framePeriods(spiInterrupts), spiInterrupts);
+	
+	printf("  %d frames committed, %d latched\n", committedCount, latchedCount);
+	
+	checkLatchedFrames();
+	
+	for (int channel = 0; channel < CHANNELS; channel++)
+	{
+		if (latchedCount == 0 || latched[latchedCount - 1][channel] != target[channel])
+		{
+			ERROR("channel %d latched at %d, target %d", channel,
+				latchedCount ? latched[latchedCount - 1][channel] : -1, target[channel]);
+			break;
+		}
+	}
+}
+
+// Dot correction packing against a bit by bit reference: 6 bits per
+// channel, MSB first, highest channel first
+void testDotCorrectionPacking(void)
+{
+	unsigned char value[CHANNELS];
+	
+	printf("Dot correction packing\n");
+	
+	srand(4);
+	for (int channel = 0; channel < CHANNELS; channel++)
+	{
+		value[channel] = rand() % 64;
+		setDotCorrection(channel, value[channel]);
+	}
+	
+	for (int bit = 0; bit < DCBYTES * 8; bit++)
+	{
+		int channel = (CHANNELS - 1) - (bit / 6);
+		int expected = (value[channel] >> (5 - (bit % 6))) & 1;
+		int packed = (packedDotCorrection[bit / 8] >> (7 - (bit % 8))) & 1;
+		
+		if (packed != expected)
+		{
+			ERROR("bit %d (channel %d) is %d, expected %d", bit, channel, packed, expected);
+			return;
+		}
+	}
+}
+
+// Dot correction update in the middle of a fade
+void testDotCorrection(int spiInterrupts)
+{
+	printf("Dot correction update during a fade, %d SPI interrupts per period\n", spiInterrupts);
+	
+	resetTest();
+	setLedFadeSpeed(100, 100);
+	for (int channel = 0; channel < CHANNELS; channel++) setLedBrightness(channel, 2000);
+	runFrames(5, spiInterrupts);
+	
+	for (int channel = 0; channel < CHANNELS; channel++) setDotCorrection(channel, channel % 64);
+	updateDotCorrection();
+	runFrames(20 + 3 * framePeriods(spiInterrupts), spiInterrupts);
+	
+	checkLatchedFrames();
+	checkLockStep(latched, latchedCount, "latched");
+	
+	if (dotCorrectionLatches != 1)
+		ERROR("dot correction latched %d times", dotCorrectionLatches);
+	else if (memcmp(latchedDotCorrection, packedDotCorrection, DCBYTES) != 0)
+		ERROR("latched dot correction differs from the data sent");
+	
+	if (latchedCount == 0 || latched[latchedCount - 1][0] != 2000)
+		ERROR("the gray-scale frame was not sent again after the dot correction");
+}
+
+int main(void)
+{
+	// Enough interrupts to send a whole frame each period, and a slow SPI
+	// which takes several periods per frame (so frames are committed during
+	// transfers and wait for the swap)
+	testLockStep(FRAMEBYTES);
+	testLockStep(5);
+	testRandom(FRAMEBYTES, 1);
+	testRandom(5, 2);
+	testRandom(2, 3);
+	testDotCorrectionPacking();
+	testDotCorrection(FRAMEBYTES);
+	testDotCorrection(5);
+	
+	printf("%s: %d errors\n", errors ? "FAILED" : "passed", errors);
+	return errors != 0;
+}
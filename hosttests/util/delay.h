@@ -0,0 +1,34 @@
+/************************************************************************
+	util/delay.h
+
+    Host test stand-in: delays are passed to hostDelayCycles() so a test
+    can keep track of time
+    Copyright (C) 2026 Simon Inns
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+	Email: simon.inns@gmail.com
+
+************************************************************************/
+
+#ifndef HOST_UTIL_DELAY_H_
+#define HOST_UTIL_DELAY_H_
+
+void hostDelayCycles(unsigned long cycles);
+
+#define __builtin_avr_delay_cycles(cycles)	hostDelayCycles(cycles)
+#define _delay_us(us)	hostDelayCycles((unsigned long)((us) * (F_CPU / 1000000UL)))
+#define _delay_ms(ms)	hostDelayCycles((unsigned long)((ms) * (F_CPU / 1000UL)))
+
+#endif /* HOST_UTIL_DELAY_H_ */
@@ -23,50 +23,136 @@
 
 // Includes
 #include <avr/io.h>
+#include <avr/interrupt.h>
+#include <avr/pgmspace.h>
+#include <util/atomic.h>
 #include "hardware.h"
+#include "scheduler.h"
 #include "ldr.h"
 
 // LDR Notes: Intense light generates around 550mV.  Darkness generates around 50mV
 
+// Oversampling accumulator
+unsigned int ldrSampleSum = 0;
+unsigned char ldrSampleCount = 0;
+
+// Filtered LDR value (12 bit value with LDR_FILTERFRACTION fractional bits)
+volatile unsigned int ldrFiltered = 0;
+unsigned char ldrFilterPrimed = 0;
+
+// Brightness table index last used (-1 if none yet)
+int ldrBrightnessIndex = -1;
+
+// Brightness curve
+//
+// The table index is spread linearly over CIE lightness (L*) from
+// LDR_MINLIGHTNESS to 100 and converted back to luminance with the inverse
+// CIE 1976 formula, Y = ((L* + 16) / 116)^3 (valid for L* above 8), so each
+// step in ambient light gives an equal looking step in display brightness.
+// The floating point is folded away by the compiler, leaving only the table.
+#if LDR_MINLIGHTNESS <= 8
+#error "LDR_MINLIGHTNESS must be above 8"
+#endif
+
+#define LDR_CIE_L(index)	(LDR_MINLIGHTNESS + ((100.0 - LDR_MINLIGHTNESS) * (index)) / (LDR_TABLESIZE - 1))
+#define LDR_CIE_Y(l)		((((l) + 16.0) / 116.0) * (((l) + 16.0) / 116.0) * (((l) + 16.0) / 116.0))
+#define LDR_CIE(index)		((unsigned int)(4095.0 * LDR_CIE_Y(LDR_CIE_L(index)) + 0.5))
+
+#define LDR_CIE_ROW(index) \
+	LDR_CIE((index) + 0), LDR_CIE((index) + 1), LDR_CIE((index) + 2), LDR_CIE((index) + 3), \
+	LDR_CIE((index) + 4), LDR_CIE((index) + 5), LDR_CIE((index) + 6), LDR_CIE((index) + 7), \
+	LDR_CIE((index) + 8), LDR_CIE((index) + 9), LDR_CIE((index) + 10), LDR_CIE((index) + 11), \
+	LDR_CIE((index) + 12), LDR_CIE((index) + 13), LDR_CIE((index) + 14), LDR_CIE((index) + 15)
+
+// Filtered LDR value (>> LDR_TABLESHIFT) to display brightness look up table
+const prog_uint16_t ldrBrightnessTable[LDR_TABLESIZE] PROGMEM = {
+	LDR_CIE_ROW(0), LDR_CIE_ROW(16), LDR_CIE_ROW(32), LDR_CIE_ROW(48),
+	LDR_CIE_ROW(64), LDR_CIE_ROW(80), LDR_CIE_ROW(96), LDR_CIE_ROW(112),
+	LDR_CIE_ROW(128), LDR_CIE_ROW(144), LDR_CIE_ROW(160), LDR_CIE_ROW(176),
+	LDR_CIE_ROW(192), LDR_CIE_ROW(208), LDR_CIE_ROW(224), LDR_CIE_ROW(240)
+};
+
 // Initialise the LDR read for reading
+//
+// The ADC is triggered by the timer0 compare A match (the 1 mS scheduler
+// tick) and the results are collected by the ADC interrupt, so the LDR value
+// is always available without waiting for a conversion.
 void initialiseLdr(void)
 {
 	// Set the LDR port to input and turn off the internal pull-up
 	cbi(LDR_DIR_PORT, LDR_PIN); // Set port as input
 	cbi(LDR_PORT, LDR_PIN); // Pull up off
 	
-	// Configure ADMUX for 5V Vref - Left justified - ADC channel 0
+	// Disable the digital input buffer on the LDR pin
+	DIDR0 = (1 << ADC0D);
+	
+	// Configure ADMUX for 5V Vref - Right justified - ADC channel 0
 	ADMUX = 0x40; // 01000000
 	
-	// Configure ADSC for ADC Enabled - /128 pre-scaler
-	ADCSRA = 0x87; // 10000111
+	// Configure ADCSRB for auto trigger from timer0 compare match A
+	ADCSRB = 0x03; // 00000011
+	
+	// Configure ADCSRA for ADC Enabled - Auto trigger - Interrupt enabled - /128 pre-scaler
+	// (a conversion takes 104 uS)
+	ADCSRA = 0xAF; // 10101111
 }
 
-// Read the current value of the LDR (returns 0-15)
-unsigned int readLdrValue(void)
+// ADC conversion complete interrupt procedure
+//
+// LDR_OVERSAMPLE 10 bit samples are added together and shifted down to give
+// a 12 bit result, which is fed into a first order IIR low-pass filter:
+//
+//   filtered = filtered - (filtered / 2^LDR_FILTERSHIFT) + (result * 2^(LDR_FILTERFRACTION - LDR_FILTERSHIFT))
+//
+// which settles at result * 2^LDR_FILTERFRACTION with a time constant of
+// 2^LDR_FILTERSHIFT results.
+ISR(ADC_vect)
 {
-	unsigned int ldrValue = 0;
+	SCHEDULER_WAKE();
 	
-	 // Clear the previous result
-	ADCH = 0x00;
+	ldrSampleSum += ADC;
 	
-	// Set ADSC to start an ADC conversion
-	sbi(ADCSRA, 6);
-
-	// Wait for the ADC conversion to complete
-	while(ADCSRA & (1 << ADSC));
+	if (++ldrSampleCount < LDR_OVERSAMPLE) return;
 	
-	// Store the result
-	ldrValue = ADC;
+	unsigned int result = ldrSampleSum >> LDR_OVERSAMPLESHIFT;
+	ldrSampleSum = 0;
+	ldrSampleCount = 0;
 	
-	// Vref is 5000 millivolts and we have 10-bits of resolution meaning
-	// 1 unit of the ADC is around 4.88 mV
-	//
-	// The LDR returns 5V at full brightness and 0Vs in darkness
+	// Start the filter from the first result (rather than fading up from dark)
+	if (ldrFilterPrimed == 0)
+	{
+		ldrFiltered = result << LDR_FILTERFRACTION;
+		ldrFilterPrimed = 1;
+	}
+	else ldrFiltered = ldrFiltered - (ldrFiltered >> LDR_FILTERSHIFT) + (result << (LDR_FILTERFRACTION - LDR_FILTERSHIFT));
+}
+
+// Read the filtered LDR value (returns 0-4095)
+unsigned int readLdrFiltered(void)
+{
+	unsigned int filtered;
 	
-	// Return 0 to 15 with x being dark and y being light
+	ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+	{
+		filtered = ldrFiltered;
+	}
 	
-	ldrValue /= 64;
+	return filtered >> LDR_FILTERFRACTION;
+}
+
+// Read the display brightness for the current light level (returns 0-4095)
+//
+// The table entry only changes once the filtered value has moved more than
+// LDR_HYSTERESIS past the edges of the current entry's band, so a light
+// level sitting on a band edge does not flicker between two brightnesses.
+int readLdrBrightness(void)
+{
+	int ldrValue = readLdrFiltered();
 	
-	return ldrValue;
-}
\ No newline at end of file
+	if (ldrBrightnessIndex < 0 ||
+		ldrValue < (ldrBrightnessIndex << LDR_TABLESHIFT) - LDR_HYSTERESIS ||
+		ldrValue >= ((ldrBrightnessIndex + 1) << LDR_TABLESHIFT) + LDR_HYSTERESIS)
+		ldrBrightnessIndex = ldrValue >> LDR_TABLESHIFT;
+	
+	return pgm_read_word_near(&ldrBrightnessTable[ldrBrightnessIndex]);
+}
@@ -30,8 +30,23 @@
 #define LDR_INP			PINC
 #define LDR_DIR_PORT	DDRC
 
+// Oversampling (16 samples of 10 bits give 12 bits, one result every 16 mS)
+#define LDR_OVERSAMPLE		16
+#define LDR_OVERSAMPLESHIFT	2
+
+// IIR filter (time constant of 16 results, around 0.25 seconds)
+#define LDR_FILTERSHIFT		4
+#define LDR_FILTERFRACTION	4	// Must be at least LDR_FILTERSHIFT
+
+// Brightness table (256 entries covering the 12 bit filtered value)
+#define LDR_TABLESIZE		256
+#define LDR_TABLESHIFT		4
+#define LDR_HYSTERESIS		8	// Filtered units past the band edges before moving
+#define LDR_MINLIGHTNESS	17	// CIE L* in darkness (gives a brightness of about 100)
+
 // Function prototypes
 void initialiseLdr(void);
-unsigned int readLdrValue(void);
+unsigned int readLdrFiltered(void);
+int readLdrBrightness(void);
 
 #endif /* LDR_H_ */
\ No newline at end of file
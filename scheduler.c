@@ -0,0 +1,224 @@
+/************************************************************************
+	scheduler.c
+
+    Word Clock Firmware - Task scheduler
+    Copyright (C) 2026 Simon Inns
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+	Email: simon.inns@gmail.com
+
+************************************************************************/
+
+// Includes
+#include <avr/io.h>
+#include <avr/interrupt.h>
+#include <avr/sleep.h>
+#include <util/atomic.h>
+#include "hardware.h"
+#include "scheduler.h"
+
+// Task table
+struct taskStruct task[MAXTASKS];
+
+// Number of ticks since the scheduler was started (wraps after 65.5 seconds)
+volatile unsigned int schedulerTicks = 0;
+
+// Duty cycle measurement (time asleep in 4 uS units during the current window)
+unsigned long sleepTime = 0;
+volatile unsigned char schedulerSleeping = 0;	// Set whilst asleep
+volatile unsigned int schedulerWakeTicks;		// Time the CPU woke up (see
+volatile unsigned char schedulerWakeCounts;	// SCHEDULER_WAKE())
+unsigned int dutyCycleWindowStart = 0;
+unsigned int dutyCycle = 1000;
+
+// Initialise the scheduler (uses timer0)
+//
+// Timer0 runs from Fosc with a /64 pre-scaler in CTC mode, counting 0-249 so
+// the compare interrupt fires every 1 mS.
+void initialiseScheduler(void)
+{
+	// Clear the task table
+	for (unsigned char taskNumber = 0; taskNumber < MAXTASKS; taskNumber++)
+		task[taskNumber].function = 0;
+	
+	TCCR0A = 0x02;				// Set timer0 to CTC mode (mode2)
+	TCCR0B = 0x03;				// 00000011 Set pre-scaler to /64
+	OCR0A = TICKCOUNTS - 1;		// Compare match every 250 counts
+	TCNT0 = 0x00;				// Reset the 8 bit timer register
+	TIMSK0 = (1 << OCIE0A);		// Enable the timer0 compare A interrupt
+	
+	// Idle sleep stops the CPU but leaves the timers (and so GSCLK and the
+	// TLC5940 refresh), SPI, ADC and pin-change interrupts running
+	set_sleep_mode(SLEEP_MODE_IDLE);
+}
+
+// Timer0 compare A interrupt procedure for the scheduler tick
+ISR(TIMER0_COMPA_vect)
+{
+	// The tick is counted first, as the compare flag is already clear
+	schedulerTicks++;
+	SCHEDULER_WAKE();
+}
+
+// Add a task to the scheduler, the first run is one period from now
+//
+// Returns the task number or MAXTASKS if the task table is full
+unsigned char addTask(void (*function)(void), unsigned int period)
+{
+	unsigned char taskNumber;
+	
+	for (taskNumber = 0; taskNumber < MAXTASKS; taskNumber++)
+		if (task[taskNumber].function == 0) break;
+	
+	if (taskNumber == MAXTASKS) return MAXTASKS;
+	
+	task[taskNumber].period = period;
+	task[taskNumber].nextRun = readTicks() + period;
+	task[taskNumber].runCount = 0;
+	task[taskNumber].lastRunTime = 0;
+	task[taskNumber].maxRunTime = 0;
+	task[taskNumber].function = function;
+	
+	return taskNumber;
+}
+
+// Make a task due a number of ticks from now (0 runs it on the next pass)
+void setTaskDelay(unsigned char taskNumber, unsigned int delay)
+{
+	if (taskNumber >= MAXTASKS) return;
+	
+	task[taskNumber].nextRun = readTicks() + delay;
+}
+
+// Read the number of ticks (mS) since the scheduler was started
+unsigned int readTicks(void)
+{
+	unsigned int ticks;
+	
+	ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+	{
+		ticks = schedulerTicks;
+	}
+	
+	return ticks;
+}
+
+// Read the scheduler time in 4 uS units (this wraps after around 262 mS so
+// is only used for measuring short intervals)
+unsigned int readSchedulerTime(void)
+{
+	unsigned int ticks;
+	unsigned char counts;
+	
+	ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+	{
+		ticks = schedulerTicks;
+		counts = TCNT0;
+		
+		// Account for a compare match which has not been serviced yet
+		if (TIFR0 & (1 << OCF0A))
+		{
+			ticks++;
+			counts = TCNT0;
+		}
+	}
+	
+	return (ticks * TICKCOUNTS) + counts;
+}
+
+// Read the fraction of time the CPU was awake over the last measurement
+// window in 1/1000ths
+//
+// Note: this includes the time spent in interrupts, as the interrupt which
+// wakes the CPU records when it woke up (see SCHEDULER_WAKE())
+unsigned int readDutyCycle(void)
+{
+	return dutyCycle;
+}
+
+// Run any tasks which are due and then sleep until the next interrupt
+// (called from the main loop)
+void runScheduler(void)
+{
+	unsigned int ticks = readTicks();
+	
+	for (unsigned char taskNumber = 0; taskNumber < MAXTASKS; taskNumber++)
+	{
+		if (task[taskNumber].function == 0) continue;
+		
+		// Is the task due? (the signed difference copes with the tick counter wrapping)
+		if ((int)(ticks - task[taskNumber].nextRun) < 0) continue;
+		
+		// Schedule the next run, if we have fallen more than a period behind
+		// skip the missed runs rather than running the task back to back
+		task[taskNumber].nextRun += task[taskNumber].period;
+		if ((int)(ticks - task[taskNumber].nextRun) >= 0)
+			task[taskNumber].nextRun = ticks + task[taskNumber].period;
+		
+		// Run the task and record how long it took
+		unsigned int startTime = readSchedulerTime();
+		task[taskNumber].function();
+		unsigned int runTime = readSchedulerTime() - startTime;
+		
+		task[taskNumber].runCount++;
+		task[taskNumber].lastRunTime = runTime;
+		if (runTime > task[taskNumber].maxRunTime) task[taskNumber].maxRunTime = runTime;
+	}
+	
+	// Update the duty cycle measurement at the end of each window
+	unsigned int windowTicks = ticks - dutyCycleWindowStart;
+	if (windowTicks >= DUTYCYCLEWINDOW)
+	{
+		// mS asleep per second is the time asleep in uS / window in mS
+		unsigned long asleep = (sleepTime * 4) / windowTicks;
+		
+		if (asleep > 1000) dutyCycle = 0;
+		else dutyCycle = 1000 - asleep;
+		
+		sleepTime = 0;
+		dutyCycleWindowStart = ticks;
+	}
+	
+	// Sleep until the next interrupt.  If the tick has moved on whilst the
+	// tasks were running there may be another task due, so don't sleep.
+	// Interrupts are disabled until just before the sleep instruction (sei
+	// takes effect after the following instruction) so the tick can't be
+	// missed between the check and going to sleep.
+	cli();
+	if (schedulerTicks == ticks)
+	{
+		unsigned int sleepStart = readSchedulerTime();
+		unsigned int wakeTime;
+		
+		schedulerSleeping = 1;
+		sleep_enable();
+		sei();
+		sleep_cpu();
+		sleep_disable();
+		cli();
+		
+		// The interrupt which woke the CPU recorded when it woke up (unless
+		// its handler doesn't use SCHEDULER_WAKE(), then it's now)
+		if (schedulerSleeping)
+		{
+			schedulerSleeping = 0;
+			wakeTime = readSchedulerTime();
+		}
+		else wakeTime = (schedulerWakeTicks * TICKCOUNTS) + schedulerWakeCounts;
+		
+		sleepTime += wakeTime - sleepStart;
+	}
+	sei();
+}
@@ -0,0 +1,98 @@
+/************************************************************************
+	scheduler.h
+
+    Word Clock Firmware - Task scheduler
+    Copyright (C) 2026 Simon Inns
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+	Email: simon.inns@gmail.com
+
+************************************************************************/
+
+#ifndef SCHEDULER_H_
+#define SCHEDULER_H_
+
+// The scheduler runs from a 1 mS tick generated by timer0.  Tasks are
+// registered with a period in ticks and are called from runScheduler() (in
+// the main loop) once they are due.  Each task's next run time is advanced by
+// its period (rather than set relative to when it actually ran) so a late run
+// doesn't push back all of the following runs.
+//
+// When no task is due the CPU is put into idle sleep until the next interrupt
+// (at the latest the next tick).
+//
+// Note: tasks are cooperative, a task which takes a long time to return
+// delays all of the other tasks.
+
+// Define the maximum number of tasks
+#define MAXTASKS			10
+
+// Timer0 counts per tick (Fosc/64 gives 250 counts of 4 uS per mS)
+#define TICKCOUNTS			250
+
+// Duty cycle measurement window in ticks
+#define DUTYCYCLEWINDOW		1000
+
+// Define a global structure for storing the task states
+struct taskStruct {
+	void (*function)(void);		// Task function (0 if the slot is unused)
+	unsigned int period;		// Ticks between runs (less than 32768)
+	unsigned int nextRun;		// Tick the task is next due
+	unsigned int runCount;		// Number of times the task has run
+	unsigned int lastRunTime;	// Run time of the last run in 4 uS units
+	unsigned int maxRunTime;	// Longest run time in 4 uS units
+};
+
+// Task table (defined in scheduler.c)
+extern struct taskStruct task[MAXTASKS];
+
+// Tick counter and wake-up time (defined in scheduler.c)
+extern volatile unsigned int schedulerTicks;
+extern volatile unsigned char schedulerSleeping;
+extern volatile unsigned int schedulerWakeTicks;
+extern volatile unsigned char schedulerWakeCounts;
+
+// Record the time the CPU woke up from the scheduler's idle sleep
+//
+// This goes at the start of every interrupt handler, so that the time spent
+// in interrupts is counted as awake by the duty cycle measurement.  It is a
+// macro rather than a function so the handlers don't have to save all the
+// call-used registers.  A tick which is pending is allowed for as in
+// readSchedulerTime().
+#define SCHEDULER_WAKE() \
+	do { \
+		if (schedulerSleeping) \
+		{ \
+			schedulerWakeTicks = schedulerTicks; \
+			schedulerWakeCounts = TCNT0; \
+			if (TIFR0 & (1 << OCF0A)) \
+			{ \
+				schedulerWakeTicks++; \
+				schedulerWakeCounts = TCNT0; \
+			} \
+			schedulerSleeping = 0; \
+		} \
+	} while (0)
+
+// Function prototypes
+void initialiseScheduler(void);
+unsigned char addTask(void (*function)(void), unsigned int period);
+void setTaskDelay(unsigned char taskNumber, unsigned int delay);
+unsigned int readTicks(void);
+unsigned int readSchedulerTime(void);
+unsigned int readDutyCycle(void);
+void runScheduler(void);
+
+#endif /* SCHEDULER_H_ */
@@ -0,0 +1,272 @@
+/************************************************************************
+	softclock.c
+
+    Word Clock Firmware - Software clock
+    Copyright (C) 2026 Simon Inns
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+	Email: simon.inns@gmail.com
+
+************************************************************************/
+
+// Includes
+#include <avr/io.h>
+#include "hardware.h"
+#include "ds1302.h"
+#include "scheduler.h"
+#include "softclock.h"
+
+// Sync states
+#define SYNC_IDLE			0	// Waiting for the next resync
+#define SYNC_SEARCH			1	// Looking for a seconds edge (first read)
+#define SYNC_SEARCHING		2	// Looking for a seconds edge
+#define SYNC_EDGE			3	// Resync (first read just before the next second)
+#define SYNC_HOLD			4	// Syncs held off whilst the time is being set
+
+// Period of the sync task whilst it is idle (it is run early when needed)
+#define SYNC_IDLEPERIOD		30000
+
+unsigned char syncState = SYNC_SEARCH;
+unsigned char resyncFlag = 0;			// The current sync is a resync
+unsigned char resyncCountdown = 0;		// Minutes until the next resync
+unsigned int edgeMargin = SYNC_EDGEMARGIN;
+unsigned int lastSeconds = 0;			// Seconds from the last search read
+
+// RTC read in progress
+unsigned char readStartedFlag = 0;
+unsigned char readDiscardFlag = 0;		// Ignore the read in progress
+unsigned int readTick;					// Tick the read started
+unsigned int readSoftTick;				// secondTick when the read started
+struct datetimeStruct readSoftTime;		// Software time when the read started
+
+// Tick at which the current second started
+unsigned int secondTick = 0;
+
+// Drift telemetry (software clock - RTC in mS at the last resync)
+int clockDrift = 0;
+unsigned int clockResyncs = 0;
+
+// Task numbers
+unsigned char secondTaskNumber;
+unsigned char syncTaskNumber;
+unsigned char minuteTaskNumber;
+
+// Seconds since midnight
+long secondOfDay(struct datetimeStruct *time)
+{
+	return ((long)time->hours * 3600) + (time->minutes * 60) + time->seconds;
+}
+
+// Set the software clock, with the current second starting at the tick
+// passed
+void setSoftClock(struct datetimeStruct *time, unsigned int ticks)
+{
+	datetime = *time;
+	
+	secondTick = ticks;
+	setTaskDelay(secondTaskNumber, 1000 - (readTicks() - ticks));
+	
+	// The time may have jumped so update the display
+	setTaskDelay(minuteTaskNumber, 0);
+	
+	resyncCountdown = SOFTCLOCK_RESYNCMINUTES;
+	syncState = SYNC_IDLE;
+}
+
+// Software clock second task
+void softClockSecondTask(void)
+{
+	secondTick += 1000;
+	
+	if (++datetime.seconds < 60) return;
+	datetime.seconds = 0;
+	
+	if (++datetime.minutes == 60)
+	{
+		datetime.minutes = 0;
+		if (++datetime.hours == 24) datetime.hours = 0;
+	}
+	
+	// Update the display for the new minute
+	setTaskDelay(minuteTaskNumber, 0);
+	
+	// Time for a resync?  If so start reading the RTC just before the next
+	// second is due
+	if (syncState == SYNC_IDLE && --resyncCountdown == 0)
+	{
+		int delay = (secondTick + 1000 - edgeMargin) - readTicks();
+		if (delay < 0) delay = 0;
+		
+		resyncFlag = 1;
+		syncState = SYNC_EDGE;
+		setTaskDelay(syncTaskNumber, delay);
+	}
+}
+
+// Schedule the next search read SYNC_SEARCHINTERVAL mS after the start of
+// the last one
+void nextSearchRead(unsigned int lastReadTick)
+{
+	int delay = (lastReadTick + SYNC_SEARCHINTERVAL) - readTicks();
+	if (delay < 0) delay = 0;
+	
+	setTaskDelay(syncTaskNumber, delay);
+}
+
+// Software clock sync task
+void softClockSyncTask(void)
+{
+	if (syncState == SYNC_IDLE || syncState == SYNC_HOLD) return;
+	
+	// Start reading the RTC (retrying until it is free).  The RTC time is
+	// taken when the read starts so keep the software time to compare it to.
+	if (readStartedFlag == 0)
+	{
+		if (startReadRTC())
+		{
+			readStartedFlag = 1;
+			readTick = readTicks();
+			readSoftTime = datetime;
+			readSoftTick = secondTick;
+		}
+		
+		setTaskDelay(syncTaskNumber, 1);
+		return;
+	}
+	
+	// Wait for the read to finish
+	if (!readCompleteRTC())
+	{
+		setTaskDelay(syncTaskNumber, 1);
+		return;
+	}
+	
+	readStartedFlag = 0;
+	
+	// Was the sync restarted whilst reading?
+	if (readDiscardFlag == 1)
+	{
+		readDiscardFlag = 0;
+		setTaskDelay(syncTaskNumber, 0);
+		return;
+	}
+	
+	struct datetimeStruct rtcTime = rtcDatetime;
+	struct datetimeStruct softTime = readSoftTime;
+	unsigned int softTick = readSoftTick;
+	unsigned int ticks = readTick;
+	
+	// Seconds the RTC is ahead of the software clock (allowing for midnight)
+	long aheadSeconds = secondOfDay(&rtcTime) - secondOfDay(&softTime);
+	if (aheadSeconds > 43200) aheadSeconds -= 86400;
+	if (aheadSeconds < -43200) aheadSeconds += 86400;
+	
+	switch (syncState)
+	{
+		case SYNC_EDGE:
+			// If the RTC has already moved on to the next second we have
+			// missed the edge, so start looking earlier next time (and
+			// search for the following edge)
+			if (aheadSeconds > 0 && edgeMargin < SYNC_MAXEDGEMARGIN) edgeMargin *= 2;
+			
+			// Fall through and start searching
+			
+		case SYNC_SEARCH:
+			lastSeconds = rtcTime.seconds;
+			syncState = SYNC_SEARCHING;
+			nextSearchRead(ticks);
+			return;
+			
+		case SYNC_SEARCHING:
+			// Keep searching until the seconds change
+			if (rtcTime.seconds == lastSeconds)
+			{
+				nextSearchRead(ticks);
+				return;
+			}
+			
+			if (edgeMargin > SYNC_EDGEMARGIN)
+			{
+				edgeMargin -= edgeMargin / 4;
+				if (edgeMargin < SYNC_EDGEMARGIN) edgeMargin = SYNC_EDGEMARGIN;
+			}
+			break;
+	}
+	
+	// The RTC second started between the last read and this one, measure the
+	// drift
+	if (resyncFlag == 1)
+	{
+		long drift = (unsigned int)(ticks - softTick) - (aheadSeconds * 1000);
+		
+		if (drift > 32767) drift = 32767;
+		if (drift < -32767) drift = -32767;
+		
+		clockDrift = drift;
+		clockResyncs++;
+	}
+	
+	setSoftClock(&rtcTime, ticks);
+}
+
+// Initialise the software clock from the RTC and register its tasks
+//
+// The minute task is run straight away whenever the minute changes
+void initialiseSoftClock(unsigned char minuteTask)
+{
+	minuteTaskNumber = minuteTask;
+	
+	secondTaskNumber = addTask(softClockSecondTask, 1000);
+	syncTaskNumber = addTask(softClockSyncTask, SYNC_IDLEPERIOD);
+	
+	// Start with the RTC time (to the nearest second) until the first sync
+	readRTC();
+	secondTick = readTicks();
+	
+	syncSoftClock();
+}
+
+// Synchronise the software clock to the RTC (call after setting the RTC)
+void syncSoftClock(void)
+{
+	// A read which is in progress may be from before the RTC was set
+	if (readStartedFlag == 1) readDiscardFlag = 1;
+	
+	resyncFlag = 0;
+	syncState = SYNC_SEARCH;
+	setTaskDelay(syncTaskNumber, 0);
+}
+
+// Stop syncing the software clock to the RTC until syncSoftClock() is called
+// (whilst the time is being changed before writing it to the RTC)
+void holdSoftClockSync(void)
+{
+	if (readStartedFlag == 1) readDiscardFlag = 1;
+	
+	syncState = SYNC_HOLD;
+}
+
+// Read the drift of the software clock from the RTC (in mS, positive if the
+// software clock is fast) measured at the last resync
+int readClockDrift(void)
+{
+	return clockDrift;
+}
+
+// Read the number of resyncs (drift measurements) since start-up
+unsigned int readClockResyncs(void)
+{
+	return clockResyncs;
+}
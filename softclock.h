@@ -0,0 +1,52 @@
+/************************************************************************
+	softclock.h
+
+    Word Clock Firmware - Software clock
+    Copyright (C) 2026 Simon Inns
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+	Email: simon.inns@gmail.com
+
+************************************************************************/
+
+#ifndef SOFTCLOCK_H_
+#define SOFTCLOCK_H_
+
+// The time in datetime is kept by a once a second scheduler task rather than
+// by reading the RTC.  The software clock is synchronised to the RTC at
+// start-up and after the RTC is set (by finding the RTC seconds edge) and
+// is resynchronised every SOFTCLOCK_RESYNCMINUTES minutes, measuring how far
+// the software clock has drifted from the RTC.  The RTC is read with
+// asynchronous burst reads, which are moved on by stepRTC() (called from a
+// scheduler task).
+//
+// Note: only the time is kept, the date fields are only updated by a resync.
+
+// Minutes between resyncs from the RTC
+#define SOFTCLOCK_RESYNCMINUTES	10
+
+// RTC read timing in mS when looking for a seconds edge
+#define SYNC_SEARCHINTERVAL		5		// Time between reads
+#define SYNC_EDGEMARGIN			20		// Start looking this early before a resync edge...
+#define SYNC_MAXEDGEMARGIN		500		// ...or up to this early if edges are being missed
+
+// Function prototypes
+void initialiseSoftClock(unsigned char minuteTaskNumber);
+void syncSoftClock(void);
+void holdSoftClockSync(void);
+int readClockDrift(void);
+unsigned int readClockResyncs(void);
+
+#endif /* SOFTCLOCK_H_ */
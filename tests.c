@@ -25,138 +25,174 @@
 #include <avr/io.h>
 #include "hardware.h"
 #include "tests.h"
-#include "ldr.h"
 #include "channelmap.h"
-#include "buttons.h"
 #include "tlc5940.h"
-#include <util/delay.h>
 
-void chaseTest(void)
+// The self tests are state machines which advance one step each time
+// selfTestStep() is called, so the main loop keeps running (and can stop the
+// tests) whilst they are in progress.  Waits are counted in PWM periods.
+#define FRAMES(milliseconds)	(((milliseconds) * 1000UL) / 16384)
+
+// Self test states
+#define TEST_IDLE			0
+#define TEST_CHASE			1
+#define TEST_EMR_FADEIN		2
+#define TEST_EMR_BLINKON	3
+#define TEST_EMR_BLINKOFF	4
+
+// This test is designed to run the clock in such a configuration that the Electro-Magnetic Radiation
+// (EMR) will be maximum. This is a stress-test for the hardware design.
+//
+// Power dissipation rating for HTSSOP (PWM) package without thermal pad is 1053mW
+// Device basic dissipation (maximum) = 60mW
+// Each channel can have between 3 and 7 LED's, hence dissipation can vary. Assuming
+// dot correction is unset (63/63) and Duty cycle is 100%, the values are:
+// 3 --> 299mW   4 --> 231mW   5 --> 163mW   6 --> 95mW   7 --> 26mW
+//
+// The maximum energy swing across the chip is obtained by setting PWM all the channels
+// on the chip to a GS value that cause the chip to reach its maximum dissipation rating.
+
+// The below numbers are slightly conservative figures, they run the chip within ~50mW
+// of its maximum rating.
+const int maxGSvalues[] = {1818, 1875, 1393, 1875, 1498, 1666, 2110};
+const int maxSafeGSforAll = 1393;
+
+// Self test state
+unsigned char testState = TEST_IDLE;
+unsigned char testSequence;
+unsigned char testChannel;
+unsigned char testWaitFrames;
+unsigned char testLastFrame;
+
+// Turn all channels off
+void allChannelsOff(void)
 {
-	int channel;
-
-	// Set the led fading speed
-	setLedFadeSpeed(4095, 400);
-
-	// Turn all channels off
-	for (channel = 0; channel <= 106; channel++)
+	for (unsigned char channel = 0; channel <= 106; channel++)
 	{
 		setLedBrightness(channelMap(channel), 0);
 	}
-
-	// Run the chase pattern
-	for (channel = 0; channel <= 106; channel++)
-	{
-		// We have to poll the buttons here since we have suspended the state machine
-		pollButtons();
-
-		if (channel != 15 && channel != 31 && channel != 47 && channel != 63 && channel != 79 && channel != 95)
-		{
-			// Current channel on
-			setLedBrightness(channelMap(channel), 4095);
-
-			// Update the TLC
-			while(updateTlc5940() == 1);
-
-			// Wait
-			for (unsigned int delay = 0; delay < 2; delay++) _delay_ms(10);
-
-			// Channel off
-			setLedBrightness(channelMap(channel), 0);
-		}
-	}
 }
 
-void emrTest(void)
+// Start the self test, either the chase test on its own (SELFTEST_CHASE) or
+// the chase test followed by the EMR test (SELFTEST_FULL)
+void startSelfTest(unsigned char sequence)
 {
-	// This test is designed to run the clock in such a configuration that the Electro-Magnetic Radiation
-	// (EMR) will be maximum. This is a stress-test for the hardware design.
-	//
-	// Power dissipation rating for HTSSOP (PWM) package without thermal pad is 1053mW
-	// Device basic dissipation (maximum) = 60mW
-	// Each channel can have between 3 and 7 LED's, hence dissipation can vary. Assuming
-	// dot correction is unset (63/63) and Duty cycle is 100%, the values are:
-	// 3 --> 299mW   4 --> 231mW   5 --> 163mW   6 --> 95mW   7 --> 26mW
-	//
-	// The maximum energy swing across the chip is obtained by setting PWM all the channels
-	// on the chip to a GS value that cause the chip to reach its maximum dissipation rating.
-
-	// The below numbers are slightly conservative figures, they run the chip within ~50mW
-	// of its maximum rating.
-	const int maxGSvalues[] = {1818, 1875, 1393, 1875, 1498, 1666, 2110};
-	const int maxSafeGSforAll = 1393;
+	// Set the led fading speed
+	setLedFadeSpeed(4095, 400);
 
 	// Turn all channels off
-	char channel;
-	for (channel = 0; channel <= 106; channel++)
-	{
-		setLedBrightness(channelMap(channel), 0);
-	}
-
-	char chip;
-	char counter;
+	allChannelsOff();
+	
+	testState = TEST_CHASE;
+	testSequence = sequence;
+	testChannel = 0;
+	testWaitFrames = 0;
+	testLastFrame = readFrameCounter();
+}
 
-	// TODO: advancement by pressing button instead of automatic
-	pollButtons();
-	//	if (button[BUTTON_TEST].buttonState == PRESSED) {};
+// Stop the self test (if running) and turn all channels off
+void stopSelfTest(void)
+{
+	if (testState == TEST_IDLE) return;
+	
+	allChannelsOff();
+	testState = TEST_IDLE;
+}
 
-	// Set slow fade-in
-	setLedFadeSpeed(15, 4095);
+// Returns 1 whilst the self test is running
+unsigned char selfTestRunning(void)
+{
+	return testState != TEST_IDLE;
+}
 
-	// First pass: all channels get lit ON progressively
-	for (chip = 0; chip < 7; chip++)
+// Advance the self test by one step (if the current wait is over)
+void selfTestStep(void)
+{
+	unsigned char frame = readFrameCounter();
+	unsigned char elapsedFrames = frame - testLastFrame;
+	testLastFrame = frame;
+	
+	if (testState == TEST_IDLE) return;
+	
+	// Wait
+	if (testWaitFrames > elapsedFrames)
 	{
-		for (counter = 0; counter < 15; counter++)
-		{
-			// Calculate channel number
-			channel = chip*16+counter;
-
-			// Current channel on
-			setLedBrightness(channelMap(channel), maxGSvalues[chip]);
-
-			// Update the TLC
-			while(updateTlc5940() == 1);
-
-			// Wait
-			_delay_ms(300);
-		}
+		testWaitFrames -= elapsedFrames;
+		return;
 	}
-
-	// Switch off fading
-	setLedFadeSpeed(4095, 4095);
-
-	// Second pass: all channels get lit ON progressively but they blink on and off
-	for (chip = 0; chip < 7; chip++)
+	testWaitFrames = 0;
+	
+	switch (testState)
 	{
-		for (counter = 0; counter < 15; counter++)
-		{
-			// Calculate channel number
-			channel = chip*16+counter;
-
-			// Turn ON all channels up to and including the present one
-			char i;
-			for (i = 0; i <= channel; i++)
+		// Chase test: light each channel in turn
+		case TEST_CHASE:
+			// Previous channel off
+			if (testChannel != 0) setLedBrightness(channelMap(testChannel - 1), 0);
+			
+			// Skip the unused channels
+			while (testChannel == 15 || testChannel == 31 || testChannel == 47 ||
+				testChannel == 63 || testChannel == 79 || testChannel == 95) testChannel++;
+			
+			if (testChannel > 106 && testSequence == SELFTEST_CHASE)
 			{
-				setLedBrightness(channelMap(i), maxSafeGSforAll);
+				testState = TEST_IDLE;
+				break;
 			}
-
-			// Update the TLC
-			while(updateTlc5940() == 1);
-
-			// Wait
-			_delay_ms(150);
-
-			// Turn off all channels
-			for (channel = 0; channel <= 106; channel++)
+			
+			if (testChannel > 106)
 			{
-				setLedBrightness(channelMap(channel), 0);
+				// Start the EMR test with a slow fade-in
+				setLedFadeSpeed(15, 4095);
+				allChannelsOff();
+				testState = TEST_EMR_FADEIN;
+				testChannel = 0;
+				break;
 			}
-
-			// Update the TLC
-			while(updateTlc5940() == 1);
-
-			// Wait
-			_delay_ms(150);
-		}
+			
+			// Current channel on
+			setLedBrightness(channelMap(testChannel), 4095);
+			testChannel++;
+			testWaitFrames = FRAMES(20);
+			break;
+		
+		// First EMR pass: all channels get lit ON progressively
+		case TEST_EMR_FADEIN:
+			// Current channel on (skipping the last channel of each chip)
+			setLedBrightness(channelMap(testChannel), maxGSvalues[testChannel >> 4]);
+			testChannel++;
+			if ((testChannel & 15) == 15) testChannel++;
+			
+			if (testChannel >= 16 * NUMBEROF5940)
+			{
+				// Switch off fading
+				setLedFadeSpeed(4095, 4095);
+				testState = TEST_EMR_BLINKON;
+				testChannel = 0;
+			}
+			testWaitFrames = FRAMES(300);
+			break;
+		
+		// Second EMR pass: all channels get lit ON progressively but they blink on and off
+		case TEST_EMR_BLINKON:
+			// Turn ON all channels up to and including the present one
+			for (unsigned char channel = 0; channel <= testChannel; channel++)
+			{
+				setLedBrightness(channelMap(channel), maxSafeGSforAll);
+			}
+			testState = TEST_EMR_BLINKOFF;
+			testWaitFrames = FRAMES(150);
+			break;
+		
+		case TEST_EMR_BLINKOFF:
+			// Turn off all channels
+			allChannelsOff();
+			
+			testChannel++;
+			if ((testChannel & 15) == 15) testChannel++;
+			
+			if (testChannel >= 16 * NUMBEROF5940) testState = TEST_IDLE;
+			else testState = TEST_EMR_BLINKON;
+			testWaitFrames = FRAMES(150);
+			break;
 	}
-}
+}
\ No newline at end of file
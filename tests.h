@@ -24,8 +24,14 @@
 #ifndef TESTS_H_
 #define TESTS_H_
 
+// Self test sequences
+#define SELFTEST_CHASE	0	// Chase test only (each LED lit in turn, about 2 seconds)
+#define SELFTEST_FULL	1	// Chase test then the EMR test (about a minute)
+
 // function prototypes
-void chaseTest(void);
-void emrTest(void);
+void startSelfTest(unsigned char sequence);
+void stopSelfTest(void);
+unsigned char selfTestRunning(void);
+void selfTestStep(void);
 
 #endif // TESTS_H_
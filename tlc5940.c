@@ -31,7 +31,9 @@
 // Includes
 #include <avr/io.h>
 #include <avr/interrupt.h>
+#include <util/atomic.h>
 #include "hardware.h"
+#include "scheduler.h"
 #include "tlc5940.h"
 #include <util/delay.h>
 
@@ -39,115 +41,127 @@
 unsigned char packedGrayScaleDataBuffer1[24 * NUMBEROF5940];
 unsigned char packedGrayScaleDataBuffer2[24 * NUMBEROF5940];
 
+// Double-buffering: the back buffer is owned by setGrayScaleValue() and the
+// front buffer by the SPI transmit engine.  Committing a frame swaps the
+// pointers, then only the channels written since the previous swap are
+// copied into the new back buffer to bring it up to date.
+unsigned char * volatile backBuffer = packedGrayScaleDataBuffer1;
+unsigned char * volatile frontBuffer = packedGrayScaleDataBuffer2;
+
+// Bitmap of the channels written to the back buffer since the last swap
+unsigned char changedChannels[2 * NUMBEROF5940];
+
 // Flags for the interrupt handling routine
-unsigned char waitingForXLAT = 0;
-unsigned char updatePending = 0;
+volatile unsigned char waitingForXLAT = 0;
+volatile unsigned char updatePending = 0;
+volatile unsigned char swapPending = 0;
+
+// Number of PWM periods (frames) since start up, this wraps every 256 frames
+volatile unsigned char frameCounter = 0;
+
+// Bytes sent by each SPI transfer complete interrupt.  At Fosc/2 a byte only
+// takes 16 cycles to shift out, which is less than the cost of entering and
+// leaving the interrupt, so each interrupt sends a short burst (polling SPIF
+// between bytes) and leaves the last byte to raise the next interrupt.
+#define SPI_BURSTBYTES	8
+
+// SPI transmit engine state (the byte counter is 8 bits, so the send
+// buffer must not be more than 255 bytes long)
+#if (24 * NUMBEROF5940) > 255
+#error "Too many TLC5940s for the SPI transmit engine"
+#endif
+volatile unsigned char spiTransmitting = 0;
+volatile unsigned char spiByteCounter = 0;
+volatile unsigned char spiByteCount = 0;
+unsigned char * volatile spiSendBuffer;
+
+// Array for storing the 6 bit dot correction data packed into bytes
+unsigned char packedDotCorrection[12 * NUMBEROF5940];
+
+// Flags for the dot correction handshake
+volatile unsigned char dotCorrectionPending = 0;
+volatile unsigned char dotCorrectionLatchPending = 0;
+volatile unsigned char extraSCLKPending = 0;
+
+#ifdef TLC_FADE_CONTROL
+	// Target brightness of each LED, packed in the same way as the gray-scale
+	// data (the actual brightness of each LED is the value in the back buffer)
+	unsigned char packedTargetBrightness[24 * NUMBEROF5940];
+
+	// Bitmap of the LEDs which have not yet reached their target brightness
+	unsigned char fadingLeds[2 * NUMBEROF5940];
+#endif
 
 // Set initial dot correction data
-void setInitialDotCorrection(unsigned char *dotCorrectionValues)
+//
+// Note: this uses the SPI module with interrupts disabled, the dot correction
+// can be changed later on with setDotCorrection() and updateDotCorrection()
+void setInitialDotCorrection(void)
 {	
 	// Set VPRG high (Dot correction mode)
 	sbi(TLC5940_VPRG_PORT, TLC5940_VPRG_PIN);
 	
-	// We are passed an array of unsigned char values which are 8 bits each, however the dot 
-	// correction is expecting 6 bit data for each channel (0-63) so only send the 6 least
-	// significant bits of each entry in the array.  The values need to be sent MSB first.
-	for (int ledChannel = 0; ledChannel < (16 * NUMBEROF5940); ledChannel++)
+	// Send the packed dot correction data MSB first
+	for (unsigned char byteCounter = 0; byteCounter < (12 * NUMBEROF5940); byteCounter++)
 	{
-		unsigned char bitMask = 0b00100000;
+		// Start transmission
+		SPDR = packedDotCorrection[byteCounter];
 		
-		for (int bitCounter = 5; bitCounter >= 0; bitCounter--)
-		{
-			// Set SIN to DC data bit
-			if (((dotCorrectionValues[ledChannel] & bitMask) >> bitCounter) == 1) sbi(TLC5940_SIN_PORT, TLC5940_SIN_PIN);
-			else cbi(TLC5940_SIN_PORT, TLC5940_SIN_PIN);
-			
-			// Pulse the serial clock
-			_delay_us(20);
-			sbi(TLC5940_SCLK_PORT, TLC5940_SCLK_PIN);
-			_delay_us(20);
-			cbi(TLC5940_SCLK_PORT, TLC5940_SCLK_PIN);
-			
-			// Move to the next bit in the mask
-			bitMask >>= 1;
-		}
-	}	
+		// Wait for transmission complete
+		while (!(SPSR & (1 << SPIF)));
+	}
+	
+	// Clear the SPI interrupt flag (SPSR has just been read with SPIF set, so
+	// reading SPDR clears it) before the interrupt driven engine takes over
+	(void)SPDR;
 	
 	// Pulse XLAT
-	_delay_us(20);
 	sbi(TLC5940_XLAT_PORT, TLC5940_XLAT_PIN);
-	_delay_us(20);
 	cbi(TLC5940_XLAT_PORT, TLC5940_XLAT_PIN);
 }
 
 // Since the TLC5940 requires an 'extra' SCLK pulse the first time the gray-scales
-// are cycled we have to do one input cycle manually, after this we can use the SPI
-// module for extra serial interface speed (this is due to the fact that there is
-// no way to tell the SPI module to generate the extra clock pulse).
+// are cycled we have to finish the first input cycle manually (this is due to the
+// fact that there is no way to tell the SPI module to generate the extra clock
+// pulse).  The gray-scale data itself is sent with the SPI module.
+//
+// Note: No delays are needed between the pin changes; at 16MHz a sbi/cbi takes
+// 125nS whilst the longest TLC5940 minimum pulse width (XLAT) is 20nS.
 void setInitialGrayScaleValues()
 {
 	// Set VPRG = Low (Gray-scale mode)
 	cbi(TLC5940_VPRG_PORT, TLC5940_VPRG_PIN);
 	
-	// Reset GSCLK_Counter = 0
-	int GSCLKcounter = 0;
-	
-	// Reset Data_Counter = 0
-	int dataCounter = 0;
-	
 	// Set BLANK = High (Turn LED's Off)
 	sbi(TLC5940_BLANK_PORT, TLC5940_BLANK_PIN);
 	
-	for (GSCLKcounter = 0; GSCLKcounter < 4096; GSCLKcounter++)
+	// Send the (cleared) gray-scale data
+	for (unsigned char byteCounter = 0; byteCounter < (24 * NUMBEROF5940); byteCounter++)
 	{
-		if (dataCounter > (NUMBEROF5940 * 192) )
-		{
-			// Pulse GSCLK
-			_delay_us(20);
-			sbi(TLC5940_GSCLK_PORT, TLC5940_GSCLK_PIN);
-			_delay_us(20);
-			cbi(TLC5940_GSCLK_PORT, TLC5940_GSCLK_PIN);
-		}
-		else
-		{
-			// Set SIN to the gray-scale data bit
-			cbi(TLC5940_SIN_PORT, TLC5940_SIN_PIN); // We just output zero for everything during initialisation
-			
-			// Pulse SCLK
-			_delay_us(20);
-			sbi(TLC5940_SCLK_PORT, TLC5940_SCLK_PIN);
-			_delay_us(20);
-			cbi(TLC5940_SCLK_PORT, TLC5940_SCLK_PIN);
-			
-			// Increment Data_Counter
-			dataCounter++;
-			
-			// Pulse GSCLK
-			_delay_us(20);
-			sbi(TLC5940_GSCLK_PORT, TLC5940_GSCLK_PIN);
-			_delay_us(20);
-			cbi(TLC5940_GSCLK_PORT, TLC5940_GSCLK_PIN);
-		}	
+		// Start transmission
+		SPDR = frontBuffer[byteCounter];
+		
+		// Wait for transmission complete
+		while (!(SPSR & (1 << SPIF)));
 	}
 	
+	// Clear the SPI interrupt flag (see setInitialDotCorrection())
+	(void)SPDR;
+	
 	// Pulse XLAT to latch in GS data
-	_delay_us(20);
 	sbi(TLC5940_XLAT_PORT, TLC5940_XLAT_PIN);
-	_delay_us(20);
 	cbi(TLC5940_XLAT_PORT, TLC5940_XLAT_PIN);
 
 	// Set BLANK = Low (Turn LED's on)
-	_delay_us(20);
 	cbi(TLC5940_BLANK_PORT, TLC5940_BLANK_PIN);
 	
 	// Send an extra SCLK pulse since this is the first gray-scale cycle
-	// after the dot correction data has been set
-		
-	// Pulse SCLK
-	_delay_us(20);
+	// after the dot correction data has been set (with the SPI module
+	// off so that we can drive the SCLK pin)
+	cbi(SPCR, SPE);
 	sbi(TLC5940_SCLK_PORT, TLC5940_SCLK_PIN);
-	_delay_us(20);
 	cbi(TLC5940_SCLK_PORT, TLC5940_SCLK_PIN);
+	sbi(SPCR, SPE);
 }			
 
 // Initialise the TLC5940 devices
@@ -163,30 +177,32 @@ void initialiseTlc5940()
 	cbi(TLC5940_XLAT_PORT, TLC5940_XLAT_PIN);
 	sbi(TLC5940_BLANK_PORT, TLC5940_BLANK_PIN);
 	
-	// Set up an array of dot correction values (0-63)
-	unsigned char dotCorrectionValues[16 * NUMBEROF5940];
+	// Set up the dot correction values (0-63)
 	for (unsigned char ledChannel = 0; ledChannel < (16 * NUMBEROF5940); ledChannel++)
-		dotCorrectionValues[ledChannel] = 63;
+		setDotCorrection(ledChannel, 63);
+	
+	// Set up SPI for communicating with the TLC5940
+	// Enable SPI as master
+	//SPCR = (1 << SPE) | (1 << MSTR) | (1 << SPR0) | (1 << SPR1); // Fosc/128
+	SPCR = (1<<SPE) | (1<<MSTR); // Fosc/2
+	SPSR = (1<<SPI2X);
 	
 	// Set the initial dot correction values
-	setInitialDotCorrection(dotCorrectionValues);
+	setInitialDotCorrection();
 	
 	// Clear the LED channel data
 	for (int bytePointer = 0; bytePointer < 24 * NUMBEROF5940; bytePointer++)
 	{
 		packedGrayScaleDataBuffer1[bytePointer] = 0;
-		packedGrayScaleDataBuffer1[bytePointer] = 0;
+		packedGrayScaleDataBuffer2[bytePointer] = 0;
 	}
 	
+	for (unsigned char byteCounter = 0; byteCounter < 2 * NUMBEROF5940; byteCounter++)
+		changedChannels[byteCounter] = 0;
+	
 	// Set the initial gray-scale values
 	setInitialGrayScaleValues();
 
-	// Set up SPI for communicating with the TLC5940
-	// Enable SPI as master
-	//SPCR = (1 << SPE) | (1 << MSTR) | (1 << SPR0) | (1 << SPR1); // Fosc/128
-	SPCR = (1<<SPE) | (1<<MSTR); // Fosc/2
-	SPSR = (1<<SPI2X);
-
 	// Timer1 is used to generate the GSCLK clock signal
 	//
 	// We want an overall PWM period of around 60Hz
@@ -216,69 +232,218 @@ void initialiseTlc5940()
 	TCNT2 = 0x00;	// Reset the 8 bit timer register
 }
 
-// Set the gray-scale value of a LED channel
+// Pack a 12 bit value into a buffer laid out in the TLC5940 shift order
 //
 // Note: The TLC5940 expects 12 bit values for each channel, however we store
 // the values in an 8 bit array (since that is what we need for sending the 
 // data over the SPI).  This function places our 12 bit value in the correct
 // place.
-void setGrayScaleValue(unsigned char channel, int grayScale)
+void setTwelveBitValue(unsigned char *buffer, unsigned char channel, int value)
 {
-	// Range check the grayscale data
-	if (grayScale > 4095) grayScale = 4095;
-	if (grayScale < 0) grayScale = 0;
-	
-	// Now we pack the 12 bit channel data into our 8 bit array
 	unsigned char eightBitIndex = (NUMBEROF5940 * 16 - 1) - channel;
-	unsigned char *twelveBitIndex = packedGrayScaleDataBuffer1 + ((eightBitIndex * 3) >> 1);
+	unsigned char *twelveBitIndex = buffer + ((eightBitIndex * 3) >> 1);
 	
 	if (eightBitIndex & 1)
 	{
 		// Value starts in the middle of the byte
 		// Set only the top 4 bits
-		*twelveBitIndex = (*twelveBitIndex & 0xF0) | (grayScale >> 8);
+		*twelveBitIndex = (*twelveBitIndex & 0xF0) | (value >> 8);
 		
 		// Now set the lower 4 bits of the next byte
-		*(++twelveBitIndex) = grayScale & 0xFF;
+		*(++twelveBitIndex) = value & 0xFF;
 	}
 	else
 	{
 		// Value starts at the start of the byte
-		*(twelveBitIndex++) = grayScale >> 4;
+		*(twelveBitIndex++) = value >> 4;
 		
 		// Now set the 4 lower bits of the next byte leaving the top 4 bits alone
-		*twelveBitIndex = ((int)(grayScale << 4)) | (*twelveBitIndex & 0xF);
-	}		
+		*twelveBitIndex = ((int)(value << 4)) | (*twelveBitIndex & 0xF);
+	}
+}
+
+// Unpack a 12 bit value from a buffer laid out in the TLC5940 shift order
+int getTwelveBitValue(unsigned char *buffer, unsigned char channel)
+{
+	unsigned char eightBitIndex = (NUMBEROF5940 * 16 - 1) - channel;
+	unsigned char *twelveBitIndex = buffer + ((eightBitIndex * 3) >> 1);
+	
+	if (eightBitIndex & 1)
+	{
+		// Value starts in the middle of the byte
+		return ((twelveBitIndex[0] & 0x0F) << 8) | twelveBitIndex[1];
+	}
+	else
+	{
+		// Value starts at the start of the byte
+		return (twelveBitIndex[0] << 4) | (twelveBitIndex[1] >> 4);
+	}
+}
+
+// Set the gray-scale value of a LED channel
+void setGrayScaleValue(unsigned char channel, int grayScale)
+{
+	// Range check the grayscale data
+	if (grayScale > 4095) grayScale = 4095;
+	if (grayScale < 0) grayScale = 0;
+	
+	// The buffer swap happens in interrupt context so the write and the
+	// changed channel flag must not be separated
+	ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+	{
+		// Now we pack the 12 bit channel data into our 8 bit array
+		setTwelveBitValue(backBuffer, channel, grayScale);
+		
+		// Flag the channel as changed
+		changedChannels[channel >> 3] |= (1 << (channel & 7));
+	}
 }		
 
+// Swap the front and back buffers
+//
+// Note: this must be called with interrupts disabled and only when the
+// SPI transmit engine is not reading the front buffer
+void swapBuffers(void)
+{
+	unsigned char *newFrontBuffer = backBuffer;
+	unsigned char *newBackBuffer = frontBuffer;
+	
+	frontBuffer = newFrontBuffer;
+	backBuffer = newBackBuffer;
+	
+	// The new back buffer is one frame behind, so copy over the channels which
+	// have changed since the last swap (copying both bytes which hold a channel
+	// is safe since the neighbouring channel is either unchanged, and therefore
+	// identical in both buffers, or changed and copied too)
+	for (unsigned char byteCounter = 0; byteCounter < 2 * NUMBEROF5940; byteCounter++)
+	{
+		unsigned char changedBits = changedChannels[byteCounter];
+		if (changedBits == 0) continue;
+		
+		for (unsigned char bitCounter = 0; bitCounter < 8; bitCounter++)
+		{
+			if (changedBits & (1 << bitCounter))
+			{
+				unsigned char eightBitIndex = (NUMBEROF5940 * 16 - 1) - ((byteCounter << 3) + bitCounter);
+				unsigned char bytePointer = (eightBitIndex * 3) >> 1;
+				
+				newBackBuffer[bytePointer] = newFrontBuffer[bytePointer];
+				newBackBuffer[bytePointer + 1] = newFrontBuffer[bytePointer + 1];
+			}
+		}
+		
+		changedChannels[byteCounter] = 0;
+	}
+}
+
 // Update the TLC5940 send buffer
 int updateTlc5940(void)
 {
-	// If an update is already pending, return with status 0;
-	if (updatePending == 1) return 0;
-	
-	// Copy over our packed data buffer to the send data buffer
+	// Commit the back buffer as the next frame to send
 	// Note: We are using double-buffering to prevent a partial
 	// update from occurring (since an XLAT interrupt could occur
 	// whilst we are still updating the data)
-
-	for (int byteCounter = 0; byteCounter < (24 * NUMBEROF5940); byteCounter++)
-	packedGrayScaleDataBuffer2[byteCounter] = packedGrayScaleDataBuffer1[byteCounter];
-	
-	// Set the update pending flag
-	updatePending = 1;
+	ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+	{
+		if (spiTransmitting == 1)
+		{
+			// The front buffer is being sent, so swap as soon as
+			// the transmission is complete
+			swapPending = 1;
+		}
+		else
+		{
+			// Swap now (replacing any frame which has not been sent yet)
+			swapBuffers();
+			updatePending = 1;
+		}
+	}
 	
 	// Update OK, return with status 0
 	return 0;
 }
 
+// Set the dot correction value (0-63) of a LED channel
+//
+// Note: the new value is only sent to the TLC5940s by updateDotCorrection()
+void setDotCorrection(unsigned char channel, unsigned char dotCorrection)
+{
+	// Range check the dot correction data
+	if (dotCorrection > 63) dotCorrection = 63;
+	
+	// Pack the 6 bit channel data into our 8 bit array (4 channels in 3 bytes)
+	unsigned char sixBitIndex = (NUMBEROF5940 * 16 - 1) - channel;
+	unsigned char *eightBitIndex = packedDotCorrection + ((sixBitIndex >> 2) * 3);
+	
+	ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+	{
+		switch (sixBitIndex & 3)
+		{
+			case 0:	eightBitIndex[0] = (eightBitIndex[0] & 0x03) | (dotCorrection << 2);
+					break;
+					
+			case 1:	eightBitIndex[0] = (eightBitIndex[0] & 0xFC) | (dotCorrection >> 4);
+					eightBitIndex[1] = (eightBitIndex[1] & 0x0F) | (dotCorrection << 4);
+					break;
+					
+			case 2:	eightBitIndex[1] = (eightBitIndex[1] & 0xF0) | (dotCorrection >> 2);
+					eightBitIndex[2] = (eightBitIndex[2] & 0x3F) | (dotCorrection << 6);
+					break;
+					
+			case 3:	eightBitIndex[2] = (eightBitIndex[2] & 0xC0) | dotCorrection;
+					break;
+		}
+	}
+}
+
+// Set the dot correction value (0-63) of all the channels of one TLC5940
+void setTlcDotCorrection(unsigned char tlcNumber, unsigned char dotCorrection)
+{
+	for (unsigned char localChannel = 0; localChannel < 16; localChannel++)
+		setDotCorrection((tlcNumber * 16) + localChannel, dotCorrection);
+}
+
+// Send the dot correction data to the TLC5940s
+//
+// The data is shifted out by the SPI transmit engine in the background and
+// latched by the XLAT interrupt, after which the current gray-scale frame is
+// sent again (with the extra SCLK pulse the TLC5940 needs after a dot
+// correction cycle)
+void updateDotCorrection(void)
+{
+	dotCorrectionPending = 1;
+}
+
+// Start the SPI transmit engine
+void startSpiTransmission(unsigned char *buffer, unsigned char byteCount)
+{
+	spiSendBuffer = buffer;
+	spiByteCount = byteCount;
+	spiTransmitting = 1;
+	spiByteCounter = 1;
+	sbi(SPCR, SPIE);
+	SPDR = buffer[0];
+}
+
+// Read the number of PWM periods (frames) since start up
+//
+// Note: a frame is 16.384 mS long and the counter wraps every 256 frames
+unsigned char readFrameCounter(void)
+{
+	return frameCounter;
+}
+
 // Timer2 interrupt procedure for XLAT processing
 ISR(TIMER2_OVF_vect)
 {	
+	SCHEDULER_WAKE();
 		
 	// Get ready for the next interrupt -----------------------------------
 	TCNT2 = 0x00;	// Reset the 16 bit timer register
 	
+	// Count the PWM period
+	frameCounter++;
+	
 	// Process the XLAT interrupt --------------------------------------------------
 	
 	// Turn off the LEDs
@@ -293,6 +458,27 @@ ISR(TIMER2_OVF_vect)
 		
 		// Clear the flag
 		waitingForXLAT = 0;
+		
+		if (dotCorrectionLatchPending == 1)
+		{
+			// Dot correction data latched, go back to gray-scale mode and
+			// send the current frame again
+			cbi(TLC5940_VPRG_PORT, TLC5940_VPRG_PIN);
+			dotCorrectionLatchPending = 0;
+			extraSCLKPending = 1;
+			updatePending = 1;
+		}
+		else if (extraSCLKPending == 1)
+		{
+			// This was the first gray-scale cycle after a dot correction cycle
+			// so it needs an extra SCLK pulse (which the SPI module can't
+			// generate, so the pin is pulsed with the SPI module off)
+			cbi(SPCR, SPE);
+			sbi(TLC5940_SCLK_PORT, TLC5940_SCLK_PIN);
+			cbi(TLC5940_SCLK_PORT, TLC5940_SCLK_PIN);
+			sbi(SPCR, SPE);
+			extraSCLKPending = 0;
+		}
 	}
 	
 	// Turn on the LEDs
@@ -304,52 +490,56 @@ ISR(TIMER2_OVF_vect)
 
 	unsigned char updateCheck = 0;
 
-	// Process the LEDs
-	for (int ledNumber = 0; ledNumber < 16 * NUMBEROF5940; ledNumber++)
+	// Process only the LEDs which are fading, 8 at a time
+	for (unsigned char byteCounter = 0; byteCounter < 2 * NUMBEROF5940; byteCounter++)
 	{
-		if (led[ledNumber].targetBrightness != led[ledNumber].actualBrightness)
+		// Skip groups of LEDs with nothing to do
+		if (fadingLeds[byteCounter] == 0) continue;
+		
+		for (unsigned char bitCounter = 0; bitCounter < 8; bitCounter++)
 		{
-			// Fade the colour up or down
-			if (led[ledNumber].targetBrightness >= led[ledNumber].actualBrightness)
-			{
-				led[ledNumber].actualBrightness += fadeOnSpeed;
-				
-				// Range check
-				if (led[ledNumber].actualBrightness > led[ledNumber].targetBrightness)
-					led[ledNumber].actualBrightness = led[ledNumber].targetBrightness;
-				
-				updateCheck = 1;
-			}				
-			else
+			if (!(fadingLeds[byteCounter] & (1 << bitCounter))) continue;
+			
+			unsigned char ledNumber = (byteCounter << 3) + bitCounter;
+			int targetBrightness = getTwelveBitValue(packedTargetBrightness, ledNumber);
+			int actualBrightness = getTwelveBitValue(backBuffer, ledNumber);
+			
+			if (targetBrightness != actualBrightness)
 			{
-				led[ledNumber].actualBrightness -= fadeOffSpeed;
+				// Fade the colour up or down
+				if (targetBrightness >= actualBrightness)
+				{
+					actualBrightness += fadeOnSpeed;
+					
+					// Range check
+					if (actualBrightness > targetBrightness)
+						actualBrightness = targetBrightness;
+				}				
+				else
+				{
+					actualBrightness -= fadeOffSpeed;
+					
+					// Range check
+					if (actualBrightness < targetBrightness)
+						actualBrightness = targetBrightness;
+				}				
 				
-				// Range check
-				if (led[ledNumber].actualBrightness < led[ledNumber].targetBrightness)
-					led[ledNumber].actualBrightness = led[ledNumber].targetBrightness;
+				// Set the correct LED channels for the RGB LED (the target is
+				// always 0-4095 so no further range check is needed)
+				setGrayScaleValue(ledNumber, actualBrightness);
 				
 				updateCheck = 1;
-			}				
-				
-			// Range check the fade
-			if (led[ledNumber].actualBrightness > 4095)
-				led[ledNumber].actualBrightness = 4095;
-
-							
-			if (led[ledNumber].actualBrightness < 0)
-				led[ledNumber].actualBrightness = 0;
+			}
 			
-			// Set the correct LED channels for the RGB LED
-			setGrayScaleValue(ledNumber, led[ledNumber].actualBrightness);
+			// Remove the LED from the fading list once it reaches its target
+			if (targetBrightness == actualBrightness)
+				fadingLeds[byteCounter] &= ~(1 << bitCounter);
 		}
+	}
 	
-		// Update the TLC5940s
-		if (updateCheck == 1)
-		{
-			updateTlc5940();
-			updateCheck == 0;
-		}			
-	}		
+	// Update the TLC5940s once all the LEDs have been processed, so that
+	// every fade step of this PWM period ends up in the same frame
+	if (updateCheck == 1) updateTlc5940();
 
 #endif
 	
@@ -357,29 +547,78 @@ ISR(TIMER2_OVF_vect)
 	// shift in the serial data (since the PWM pulse for GSCLK continues to run
 	// in the background).  The shifting of the data must happen before the next
 	// XLAT interrupt is due which means we have about 16,000 uS to do this.
-	// As you add more and more TLC5940s this shifting will take longer and longer
-	// until you simply can't shift the data in time, then it's time to buy another
-	// AVR if you want to support more LED channels...
+	//
+	// Here we only send the first byte; the SPI transfer complete interrupt sends
+	// the rest of the buffer in bursts of SPI_BURSTBYTES, so interrupts are not
+	// blocked for the whole transfer.
 	
-	// Do we have an update to the data pending?
-	if (updatePending == 1)
+	// Is the serial interface free?
+	if (spiTransmitting == 0 && waitingForXLAT == 0)
 	{
-		// We have an update pending, write the serial information to the device
-		for (int byteCounter = 0; byteCounter < (24 * NUMBEROF5940); byteCounter++)
+		// Do we have a dot correction update pending?  (not until the
+		// previous dot correction cycle is completely finished)
+		if (dotCorrectionPending == 1 && dotCorrectionLatchPending == 0 && extraSCLKPending == 0)
 		{
-			// Start transmission
-			SPDR = packedGrayScaleDataBuffer2[byteCounter];
-			
-			// Wait for transmission complete
-			while (!(SPSR & (1 << SPIF)));
+			// Set VPRG high (Dot correction mode) and start the transmission
+			sbi(TLC5940_VPRG_PORT, TLC5940_VPRG_PIN);
+			dotCorrectionPending = 0;
+			dotCorrectionLatchPending = 1;
+			startSpiTransmission(packedDotCorrection, 12 * NUMBEROF5940);
 		}
+		// Do we have an update to the data pending?
+		else if (updatePending == 1)
+		{
+			// Start the transmission
+			startSpiTransmission(frontBuffer, 24 * NUMBEROF5940);
+		}
+	}
+}
+
+// SPI transfer complete interrupt procedure for shifting out the gray-scale
+// and dot correction data
+ISR(SPI_STC_vect)
+{
+	SCHEDULER_WAKE();
+	
+	unsigned char byteCounter = spiByteCounter;
+	
+	// Send the next burst of bytes, if there are any left
+	if (byteCounter < spiByteCount)
+	{
+		unsigned char burstEnd = spiByteCount;
+		if (burstEnd - byteCounter > SPI_BURSTBYTES) burstEnd = byteCounter + SPI_BURSTBYTES;
 		
-		// Serial data is now updated, clear the flag
-		updatePending = 0;
+		SPDR = spiSendBuffer[byteCounter++];
 		
-		// Set the waiting for XLAT flag to indicate there is data waiting
-		// to be latched
-		waitingForXLAT = 1;
+		while (byteCounter < burstEnd)
+		{
+			// Wait for transmission complete (writing SPDR clears SPIF, so
+			// these bytes don't raise an interrupt)
+			while (!(SPSR & (1 << SPIF)));
+			SPDR = spiSendBuffer[byteCounter++];
+		}
+		
+		spiByteCounter = byteCounter;
+		return;
+	}
+	
+	// Serial data is now updated, stop the SPI interrupt
+	cbi(SPCR, SPIE);
+	spiTransmitting = 0;
+	
+	// Clear the update pending flag (unless this was dot correction data)
+	if (dotCorrectionLatchPending == 0) updatePending = 0;
+	
+	// Set the waiting for XLAT flag to indicate there is data waiting
+	// to be latched
+	waitingForXLAT = 1;
+	
+	// Was a frame committed during the transmission?
+	if (swapPending == 1)
+	{
+		swapBuffers();
+		swapPending = 0;
+		updatePending = 1;
 	}
 }
 
@@ -389,11 +628,13 @@ ISR(TIMER2_OVF_vect)
 	// Initialise the LED states
 	void initialiseFadingLeds(void)
 	{
-		for (int ledNumber = 0; ledNumber < 16 * NUMBEROF5940; ledNumber++)
-		{
-			led[ledNumber].targetBrightness = 0;
-			led[ledNumber].actualBrightness = 0;
-		}
+		// Note: the actual brightness of every LED starts at 0 since the
+		// gray-scale buffers are cleared by initialiseTlc5940()
+		for (unsigned char bytePointer = 0; bytePointer < 24 * NUMBEROF5940; bytePointer++)
+			packedTargetBrightness[bytePointer] = 0;
+		
+		for (unsigned char byteCounter = 0; byteCounter < 2 * NUMBEROF5940; byteCounter++)
+			fadingLeds[byteCounter] = 0;
 	
 		fadeOnSpeed = 30;
 		fadeOffSpeed = 100;
@@ -401,9 +642,22 @@ ISR(TIMER2_OVF_vect)
 	
 	void setLedBrightness(int ledNumber, int brightness)
 	{
-		led[ledNumber].targetBrightness = brightness;
+		// Range check the brightness
+		if (brightness > 4095) brightness = 4095;
+		if (brightness < 0) brightness = 0;
+		
+		// The fading list is processed in interrupt context so the target and
+		// the list entry must be updated together
+		ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+		{
+			setTwelveBitValue(packedTargetBrightness, ledNumber, brightness);
+			
+			// Add the LED to the fading list if it needs to change
+			if (brightness != getTwelveBitValue(backBuffer, ledNumber))
+				fadingLeds[ledNumber >> 3] |= (1 << (ledNumber & 7));
+		}
 	}
-
+	
 	// Set the fade on and off speed for an LED
 	// Note: The fade speed is the amount of fade in one PWM period i.e. if PWM frequency is 60Hz
 	// 8 would be 'fade 8 units 60 times a second' - units are the brightness of 0-4095
@@ -53,15 +53,6 @@
 
 #ifdef TLC_FADE_CONTROL
 
-	// Structures for storing LED fading information
-	struct ledState
-	{
-		int targetBrightness;
-		int actualBrightness;
-	};
-
-	struct ledState led[NUMBEROF5940 * 16];
-	
 	// Globals for the LED fading speeds
 	int fadeOnSpeed;
 	int fadeOffSpeed;
@@ -69,11 +60,17 @@
 #endif
 
 // Function prototypes
-void setInitialDotCorrection(unsigned char *dotCorrectionValues);
+void setInitialDotCorrection(void);
 void setInitialGrayScaleValues(void);
 void initialiseTlc5940(void);
+void setTwelveBitValue(unsigned char *buffer, unsigned char channel, int value);
+int getTwelveBitValue(unsigned char *buffer, unsigned char channel);
 void setGrayScaleValue(unsigned char channel, int grayScale);
 int updateTlc5940(void);
+void setDotCorrection(unsigned char channel, unsigned char dotCorrection);
+void setTlcDotCorrection(unsigned char tlcNumber, unsigned char dotCorrection);
+void updateDotCorrection(void);
+unsigned char readFrameCounter(void);
 
 #ifdef TLC_FADE_CONTROL
 	void initialiseFadingLeds(void);